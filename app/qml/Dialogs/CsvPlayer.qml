@@ -59,7 +59,7 @@ Window {
       Cpp_NativeWindow.removeWindow(root)
     }
 
-    if (!visible && Cpp_CSV_Player.isOpen)
+    if (!visible && (Cpp_CSV_Player.isOpen || Cpp_CSV_Player.isIndexing))
       Cpp_CSV_Player.closeFile()
   }
 
@@ -104,11 +104,16 @@ Window {
   Connections {
     target: Cpp_CSV_Player
     function onOpenChanged() {
-      if (Cpp_CSV_Player.isOpen)
+      if (Cpp_CSV_Player.isOpen || Cpp_CSV_Player.isIndexing)
         root.showNormal()
       else
         root.hide()
     }
+
+    function onIndexingChanged() {
+      if (Cpp_CSV_Player.isIndexing)
+        root.showNormal()
+    }
   }
 
   //
@@ -159,10 +164,66 @@ Window {
       //
       // Timestamp display
       //
-      Label {
-        text: Cpp_CSV_Player.timestamp
-        Layout.alignment: Qt.AlignLeft
-        font: Cpp_Misc_CommonFonts.monoFont
+      RowLayout {
+        spacing: 8
+        Layout.fillWidth: true
+
+        Label {
+          Layout.alignment: Qt.AlignVCenter
+          font: Cpp_Misc_CommonFonts.monoFont
+          text: Cpp_CSV_Player.isIndexing ?
+                  qsTr("Indexing rows… %1%").arg(Math.round(Cpp_CSV_Player.indexProgress * 100)) :
+                  Cpp_CSV_Player.isConverting ?
+                    qsTr("Converting to CSV… %1%").arg(Math.round(Cpp_CSV_Player.conversionProgress * 100)) :
+                    Cpp_CSV_Player.timestamp
+        }
+
+        Item {
+          Layout.fillWidth: true
+        }
+
+        //
+        // Playback speed selector
+        //
+        ComboBox {
+          id: speed
+          textRole: "text"
+          valueRole: "value"
+          Layout.alignment: Qt.AlignVCenter
+          enabled: Cpp_CSV_Player.isOpen
+          onActivated: Cpp_CSV_Player.speed = currentValue
+          Component.onCompleted: currentIndex = indexOfValue(Cpp_CSV_Player.speed)
+          model: [
+            { text: "0.1×", value: 0.1 },
+            { text: "0.25×", value: 0.25 },
+            { text: "0.5×", value: 0.5 },
+            { text: "1×", value: 1 },
+            { text: "2×", value: 2 },
+            { text: "5×", value: 5 },
+            { text: "10×", value: 10 },
+            { text: "25×", value: 25 },
+            { text: "50×", value: 50 },
+            { text: "100×", value: 100 },
+            { text: qsTr("Max"), value: 0 }
+          ]
+
+          Connections {
+            target: Cpp_CSV_Player
+            function onSpeedChanged() {
+              speed.currentIndex = speed.indexOfValue(Cpp_CSV_Player.speed)
+            }
+          }
+        }
+      }
+
+      //
+      // Indexing & conversion progress display
+      //
+      ProgressBar {
+        Layout.fillWidth: true
+        visible: Cpp_CSV_Player.isIndexing || Cpp_CSV_Player.isConverting
+        value: Cpp_CSV_Player.isIndexing ? Cpp_CSV_Player.indexProgress :
+                                           Cpp_CSV_Player.conversionProgress
       }
 
       //
@@ -170,6 +231,7 @@ Window {
       //
       Slider {
         Layout.fillWidth: true
+        visible: !Cpp_CSV_Player.isIndexing && !Cpp_CSV_Player.isConverting
         value: Cpp_CSV_Player.progress
         onValueChanged: {
           if (!isNaN(value) && value !== Cpp_CSV_Player.progress)
@@ -208,6 +270,8 @@ Window {
           icon.width: 32
           icon.height: 32
           onClicked: Cpp_CSV_Player.toggle()
+          enabled: Cpp_CSV_Player.isOpen
+          opacity: enabled ? 1 : 0.5
           Layout.alignment: Qt.AlignVCenter
           icon.color: Cpp_ThemeManager.colors["button_text"]
           icon.source: (Cpp_CSV_Player.framePosition >= Cpp_CSV_Player.frameCount - 1) ?
@@ -227,6 +291,17 @@ Window {
           enabled: (Cpp_CSV_Player.framePosition < Cpp_CSV_Player.frameCount - 1) && !Cpp_CSV_Player.isPlaying
         }
       }
+
+      //
+      // Binary recording conversion
+      //
+      Button {
+        Layout.fillWidth: true
+        visible: Cpp_CSV_Player.isBinary
+        text: qsTr("Convert to CSV")
+        enabled: Cpp_CSV_Player.isOpen && !Cpp_CSV_Player.isConverting
+        onClicked: Cpp_CSV_Player.convertToCsv()
+      }
     }
   }
 }
@@ -209,6 +209,24 @@ Widgets.Pane {
         }
       }
 
+      //
+      // Binary recording format
+      //
+      CheckBox {
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        text: qsTr("Use Binary Format")
+        Layout.maximumWidth: root.maxItemWidth
+        checked: Cpp_CSV_Export.binaryFormat
+        enabled: Cpp_CSV_Export.exportEnabled
+
+        onCheckedChanged:  {
+          if (Cpp_CSV_Export.binaryFormat !== checked)
+            Cpp_CSV_Export.binaryFormat = checked
+        }
+      }
+
       //
       // Console data export
       //
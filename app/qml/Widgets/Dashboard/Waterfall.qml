@@ -0,0 +1,149 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+import SerialStudio
+
+import "../"
+
+Item {
+  id: root
+
+  //
+  // Widget data inputs
+  //
+  required property color color
+  required property var windowRoot
+  required property WaterfallWidget model
+
+  //
+  // Window flags
+  //
+  readonly property bool hasToolbar: root.width >= toolbar.implicitWidth && root.height >= 220
+
+  //
+  // Configure widget on load
+  //
+  onModelChanged: {
+    if (model) {
+      model.visible = true
+      model.parent = container
+      model.anchors.fill = container
+    }
+  }
+
+  //
+  // Add toolbar
+  //
+  RowLayout {
+    id: toolbar
+
+    spacing: 4
+    visible: root.hasToolbar
+    height: root.hasToolbar ? 48 : 0
+
+    anchors {
+      leftMargin: 8
+      top: parent.top
+      left: parent.left
+      right: parent.right
+    }
+
+    ToolButton {
+      width: 24
+      height: 24
+      icon.width: 18
+      icon.height: 18
+      checked: !model.running
+      icon.color: "transparent"
+      onClicked: model.running = !model.running
+      icon.source: model.running?
+                     "qrc:/rcc/icons/dashboard-buttons/pause.svg" :
+                     "qrc:/rcc/icons/dashboard-buttons/resume.svg"
+    }
+
+    Item {
+      Layout.fillWidth: true
+    }
+
+    Label {
+      font: Cpp_Misc_CommonFonts.customMonoFont(0.8)
+      color: Cpp_ThemeManager.colors["widget_text"]
+      text: qsTr("%1 to %2 dB").arg(model.minDB).arg(model.maxDB)
+    }
+
+    Item {
+      implicitWidth: 4
+    }
+  }
+
+  //
+  // Spectrogram
+  //
+  Item {
+    id: container
+
+    anchors {
+      margins: 8
+      left: parent.left
+      right: parent.right
+      top: toolbar.bottom
+      bottom: frequencyAxis.top
+    }
+  }
+
+  //
+  // Frequency axis labels
+  //
+  RowLayout {
+    id: frequencyAxis
+
+    anchors {
+      margins: 8
+      left: parent.left
+      right: parent.right
+      bottom: parent.bottom
+    }
+
+    Label {
+      text: qsTr("%1 Hz").arg(model.minX)
+      font: Cpp_Misc_CommonFonts.customMonoFont(0.8)
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+
+    Label {
+      Layout.fillWidth: true
+      text: qsTr("Frequency")
+      horizontalAlignment: Text.AlignHCenter
+      font: Cpp_Misc_CommonFonts.customMonoFont(0.8)
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+
+    Label {
+      text: qsTr("%1 Hz").arg(model.maxX)
+      font: Cpp_Misc_CommonFonts.customMonoFont(0.8)
+      color: Cpp_ThemeManager.colors["widget_text"]
+    }
+  }
+}
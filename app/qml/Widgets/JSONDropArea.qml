@@ -33,7 +33,7 @@ DropArea {
     // Get file name & set color of rectangle accordingly
     if (drag.urls.length > 0) {
       var path = drag.urls[0].toString()
-      if (path.endsWith(".json") || path.endsWith(".csv") || path.endsWith(".ssproj")) {
+      if (path.endsWith(".json") || path.endsWith(".csv") || path.endsWith(".ssrec") || path.endsWith(".ssproj")) {
         drag.accept(Qt.LinkAction)
         dropRectangle.color = Qt.darker(palette.highlight, 1.4)
       }
@@ -71,7 +71,7 @@ DropArea {
     }
 
     // Process CSV files
-    else if (cleanPath.endsWith(".csv"))
+    else if (cleanPath.endsWith(".csv") || cleanPath.endsWith(".ssrec"))
       Cpp_CSV_Player.openFile(cleanPath)
   }
 
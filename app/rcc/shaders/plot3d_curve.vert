@@ -0,0 +1,51 @@
+/*
+ * Serial Studio - https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru <https://aspatru.com>
+ *
+ * This file is part of the proprietary feature set of Serial Studio
+ * and is licensed under the Serial Studio Commercial License.
+ *
+ * Redistribution, modification, or use of this file in any form
+ * is permitted only under the terms of a valid commercial license
+ * obtained from the author.
+ *
+ * This file may NOT be used in any build distributed under the
+ * GNU General Public License (GPL) unless explicitly authorized
+ * by a separate commercial agreement.
+ *
+ * For license terms, see:
+ * https://github.com/Serial-Studio/Serial-Studio/blob/master/LICENSE.md
+ *
+ * SPDX-License-Identifier: LicenseRef-SerialStudio-Commercial
+ */
+
+#version 440
+
+// Vertex position in world coordinates (xyz) & ring slot of the point (w)
+layout(location = 0) in vec4 vertex;
+layout(location = 0) out vec4 color;
+
+layout(std140, binding = 0) uniform buf
+{
+  mat4 mvp;       // Item & camera transformations
+  vec4 headColor; // Color of the newest point
+  vec4 tailColor; // Color of the oldest point
+  float head;     // Ring slot of the newest point
+  float count;    // Number of points in the ring
+  float slots;    // Number of slots of the ring
+  float opacity;  // Inherited item opacity
+};
+
+void main()
+{
+  // Fade from the tail color (oldest point) to the head color (newest point),
+  // so that the vertices do not change when new points are appended
+  float age = mod(head - vertex.w + slots, slots);
+  float t = (count - 1.0 - age) / max(count, 1.0);
+  vec4 c = mix(tailColor, headColor, clamp(t, 0.0, 1.0));
+
+  // Output a premultiplied color
+  color = vec4(c.rgb * c.a, c.a) * opacity;
+  gl_Position = mvp * vec4(vertex.xyz, 1.0);
+}
@@ -30,8 +30,12 @@
 #  include "MQTT/Client.h"
 #endif
 
+#include <limits>
+#include <algorithm>
+
 #include <QDir>
 #include <QDateTime>
+#include <QFileInfo>
 
 //------------------------------------------------------------------------------
 // Constructor, destructor & singleton access functions
@@ -44,7 +48,8 @@
  * and starts a timer for periodic data export.
  */
 CSV::Export::Export()
-  : m_exportEnabled(true)
+  : m_binaryFormat(false)
+  , m_exportEnabled(true)
   , m_workerTimer(new QTimer())
 {
   // Pre-allocate memory for the write buffer
@@ -107,13 +112,13 @@ CSV::Export &CSV::Export::instance()
 //------------------------------------------------------------------------------
 
 /**
- * @brief Checks whether a CSV file is currently open.
+ * @brief Checks whether a CSV file (or binary recording) is currently open.
  *
  * @return true if file is open, false otherwise.
  */
 bool CSV::Export::isOpen() const
 {
-  return m_csvFile.isOpen();
+  return m_csvFile.isOpen() || m_recording.isOpen();
 }
 
 /**
@@ -126,6 +131,17 @@ bool CSV::Export::exportEnabled() const
   return m_exportEnabled;
 }
 
+/**
+ * @brief Checks whether frames are written to binary recordings (*.ssrec)
+ *        instead of CSV files.
+ *
+ * @return true if the binary format is used, false otherwise.
+ */
+bool CSV::Export::binaryFormat() const
+{
+  return m_binaryFormat;
+}
+
 //------------------------------------------------------------------------------
 // Public slots
 //------------------------------------------------------------------------------
@@ -133,7 +149,8 @@ bool CSV::Export::exportEnabled() const
 /**
  * @brief Closes the currently open CSV file.
  *
- * Flushes any buffered data to disk, clears headers, and resets output.
+ * Flushes any buffered data to disk, saves the row index next to the file,
+ * clears headers, and resets output.
  */
 void CSV::Export::closeFile()
 {
@@ -144,11 +161,31 @@ void CSV::Export::closeFile()
   // Write pending data to disk
   writeValues();
 
+  // Close the binary recording
+  if (m_recording.isOpen())
+  {
+    m_recording.close();
+    m_indexHeaderPairs.clear();
+    m_index.clear();
+    Q_EMIT openChanged();
+    return;
+  }
+
+  // Flush the CSV output stream
+  m_textStream.flush();
+
   // Close the file & reset the status
+  const auto path = m_csvFile.fileName();
   m_csvFile.close();
   m_indexHeaderPairs.clear();
   m_textStream.setDevice(nullptr);
 
+  // Save the row index
+  if (!m_index.save(path, QFileInfo(path).size()))
+    qWarning() << "CSV Export: Cannot write index for" << path;
+
+  m_index.clear();
+
   // Update UI
   Q_EMIT openChanged();
 }
@@ -187,6 +224,26 @@ void CSV::Export::setExportEnabled(const bool enabled)
   Q_EMIT enabledChanged();
 }
 
+/**
+ * @brief Selects between CSV files & binary recordings for the next file.
+ *
+ * The current file (if any) is closed, so that a new file with the selected
+ * format is created when the next frame is received.
+ *
+ * @param enabled True to write binary recordings, false to write CSV files.
+ */
+void CSV::Export::setBinaryFormat(const bool enabled)
+{
+  if (m_binaryFormat == enabled)
+    return;
+
+  if (isOpen())
+    closeFile();
+
+  m_binaryFormat = enabled;
+  Q_EMIT binaryFormatChanged();
+}
+
 //------------------------------------------------------------------------------
 // Hotpath data processing
 //------------------------------------------------------------------------------
@@ -201,26 +258,61 @@ void CSV::Export::setExportEnabled(const bool enabled)
  */
 void CSV::Export::hotpathTxFrame(const JSON::Frame &frame)
 {
-  // Skip if export is disabled, frame is invalid or user is playing a CSV file
-  if (!exportEnabled() || CSV::Player::instance().isOpen())
+  // Skip if frames shall not be exported
+  if (!acceptsFrames())
     return;
 
-    // Skip if not connected to a device
-#ifdef BUILD_COMMERCIAL
-  if (!IO::Manager::instance().isConnected()
-      && !(MQTT::Client::instance().isConnected()
-           && MQTT::Client::instance().isSubscriber()))
-    return;
-#else
-  if (!IO::Manager::instance().isConnected())
-    return;
-#endif
-
   // Add frame to pending frame queue
   if (!m_pendingFrames.enqueue(TimestampFrame(JSON::Frame(frame))))
     qWarning() << "CSV Export: Dropping frame (queue full)";
 }
 
+/**
+ * @brief Registers a block of numeric samples for export.
+ *
+ * The whole block is queued as a single item, so the frame structure is
+ * copied once per block instead of once per row. Every row is written as a
+ * separate CSV line, with the reception time of the block.
+ *
+ * @param frame    Frame structure used to build the CSV header.
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows in the block.
+ * @param channels Number of values per row.
+ */
+void CSV::Export::hotpathTxSamples(const JSON::Frame &frame,
+                                   const double *samples, const qsizetype rows,
+                                   const int channels)
+{
+  // Skip if frames shall not be exported
+  if (rows <= 0 || channels <= 0 || !acceptsFrames())
+    return;
+
+  // Add block to pending frame queue
+  TimestampFrame block(JSON::Frame(frame), samples, rows, channels);
+  if (!m_pendingFrames.enqueue(std::move(block)))
+    qWarning() << "CSV Export: Dropping samples (queue full)";
+}
+
+/**
+ * @brief Checks whether incoming frames shall be exported.
+ *
+ * Frames are skipped if export is disabled, if the user is playing a CSV
+ * file, or if no device (or MQTT subscription) is providing data.
+ */
+bool CSV::Export::acceptsFrames() const
+{
+  if (!exportEnabled() || CSV::Player::instance().isOpen())
+    return false;
+
+#ifdef BUILD_COMMERCIAL
+  return IO::Manager::instance().isConnected()
+         || (MQTT::Client::instance().isConnected()
+             && MQTT::Client::instance().isSubscriber());
+#else
+  return IO::Manager::instance().isConnected();
+#endif
+}
+
 //------------------------------------------------------------------------------
 // CSV data processing
 //------------------------------------------------------------------------------
@@ -257,11 +349,29 @@ void CSV::Export::writeValues()
       return;
   }
 
+  // Write every frame to the binary recording
+  if (m_recording.isOpen())
+  {
+    for (const auto &i : m_writeBuffer)
+      writeRecording(i);
+
+    m_recording.flush();
+    return;
+  }
+
   // Write every frame to the CSV file
   for (const auto &i : m_writeBuffer)
   {
+    // Write sample blocks row by row
+    if (!i.samples.empty())
+    {
+      writeSamples(i);
+      continue;
+    }
+
     // Write RX date/time
     const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+    indexRow(Index::localMSecs(i.rxDateTime));
     m_textStream << i.rxDateTime.toString(format) << QStringLiteral(",");
 
     // Obtain a set of unique dataset values (based on dataset index)
@@ -269,7 +379,12 @@ void CSV::Export::writeValues()
     for (const auto &g : i.data.groups)
     {
       for (const auto &d : g.datasets)
-        fieldValues[d.index] = d.value.simplified();
+      {
+        fieldValues[d.index] = JSON::format_value(d).simplified();
+        if (d.isNumeric && d.index >= 0
+            && d.index < static_cast<int>(m_datasetColumns.size()))
+          m_index.addValue(m_datasetColumns[d.index], d.numericValue);
+      }
     }
 
     // Write data to output stream
@@ -284,11 +399,127 @@ void CSV::Export::writeValues()
   m_textStream.flush();
 }
 
+/**
+ * @brief Writes every row of a block of samples as a CSV line.
+ *
+ * The dataset with index @c N is read from column @c N-1 of each row, which
+ * is how the datasets of the frame map to the sample columns.
+ *
+ * @param frame The timestamped sample block.
+ */
+void CSV::Export::writeSamples(const TimestampFrame &frame)
+{
+  // Obtain the sample column of each CSV column
+  const int count = m_indexHeaderPairs.count();
+  m_sampleColumns.resize(count);
+  for (int j = 0; j < count; ++j)
+  {
+    const int column = m_indexHeaderPairs[j].first - 1;
+    m_sampleColumns[j] = column < frame.channels ? column : -1;
+  }
+
+  // Write each row with the reception date/time of the block
+  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  const auto timestamp = frame.rxDateTime.toString(format);
+  const auto msecs = Index::localMSecs(frame.rxDateTime);
+  const auto rows = frame.samples.size() / frame.channels;
+  for (std::size_t r = 0; r < rows; ++r)
+  {
+    const double *row = frame.samples.data() + r * frame.channels;
+    indexRow(msecs);
+    m_textStream << timestamp << QStringLiteral(",");
+    for (int j = 0; j < count; ++j)
+    {
+      const int column = m_sampleColumns[j];
+      if (column >= 0)
+      {
+        m_index.addValue(j, row[column]);
+        m_textStream << QString::number(row[column], 'g',
+                                        QLocale::FloatingPointShortest);
+      }
+
+      m_textStream << (j < count - 1 ? "," : "\n");
+    }
+  }
+}
+
+/**
+ * @brief Appends a frame (or every row of a block of samples) to the binary
+ *        recording.
+ *
+ * Values are stored in the column of their dataset without any formatting.
+ * Datasets that are not numeric are stored as NaN.
+ *
+ * @param frame The timestamped frame or sample block.
+ */
+void CSV::Export::writeRecording(const TimestampFrame &frame)
+{
+  const int count = m_indexHeaderPairs.count();
+  const auto msecs = frame.rxDateTime.toMSecsSinceEpoch();
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  m_rowValues.resize(count);
+
+  // Write sample blocks row by row, see writeSamples()
+  if (!frame.samples.empty())
+  {
+    const auto rows = frame.samples.size() / frame.channels;
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+      const double *row = frame.samples.data() + r * frame.channels;
+      for (int j = 0; j < count; ++j)
+      {
+        const int column = m_indexHeaderPairs[j].first - 1;
+        m_rowValues[j] = column >= 0 && column < frame.channels ? row[column]
+                                                                : nan;
+      }
+
+      m_recording.appendRow(msecs, m_rowValues.data());
+    }
+
+    return;
+  }
+
+  // Place the value of each numeric dataset in its column
+  std::fill(m_rowValues.begin(), m_rowValues.end(), nan);
+  for (const auto &g : frame.data.groups)
+  {
+    for (const auto &d : g.datasets)
+    {
+      if (d.isNumeric && d.index >= 0
+          && d.index < static_cast<int>(m_datasetColumns.size())
+          && m_datasetColumns[d.index] >= 0)
+        m_rowValues[m_datasetColumns[d.index]] = d.numericValue;
+    }
+  }
+
+  m_recording.appendRow(msecs, m_rowValues.data());
+}
+
+/**
+ * @brief Registers the row that is about to be written in the row index.
+ *
+ * The output stream is flushed at the first row of each block, so that the
+ * file position matches the byte offset of the row.
+ *
+ * @param msecs Time of the row, see CSV::Index::localMSecs().
+ */
+void CSV::Export::indexRow(const qint64 msecs)
+{
+  if (m_index.startsBlock())
+  {
+    m_textStream.flush();
+    m_index.beginBlock(m_csvFile.pos(), msecs);
+  }
+
+  m_index.appendRow();
+}
+
 /**
  * @brief Creates a new CSV file and writes the header.
  *
  * Builds a sorted header based on dataset indices and opens the file
- * in the appropriate location.
+ * in the appropriate location. If binaryFormat() is enabled, a binary
+ * recording with the same columns is created instead.
  *
  * @param frame The frame used to extract header information.
  * @return List of index-title pairs for each dataset.
@@ -298,7 +529,7 @@ CSV::Export::createCsvFile(const JSON::Frame &frame)
 {
   // Get filename based on date time
   const auto dt = QDateTime::currentDateTime();
-  const auto fileName = dt.toString("yyyy-MM-dd_HH-mm-ss") + ".csv";
+  const auto baseName = dt.toString("yyyy-MM-dd_HH-mm-ss");
 
   // Get file path
   const auto subdir = Misc::WorkspaceManager::instance().path("CSV");
@@ -312,26 +543,6 @@ CSV::Export::createCsvFile(const JSON::Frame &frame)
     return {};
   }
 
-  // Open the CSV file for writting
-  m_csvFile.setFileName(dir.filePath(fileName));
-  if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text))
-  {
-    Misc::Utilities::showMessageBox(tr("CSV File Error"),
-                                    tr("Cannot open CSV file for writing!"),
-                                    QMessageBox::Critical);
-    closeFile();
-    return {};
-  }
-
-  // Configure the output stream to use the file, and set data mode to UTF-8
-  m_textStream.setDevice(&m_csvFile);
-  m_textStream.setGenerateByteOrderMark(true);
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-  m_textStream.setCodec("UTF-8");
-#else
-  m_textStream.setEncoding(QStringConverter::Utf8);
-#endif
-
   // Create a list of pairs that relate dataset indexes to header titles
   QSet<int> seenIndexes;
   QVector<QPair<int, QString>> pairs;
@@ -353,6 +564,56 @@ CSV::Export::createCsvFile(const JSON::Frame &frame)
   std::sort(pairs.begin(), pairs.end(),
             [](const auto &a, const auto &b) { return a.first < b.first; });
 
+  // Relate dataset indexes to data columns for the row index
+  m_datasetColumns.clear();
+  m_index.reset(pairs.count());
+  for (int j = 0; j < pairs.count(); ++j)
+  {
+    const int idx = pairs[j].first;
+    if (idx < 0)
+      continue;
+
+    if (idx >= static_cast<int>(m_datasetColumns.size()))
+      m_datasetColumns.resize(idx + 1, -1);
+
+    m_datasetColumns[idx] = j;
+  }
+
+  // Create a binary recording instead of a CSV file
+  if (m_binaryFormat)
+  {
+    if (!m_recording.open(dir.filePath(baseName + ".ssrec"), frame, pairs))
+    {
+      Misc::Utilities::showMessageBox(
+          tr("CSV File Error"), tr("Cannot open recording file for writing!"),
+          QMessageBox::Critical);
+      return {};
+    }
+
+    Q_EMIT openChanged();
+    return pairs;
+  }
+
+  // Open the CSV file for writting
+  m_csvFile.setFileName(dir.filePath(baseName + ".csv"));
+  if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text))
+  {
+    Misc::Utilities::showMessageBox(tr("CSV File Error"),
+                                    tr("Cannot open CSV file for writing!"),
+                                    QMessageBox::Critical);
+    closeFile();
+    return {};
+  }
+
+  // Configure the output stream to use the file, and set data mode to UTF-8
+  m_textStream.setDevice(&m_csvFile);
+  m_textStream.setGenerateByteOrderMark(true);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+  m_textStream.setCodec("UTF-8");
+#else
+  m_textStream.setEncoding(QStringConverter::Utf8);
+#endif
+
   // Write CSV header
   m_textStream << "RX Date/Time";
   for (const auto &pair : pairs)
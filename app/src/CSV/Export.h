@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QFile>
 #include <QMutex>
 #include <QTimer>
@@ -29,6 +31,8 @@
 #include <QObject>
 #include <QTextStream>
 
+#include "CSV/Index.h"
+#include "CSV/Recording.h"
 #include "JSON/Frame.h"
 #include "ThirdParty/readerwriterqueue.h"
 
@@ -40,11 +44,17 @@ namespace CSV
  * Stores a JSON frame and the associated reception timestamp (in local time).
  * Designed to be move-only for performance reasons, especially when using
  * concurrent queues.
+ *
+ * A frame may also carry a block of numeric samples, in which case @c data
+ * only provides the structure and each row of @c samples is written as a
+ * separate CSV line.
  */
 struct TimestampFrame
 {
-  JSON::Frame data;     ///< The actual data frame.
-  QDateTime rxDateTime; ///< Time at which the frame was received.
+  JSON::Frame data;            ///< The actual data frame.
+  QDateTime rxDateTime;        ///< Time at which the frame was received.
+  int channels = 0;            ///< Values per row of @c samples.
+  std::vector<double> samples; ///< Interleaved sample rows (may be empty).
 
   /**
    * @brief Default constructor.
@@ -62,6 +72,23 @@ struct TimestampFrame
   {
   }
 
+  /**
+   * @brief Constructs a timestamped block of samples with current time.
+   *
+   * @param d The frame structure (moved).
+   * @param s Interleaved samples, @p rows times @p c values.
+   * @param rows Number of rows in @p s.
+   * @param c Number of values per row.
+   */
+  TimestampFrame(JSON::Frame &&d, const double *s, const qsizetype rows,
+                 const int c)
+    : data(std::move(d))
+    , rxDateTime(QDateTime::currentDateTime())
+    , channels(c)
+    , samples(s, s + rows * c)
+  {
+  }
+
   // Disable copy constructs and use standard move assignments
   TimestampFrame(TimestampFrame &&) = default;
   TimestampFrame(const TimestampFrame &) = delete;
@@ -79,6 +106,12 @@ struct TimestampFrame
  * This class is implemented as a singleton and runs a background thread
  * to offload file I/O operations. It supports enabling/disabling export
  * dynamically and integrates with external modules (IO manager, MQTT, etc.).
+ *
+ * While recording, a CSV::Index of the rows is built and saved next to the
+ * CSV file when it is closed, so that CSV::Player does not need to scan it.
+ *
+ * If binaryFormat() is enabled, frames are written to a CSV::Recording
+ * instead, which stores the numeric values without formatting any text.
  */
 class Export : public QObject
 {
@@ -91,11 +124,16 @@ class Export : public QObject
              READ exportEnabled
              WRITE setExportEnabled
              NOTIFY enabledChanged)
+  Q_PROPERTY(bool binaryFormat
+             READ binaryFormat
+             WRITE setBinaryFormat
+             NOTIFY binaryFormatChanged)
   // clang-format on
 
 signals:
   void openChanged();
   void enabledChanged();
+  void binaryFormatChanged();
 
 private:
   explicit Export();
@@ -111,27 +149,41 @@ public:
 
   [[nodiscard]] bool isOpen() const;
   [[nodiscard]] bool exportEnabled() const;
+  [[nodiscard]] bool binaryFormat() const;
 
 public slots:
   void closeFile();
   void setupExternalConnections();
   void setExportEnabled(const bool enabled);
+  void setBinaryFormat(const bool enabled);
 
   void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxSamples(const JSON::Frame &frame, const double *samples,
+                        const qsizetype rows, const int channels);
 
 private slots:
   void writeValues();
 
 private:
+  bool acceptsFrames() const;
+  void indexRow(const qint64 msecs);
+  void writeSamples(const TimestampFrame &frame);
+  void writeRecording(const TimestampFrame &frame);
   QVector<QPair<int, QString>> createCsvFile(const JSON::Frame &frame);
 
 private:
+  Index m_index;
   QFile m_csvFile;
   QMutex m_queueLock;
+  bool m_binaryFormat;
   bool m_exportEnabled;
   QTimer *m_workerTimer;
   QThread m_workerThread;
+  Recording m_recording;
   QTextStream m_textStream;
+  std::vector<double> m_rowValues;
+  std::vector<int> m_sampleColumns;
+  std::vector<int> m_datasetColumns;
   std::vector<TimestampFrame> m_writeBuffer;
   QVector<QPair<int, QString>> m_indexHeaderPairs;
   moodycamel::ReaderWriterQueue<TimestampFrame> m_pendingFrames{8128};
@@ -0,0 +1,320 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <limits>
+
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+
+#include "CSV/Index.h"
+
+//------------------------------------------------------------------------------
+// Sidecar file layout
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Identifies index files ("SSIX"), followed by the format version.
+ *
+ * The file is little-endian and laid out as:
+ * - magic (u32), version (u32)
+ * - size of the indexed CSV file in bytes (i64), number of rows (i64)
+ * - rows per block (i32), number of data columns (i32), number of blocks (i64)
+ * - for each block: offset (i64), time (i64), then the minimum & maximum
+ *   (f64) of each data column
+ */
+static constexpr quint32 kMagic = 0x58495353;
+static constexpr quint32 kVersion = 1;
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty index.
+ */
+CSV::Index::Index()
+  : m_rows(0)
+  , m_columns(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Member access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of rows registered in the index.
+ */
+qint64 CSV::Index::rows() const
+{
+  return m_rows;
+}
+
+/**
+ * @brief Returns the number of data columns with range information.
+ */
+int CSV::Index::columns() const
+{
+  return m_columns;
+}
+
+/**
+ * @brief Returns the number of blocks in the index.
+ */
+qsizetype CSV::Index::blocks() const
+{
+  return static_cast<qsizetype>(m_offsets.size());
+}
+
+/**
+ * @brief Returns @c true if the next row is the first row of a new block, in
+ *        which case beginBlock() must be called before appendRow().
+ */
+bool CSV::Index::startsBlock() const
+{
+  return m_rows % kBlockRows == 0;
+}
+
+/**
+ * @brief Returns the time of the first row of @a block.
+ */
+qint64 CSV::Index::blockTime(const qsizetype block) const
+{
+  return m_times[block];
+}
+
+/**
+ * @brief Returns the byte offset of the first row of @a block.
+ */
+qint64 CSV::Index::blockOffset(const qsizetype block) const
+{
+  return m_offsets[block];
+}
+
+/**
+ * @brief Obtains the range of a data column over the blocks in
+ *        [@a first, @a last].
+ *
+ * @return @c false if the column has no range information or no numeric
+ *         values in the given blocks.
+ */
+bool CSV::Index::extrema(const int column, const qsizetype first,
+                         const qsizetype last, double &min, double &max) const
+{
+  if (column < 0 || column >= m_columns)
+    return false;
+
+  min = std::numeric_limits<double>::infinity();
+  max = -std::numeric_limits<double>::infinity();
+  for (auto b = qMax<qsizetype>(0, first); b <= last && b < blocks(); ++b)
+  {
+    const auto i = static_cast<std::size_t>(b) * m_columns + column;
+    min = qMin(min, m_minimum[i]);
+    max = qMax(max, m_maximum[i]);
+  }
+
+  return min <= max;
+}
+
+//------------------------------------------------------------------------------
+// Index construction
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Removes all blocks & column ranges from the index.
+ */
+void CSV::Index::clear()
+{
+  reset(0);
+  m_times.shrink_to_fit();
+  m_offsets.shrink_to_fit();
+  m_minimum.shrink_to_fit();
+  m_maximum.shrink_to_fit();
+}
+
+/**
+ * @brief Registers a row in the current block.
+ */
+void CSV::Index::appendRow()
+{
+  ++m_rows;
+}
+
+/**
+ * @brief Empties the index and sets the number of data columns whose range
+ *        is tracked with addValue().
+ */
+void CSV::Index::reset(const int columns)
+{
+  m_rows = 0;
+  m_columns = qMax(0, columns);
+  m_times.clear();
+  m_offsets.clear();
+  m_minimum.clear();
+  m_maximum.clear();
+}
+
+/**
+ * @brief Extends the range of @a column in the current block with @a value.
+ */
+void CSV::Index::addValue(const int column, const double value)
+{
+  if (column < 0 || column >= m_columns || m_offsets.empty())
+    return;
+
+  const auto i = (m_offsets.size() - 1) * m_columns + column;
+  if (value < m_minimum[i])
+    m_minimum[i] = value;
+  if (value > m_maximum[i])
+    m_maximum[i] = value;
+}
+
+/**
+ * @brief Starts a new block whose first row is at byte @a offset and was
+ *        recorded at @a msecs.
+ */
+void CSV::Index::beginBlock(const qint64 offset, const qint64 msecs)
+{
+  m_times.push_back(msecs);
+  m_offsets.push_back(offset);
+  m_minimum.insert(m_minimum.end(), m_columns,
+                   std::numeric_limits<double>::infinity());
+  m_maximum.insert(m_maximum.end(), m_columns,
+                   -std::numeric_limits<double>::infinity());
+}
+
+//------------------------------------------------------------------------------
+// Sidecar file access
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Loads the sidecar index of the CSV file at @a csvPath.
+ *
+ * The index is rejected if it was written for a file of a different size,
+ * e.g. because the recording was interrupted or edited afterwards.
+ *
+ * @return @c true if a valid index was loaded.
+ */
+bool CSV::Index::load(const QString &csvPath, const qint64 csvSize)
+{
+  reset(0);
+
+  QFile file(sidecarPath(csvPath));
+  if (!file.open(QIODevice::ReadOnly))
+    return false;
+
+  QDataStream in(&file);
+  in.setByteOrder(QDataStream::LittleEndian);
+  in.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+  // Validate the header
+  quint32 magic, version;
+  qint32 blockRows, columns;
+  qint64 size, rows, blocks;
+  in >> magic >> version >> size >> rows >> blockRows >> columns >> blocks;
+  if (in.status() != QDataStream::Ok || magic != kMagic || version != kVersion
+      || size != csvSize || blockRows != kBlockRows || columns < 0 || rows < 0
+      || blocks != (rows + kBlockRows - 1) / kBlockRows)
+    return false;
+
+  // Validate the file size before allocating the blocks
+  const qint64 blockSize = 16 + 16 * static_cast<qint64>(columns);
+  if (file.size() - file.pos() != blocks * blockSize)
+    return false;
+
+  // Read the blocks
+  reset(columns);
+  for (qint64 b = 0; b < blocks; ++b)
+  {
+    qint64 offset, msecs;
+    in >> offset >> msecs;
+    if (offset < 0 || offset >= csvSize
+        || (!m_offsets.empty() && offset <= m_offsets.back()))
+    {
+      reset(0);
+      return false;
+    }
+
+    beginBlock(offset, msecs);
+    const auto i = m_minimum.size() - m_columns;
+    for (int c = 0; c < m_columns; ++c)
+      in >> m_minimum[i + c] >> m_maximum[i + c];
+  }
+
+  // Check for read errors
+  if (in.status() != QDataStream::Ok)
+  {
+    reset(0);
+    return false;
+  }
+
+  m_rows = rows;
+  return true;
+}
+
+/**
+ * @brief Writes the index next to the CSV file at @a csvPath, which has a
+ *        size of @a csvSize bytes.
+ */
+bool CSV::Index::save(const QString &csvPath, const qint64 csvSize) const
+{
+  QSaveFile file(sidecarPath(csvPath));
+  if (!file.open(QIODevice::WriteOnly))
+    return false;
+
+  QDataStream out(&file);
+  out.setByteOrder(QDataStream::LittleEndian);
+  out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+  out << kMagic << kVersion << csvSize << m_rows
+      << static_cast<qint32>(kBlockRows) << static_cast<qint32>(m_columns)
+      << static_cast<qint64>(blocks());
+
+  for (std::size_t b = 0; b < m_offsets.size(); ++b)
+  {
+    out << m_offsets[b] << m_times[b];
+    for (int c = 0; c < m_columns; ++c)
+      out << m_minimum[b * m_columns + c] << m_maximum[b * m_columns + c];
+  }
+
+  return out.status() == QDataStream::Ok && file.commit();
+}
+
+/**
+ * @brief Returns the path of the sidecar index of a CSV file.
+ */
+QString CSV::Index::sidecarPath(const QString &csvPath)
+{
+  return csvPath + QStringLiteral(".idx");
+}
+
+/**
+ * @brief Returns the number of milliseconds between 1970-01-01 and the local
+ *        date/time of @a dateTime, ignoring its time zone.
+ *
+ * This is the time scale of the timestamps parsed from the RX date/time
+ * column of CSV files, which do not record a time zone.
+ */
+qint64 CSV::Index::localMSecs(const QDateTime &dateTime)
+{
+  return dateTime.toMSecsSinceEpoch() + dateTime.offsetFromUtc() * 1000LL;
+}
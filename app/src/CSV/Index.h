@@ -0,0 +1,85 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <QString>
+#include <QDateTime>
+
+namespace CSV
+{
+/**
+ * @class CSV::Index
+ * @brief Sparse row index of a CSV recording.
+ *
+ * Rows are grouped in blocks of kBlockRows rows. For every block, the index
+ * stores the byte offset and the time (see localMSecs()) of its first row,
+ * together with the minimum & maximum value of each data column within the
+ * block. Locating any row takes one lookup plus a scan of less than
+ * kBlockRows rows, and the range of a column over any span of blocks is
+ * obtained without touching the CSV file.
+ *
+ * CSV::Export builds the index while recording and saves it next to the CSV
+ * file (see sidecarPath()) when the recording is closed. CSV::Player loads it
+ * when present, and otherwise builds one without column ranges by scanning
+ * the file.
+ */
+class Index
+{
+public:
+  static constexpr qint64 kBlockRows = 256;
+
+  Index();
+
+  [[nodiscard]] qint64 rows() const;
+  [[nodiscard]] int columns() const;
+  [[nodiscard]] qsizetype blocks() const;
+  [[nodiscard]] bool startsBlock() const;
+
+  [[nodiscard]] qint64 blockTime(const qsizetype block) const;
+  [[nodiscard]] qint64 blockOffset(const qsizetype block) const;
+  [[nodiscard]] bool extrema(const int column, const qsizetype first,
+                             const qsizetype last, double &min,
+                             double &max) const;
+
+  void clear();
+  void appendRow();
+  void reset(const int columns);
+  void addValue(const int column, const double value);
+  void beginBlock(const qint64 offset, const qint64 msecs);
+
+  bool load(const QString &csvPath, const qint64 csvSize);
+  bool save(const QString &csvPath, const qint64 csvSize) const;
+
+  [[nodiscard]] static QString sidecarPath(const QString &csvPath);
+  [[nodiscard]] static qint64 localMSecs(const QDateTime &dateTime);
+
+private:
+  qint64 m_rows;
+  int m_columns;
+  std::vector<qint64> m_times;
+  std::vector<qint64> m_offsets;
+  std::vector<double> m_minimum;
+  std::vector<double> m_maximum;
+};
+} // namespace CSV
@@ -21,17 +21,237 @@
 
 #include "Player.h"
 
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include <QDir>
 #include <QtMath>
-#include <QTimer>
+#include <QLocale>
+#include <QFileInfo>
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QApplication>
 
 #include "IO/Manager.h"
+#include "JSON/Frame.h"
+#include "JSON/FrameBuilder.h"
 #include "UI/Dashboard.h"
 #include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
 #include "Misc/WorkspaceManager.h"
 
+//------------------------------------------------------------------------------
+// Playback constants & row parsing helpers
+//------------------------------------------------------------------------------
+
+namespace
+{
+/**
+ * @brief Range of playback speeds, a speed of 0 plays as fast as possible.
+ */
+constexpr double kMinSpeed = 0.1;
+constexpr double kMaxSpeed = 100;
+
+/**
+ * @brief Maximum number of rows delivered in a single UI tick.
+ */
+constexpr int kMaxBatchRows = 8192;
+
+/**
+ * @brief Returns @c true if @a c is a whitespace character.
+ */
+constexpr bool isSpace(const char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/**
+ * @brief Removes surrounding whitespace & quotes from the cell
+ *        [@a begin, @a end).
+ */
+void trimCell(const char *&begin, const char *&end)
+{
+  while (begin < end && isSpace(*begin))
+    ++begin;
+  while (end > begin && isSpace(end[-1]))
+    --end;
+
+  if (begin < end && *begin == '"')
+    ++begin;
+  if (end > begin && end[-1] == '"')
+    --end;
+
+  while (begin < end && isSpace(*begin))
+    ++begin;
+  while (end > begin && isSpace(end[-1]))
+    --end;
+}
+
+/**
+ * @brief Returns @c true if the row [@a begin, @a end) only contains empty
+ *        cells (separators, quotes and whitespace).
+ */
+bool isBlankRow(const char *begin, const char *end)
+{
+  for (auto *p = begin; p < end; ++p)
+  {
+    if (*p != ',' && *p != '"' && !isSpace(*p))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Locates the cell at @a column within the row [@a begin, @a end).
+ *
+ * @return @c false if the row does not have enough cells.
+ */
+bool findCell(const char *begin, const char *end, const int column,
+              const char *&cellBegin, const char *&cellEnd)
+{
+  auto *p = begin;
+  for (int i = 0; i < column; ++i)
+  {
+    p = static_cast<const char *>(std::memchr(p, ',', end - p));
+    if (!p)
+      return false;
+
+    ++p;
+  }
+
+  auto *separator = static_cast<const char *>(std::memchr(p, ',', end - p));
+  cellBegin = p;
+  cellEnd = separator ? separator : end;
+  trimCell(cellBegin, cellEnd);
+  return true;
+}
+
+/**
+ * @brief Calls @a func with the bounds of each trimmed cell of the row
+ *        [@a begin, @a end).
+ */
+template<typename Function>
+void forEachCell(const char *begin, const char *end, Function &&func)
+{
+  while (true)
+  {
+    auto *cellBegin = begin;
+    auto *cellEnd = static_cast<const char *>(
+        std::memchr(begin, ',', end - begin));
+    const bool last = !cellEnd;
+    if (last)
+      cellEnd = end;
+
+    begin = cellEnd + 1;
+    trimCell(cellBegin, cellEnd);
+    func(cellBegin, cellEnd);
+
+    if (last)
+      break;
+  }
+}
+
+/**
+ * @brief Reads an unsigned integer of up to @a digits digits.
+ */
+bool readInt(const char *&p, const char *end, const int digits, int &value)
+{
+  int count = 0;
+  value = 0;
+  while (p < end && count < digits && *p >= '0' && *p <= '9')
+  {
+    value = value * 10 + (*p - '0');
+    ++count;
+    ++p;
+  }
+
+  return count > 0;
+}
+
+/**
+ * @brief Consumes the character @a c.
+ */
+bool expect(const char *&p, const char *end, const char c)
+{
+  if (p < end && *p == c)
+  {
+    ++p;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Returns the number of days between 1970-01-01 and the given date of
+ *        the proleptic Gregorian calendar.
+ */
+constexpr qint64 daysFromCivil(int year, const int month, const int day)
+{
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int yoe = year - era * 400;
+  const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097LL + doe - 719468;
+}
+
+/**
+ * @brief Parses a timestamp written by CSV::Export.
+ *
+ * Accepts the "yyyy/MM/dd HH:mm:ss::zzz", "yyyy/MM/dd/ HH:mm:ss::zzz",
+ * "yyyy/MM/dd HH:mm:ss" and "yyyy/MM/dd/ HH:mm:ss" formats without going
+ * through QDateTime, which is far too slow to run on every row of a large
+ * file.
+ *
+ * The result is the number of milliseconds since 1970-01-01 in the time zone
+ * of the recording. It is only used to obtain the interval between rows, so no
+ * time zone conversion is done.
+ */
+bool parseTimestamp(const char *p, const char *end, qint64 &msecs)
+{
+  int year, month, day, hour, minute, second;
+  if (!readInt(p, end, 4, year) || !expect(p, end, '/')
+      || !readInt(p, end, 2, month) || !expect(p, end, '/')
+      || !readInt(p, end, 2, day))
+    return false;
+
+  expect(p, end, '/');
+  if (!expect(p, end, ' '))
+    return false;
+
+  while (expect(p, end, ' '))
+    ;
+
+  if (!readInt(p, end, 2, hour) || !expect(p, end, ':')
+      || !readInt(p, end, 2, minute) || !expect(p, end, ':')
+      || !readInt(p, end, 2, second))
+    return false;
+
+  int millis = 0;
+  if (p != end
+      && (!expect(p, end, ':') || !expect(p, end, ':')
+          || !readInt(p, end, 3, millis)))
+    return false;
+
+  if (p != end || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23
+      || minute > 59 || second > 59)
+    return false;
+
+  const qint64 days = daysFromCivil(year, month, day);
+  msecs = (((days * 24 + hour) * 60 + minute) * 60 + second) * 1000 + millis;
+  return true;
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor/deconstructor & singleton access
+//------------------------------------------------------------------------------
+
 /**
  * Constructor function
  */
@@ -39,10 +259,37 @@ CSV::Player::Player()
   : m_framePos(0)
   , m_playing(false)
   , m_timestamp("")
+  , m_speed(1)
+  , m_clockOrigin(0)
+  , m_map(nullptr)
+  , m_size(0)
+  , m_timeColumn(0)
+  , m_interval(0)
+  , m_indexSession(0)
+  , m_indexProgress(0)
+  , m_indexThread(nullptr)
+  , m_abortIndex(false)
+  , m_convertSession(0)
+  , m_convertProgress(0)
+  , m_convertThread(nullptr)
+  , m_abortConvert(false)
+  , m_cursorRow(-1)
+  , m_cursorOffset(0)
 {
   qApp->installEventFilter(this);
   connect(this, &CSV::Player::playerStateChanged, this,
           &CSV::Player::updateData);
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::uiTimeout, this,
+          &CSV::Player::playFrames);
+}
+
+/**
+ * Stops the indexing & conversion threads before the mapped file is released
+ */
+CSV::Player::~Player()
+{
+  stopIndexing();
+  stopConversion();
 }
 
 /**
@@ -54,12 +301,24 @@ CSV::Player &CSV::Player::instance()
   return singleton;
 }
 
+//------------------------------------------------------------------------------
+// Member access functions
+//------------------------------------------------------------------------------
+
 /**
- * Returns @c true if an CSV file is open for reading
+ * Returns @c true if an CSV file is open for reading and its index is ready
  */
 bool CSV::Player::isOpen() const
 {
-  return m_csvFile.isOpen();
+  return m_csvFile.isOpen() && !isIndexing();
+}
+
+/**
+ * Returns @c true if the open file is a binary recording instead of a CSV file
+ */
+bool CSV::Player::isBinary() const
+{
+  return m_recording.isLoaded();
 }
 
 /**
@@ -80,13 +339,62 @@ bool CSV::Player::isPlaying() const
 }
 
 /**
- * Returns the total number of frames in the CSV file. This can be calculated
- * by getting the number of rows of the CSV and substracting 1 (because the
- * title cells do not count as a valid frame).
+ * Returns the playback speed relative to the speed at which the CSV file was
+ * recorded, or 0 if frames are replayed as fast as possible.
+ */
+double CSV::Player::speed() const
+{
+  return m_speed;
+}
+
+/**
+ * Returns @c true while the rows of the CSV file are being indexed in the
+ * background.
+ */
+bool CSV::Player::isIndexing() const
+{
+  return m_indexThread != nullptr;
+}
+
+/**
+ * Returns the progress of the row indexing in a range from 0.0 to 1.0
+ */
+double CSV::Player::indexProgress() const
+{
+  return m_indexProgress;
+}
+
+/**
+ * Returns @c true while the binary recording is being converted to a CSV file
+ * in the background.
+ */
+bool CSV::Player::isConverting() const
+{
+  return m_convertThread != nullptr;
+}
+
+/**
+ * Returns the progress of the CSV conversion in a range from 0.0 to 1.0
+ */
+double CSV::Player::conversionProgress() const
+{
+  return m_convertProgress;
+}
+
+/**
+ * Returns the total number of frames in the CSV file, which is the number of
+ * non-empty rows after the title row. The index is owned by the indexing
+ * thread until it finishes, so no frames are reported until then.
  */
 int CSV::Player::frameCount() const
 {
-  return m_csvData.count();
+  if (isIndexing())
+    return 0;
+
+  if (m_recording.isLoaded())
+    return static_cast<int>(m_recording.rows());
+
+  return static_cast<int>(m_index.rows());
 }
 
 /**
@@ -120,9 +428,13 @@ const QString &CSV::Player::timestamp() const
   return m_timestamp;
 }
 
+//------------------------------------------------------------------------------
+// Public slots
+//------------------------------------------------------------------------------
+
 /**
- * Enables CSV playback at 'live' speed (as it happened when CSV file was
- * saved to the computer).
+ * Enables CSV playback at the selected speed, relative to the speed at which
+ * the CSV file was saved to the computer.
  */
 void CSV::Player::play()
 {
@@ -130,6 +442,7 @@ void CSV::Player::play()
     m_framePos = 0;
 
   m_playing = true;
+  restartClock();
   Q_EMIT playerStateChanged();
 }
 
@@ -159,9 +472,11 @@ void CSV::Player::toggle()
  */
 void CSV::Player::openFile()
 {
-  auto *dialog = new QFileDialog(nullptr, tr("Select CSV file"),
-                                 Misc::WorkspaceManager::instance().path("CSV"),
-                                 tr("CSV files (*.csv)"));
+  auto *dialog = new QFileDialog(
+      nullptr, tr("Select CSV file"),
+      Misc::WorkspaceManager::instance().path("CSV"),
+      tr("CSV files & recordings (*.csv *.ssrec);;CSV files (*.csv);;"
+         "Binary recordings (*.ssrec)"));
 
   dialog->setFileMode(QFileDialog::ExistingFile);
   dialog->setOption(QFileDialog::DontUseNativeDialog);
@@ -183,41 +498,48 @@ void CSV::Player::openFile()
  */
 void CSV::Player::closeFile()
 {
+  stopIndexing();
+  stopConversion();
+  m_recording.unload();
+
+  if (m_map)
+    m_csvFile.unmap(m_map);
+
+  m_map = nullptr;
+  m_size = 0;
   m_framePos = 0;
   m_csvFile.close();
-  m_csvData.clear();
-  m_csvData.squeeze();
   m_playing = false;
+  m_indexProgress = 0;
+  m_convertProgress = 0;
+  m_cursorRow = -1;
+  m_cursorOffset = 0;
   m_timestamp = "--.--";
+  m_index.clear();
 
   Q_EMIT openChanged();
+  Q_EMIT indexingChanged();
   Q_EMIT timestampChanged();
+  Q_EMIT convertingChanged();
   Q_EMIT playerStateChanged();
+  Q_EMIT indexProgressChanged();
+  Q_EMIT conversionProgressChanged();
 }
 
 /**
  * @brief Reads & processes the next CSV row, capped at the last row.
  *
  * Moves the frame position forward by one, up to the last frame in the CSV.
- * Resets and repopulates the dashboard with the appropriate frames for
- * synchronized display.
+ * The dashboard already holds the history up to the current frame, so only
+ * the new frame needs to be processed.
  */
 void CSV::Player::nextFrame()
 {
   if (framePosition() < frameCount() - 1)
   {
-    // Increase the frame position
     ++m_framePos;
-
-    // Populate the dashboard with a range of frames up to the new position
-    UI::Dashboard::instance().resetData(false);
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    for (int i = startFrame; i <= m_framePos; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
-
-    // Keep timestamp and data in sync
     updateData();
+    restartClock();
   }
 }
 
@@ -225,44 +547,99 @@ void CSV::Player::nextFrame()
  * @brief Reads & processes the previous CSV row, capped at the first row.
  *
  * Moves the frame position backward by one, down to the first frame in the CSV.
- * Resets and repopulates the dashboard with the appropriate frames for
- * synchronized display.
+ * Repopulates the dashboard with the appropriate frames for synchronized
+ * display.
  */
 void CSV::Player::previousFrame()
 {
   if (framePosition() > 0)
-  {
-    // Decrease the frame position
-    --m_framePos;
+    seek(framePosition() - 1);
+}
 
-    // Populate the dashboard with a range of frames up to the new position
-    UI::Dashboard::instance().resetData(false);
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    for (int i = startFrame; i <= m_framePos; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
+/**
+ * @brief Converts the open binary recording into a CSV file.
+ *
+ * The CSV file is written next to the recording, with the same name, so that
+ * the data can be used by other tools. Its row index is written as well, so
+ * the CSV file can also be replayed without scanning it. If the CSV file
+ * already exists, the user is asked before it is replaced.
+ *
+ * The conversion runs on a background thread, reporting its progress through
+ * conversionProgress(). The result is reported by finishConversion().
+ */
+void CSV::Player::convertToCsv()
+{
+  if (!isBinary() || isConverting())
+    return;
 
-    // Keep timestamp and data in sync
-    updateData();
+  // Pause playback during the conversion
+  if (isPlaying())
+    pause();
+
+  // Ask before replacing an existing CSV file
+  const QFileInfo info(m_csvFile.fileName());
+  const auto path = info.dir().filePath(info.completeBaseName() + ".csv");
+  if (QFileInfo::exists(path))
+  {
+    const auto ret = Misc::Utilities::showMessageBox(
+        tr("\"%1\" already exists").arg(QFileInfo(path).fileName()),
+        tr("Do you want to replace it?"), QMessageBox::Question, qAppName(),
+        QMessageBox::Yes | QMessageBox::No);
+    if (ret != QMessageBox::Yes)
+      return;
   }
+
+  // Write the CSV file in the background
+  m_abortConvert = false;
+  m_convertProgress = 0;
+  const auto session = ++m_convertSession;
+  m_convertThread = QThread::create([this, path, session] {
+    const auto progress = [this, session](const int percent) {
+      QMetaObject::invokeMethod(
+          this,
+          [this, percent, session] {
+            if (session == m_convertSession)
+            {
+              m_convertProgress = percent / 100.0;
+              Q_EMIT conversionProgressChanged();
+            }
+          },
+          Qt::QueuedConnection);
+
+      return !m_abortConvert.load(std::memory_order_relaxed);
+    };
+
+    const bool converted = m_recording.convertToCsv(path, progress);
+    QMetaObject::invokeMethod(
+        this,
+        [this, session, converted, path] {
+          finishConversion(session, converted, path);
+        },
+        Qt::QueuedConnection);
+  });
+  m_convertThread->start();
+
+  // Update user interface
+  Q_EMIT convertingChanged();
+  Q_EMIT conversionProgressChanged();
 }
 
 /**
- * @brief Opens a CSV file, processes its data, and prepares it for playback.
+ * @brief Opens a CSV file and starts indexing its rows for playback.
  *
  * This function attempts to open the specified CSV file for reading and
  * processes the data for replaying. It checks if a device is isConnected and,
  * if so, asks the user to disconnect it.
  *
- * The function reads the CSV file into a string matrix (`m_csvData`), validates
- * the date/time format of the first column, and if necessary, prompts the user
- * to either select a valid date/time column or manually set an interval between
- * rows.
+ * The file is memory-mapped. If CSV::Export left a valid index next to the
+ * file, playback begins immediately.
  *
- * Once the date/time column is validated, the function sorts the rows in
- * `m_csvData` based on the date/time in the first column. After sorting, it
- * signals the UI to update and starts playback of the first frame of the CSV
- * data.
+ * Otherwise, only the title row and the first data row are parsed here to
+ * validate the date/time format of the first column. If necessary, the user
+ * is prompted to either select a valid date/time column or manually set an
+ * interval between rows. The remaining rows are indexed by a background
+ * thread, see indexRows(). The file is reported as open once the index is
+ * complete.
  *
  * If the file cannot be opened or an error occurs (e.g., invalid CSV data), the
  * function displays an appropriate error message and aborts further processing.
@@ -292,76 +669,118 @@ void CSV::Player::openFile(const QString &filePath)
       return;
   }
 
-  // Try to open the current file
+  // Try to open & map the current file
   m_csvFile.setFileName(filePath);
   if (m_csvFile.open(QIODevice::ReadOnly))
   {
-    // Read CSV file into string matrix
-    QTextStream in(&m_csvFile);
-    while (!in.atEnd())
-    {
-      // Read a line and split it into a list of items
-      QStringList row = in.readLine().split(',');
-
-      // Remove surrounding quotes and trim whitespace from each item
-      for (auto &item : row)
-      {
-        item = item.simplified();
-        item.remove(QStringLiteral("\""));
-      }
-
-      // Filter out rows that are empty or contain only empty items
-      bool isRowValid
-          = !row.isEmpty()
-            && std::any_of(row.cbegin(), row.cend(),
-                           [](const QString &item) { return !item.isEmpty(); });
+    m_size = m_csvFile.size();
+    if (m_size > 0)
+      m_map = m_csvFile.map(0, m_size);
+  }
 
-      // Only register valid rows
-      if (isRowValid)
-        m_csvData.append(row);
-    }
+  // Open error
+  if (!m_map)
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Cannot read CSV file"),
+        tr("Please check file permissions & location"), QMessageBox::Critical);
+    closeFile();
+    return;
+  }
 
-    // Validate the cell at (1,1) for date/time format
-    if (!getDateTime(1).isValid())
+  // Replay binary recordings directly, they need no index
+  m_interval = 0;
+  m_timeColumn = 0;
+  if (Recording::isRecording(filePath))
+  {
+    if (!m_recording.load(m_map, m_size))
     {
-      // Ask user to select date/time column or set interval manually
-      if (!promptUserForDateTimeOrInterval())
-      {
-        closeFile();
-        return;
-      }
+      Misc::Utilities::showMessageBox(
+          tr("Invalid Recording"),
+          tr("The file is not a valid Serial Studio recording."),
+          QMessageBox::Critical);
+      closeFile();
+      return;
     }
 
-    // Remove the header row from the data
-    m_framePos = 0;
-    m_csvData.removeFirst();
+    beginPlayback();
+    return;
+  }
 
-    // Begin reading data
-    if (m_csvData.count() >= 2)
+  // Use the index written while recording the file
+  if (m_index.load(filePath, m_size))
+  {
+    beginPlayback();
+    return;
+  }
+
+  // Locate the title row (skipping the UTF-8 BOM) & the first data row
+  const bool bom = m_size >= 3 && std::memcmp(m_map, "\xEF\xBB\xBF", 3) == 0;
+  const auto header = nextRow(bom ? 3 : 0);
+  const auto first = header < 0 ? -1 : nextRow(rowEnd(header) + 1);
+  if (first < 0)
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Insufficient Data in CSV File"),
+        tr("The CSV file must contain at least two frames (data rows) to "
+           "proceed. Please check the file and try again."),
+        QMessageBox::Critical);
+    closeFile();
+    return;
+  }
+
+  // Validate the first cell of the first data row for date/time format
+  qint64 msecs = 0;
+  if (!rowTime(first, msecs))
+  {
+    // Ask user to select date/time column or set interval manually
+    if (!promptUserForDateTimeOrInterval(header))
     {
-      updateData();
-      Q_EMIT openChanged();
+      closeFile();
+      return;
     }
 
-    // Handle case where CSV file does not contain at least two frames
-    else
+    // Validate the selected date/time column
+    if (m_timeColumn >= 0 && !rowTime(first, msecs))
     {
       Misc::Utilities::showMessageBox(
-          tr("Insufficient Data in CSV File"),
-          tr("The CSV file must contain at least two frames (data rows) to "
-             "proceed. Please check the file and try again."),
+          tr("Invalid Selection"),
+          tr("The selected column does not contain date/time data."),
           QMessageBox::Critical);
       closeFile();
+      return;
     }
   }
 
-  // Open error
-  else
+  // Index the data rows in the background
+  m_abortIndex = false;
+  m_indexProgress = 0;
+  const auto session = ++m_indexSession;
+  m_indexThread = QThread::create(
+      [this, first, msecs, session] { indexRows(first, msecs, session); });
+  m_indexThread->start();
+
+  // Update user interface
+  Q_EMIT indexingChanged();
+  Q_EMIT indexProgressChanged();
+}
+
+/**
+ * @brief Changes the playback speed.
+ *
+ * The speed is clamped to a range of 0.1x to 100x of the recording speed. A
+ * speed of 0 (or less) replays the frames as fast as possible.
+ *
+ * @param speed Playback speed relative to the recording speed.
+ */
+void CSV::Player::setSpeed(const double speed)
+{
+  const auto value = speed <= 0 ? 0 : std::clamp(speed, kMinSpeed, kMaxSpeed);
+  if (!qFuzzyCompare(m_speed, value))
   {
-    Misc::Utilities::showMessageBox(
-        tr("Cannot read CSV file"),
-        tr("Please check file permissions & location"), QMessageBox::Critical);
-    closeFile();
+    m_speed = value;
+    restartClock();
+    Q_EMIT speedChanged();
   }
 }
 
@@ -373,32 +792,11 @@ void CSV::Player::openFile(const QString &filePath)
  * file, where the position is defined by a normalized progress value between
  * 0 and 1. A value of 0 represents the start of the CSV file, and 1 represents
  * the end. When the new position differs from the current playback position,
- * this function processes the update by resetting and reloading the necessary
- * frames.
- *
- * If moving backward, the dashboard plots are reset silently and reloaded with
- * frames in the range leading up to the new position, effectively simulating a
- * rewind effect. For forward movement, the function caps the frame range to
- * prevent overshooting the end of the CSV.
- *
- * - **Backward Movement**: The dashboard is reset, and frames are reloaded from
- *   a range capped by the current position back to `UI::Dashboard::points()`
- *   frames earlier, or the start of the CSV, whichever comes first.
- * - **Forward Movement**: The dashboard is similarly reset, and frames are
- *   reloaded up to the new position, but capped to prevent going beyond the
- *   end of the CSV file.
+ * the dashboard plots are rebuilt with the frames leading up to the new
+ * position, see seek().
  *
  * @param progress A normalized value between 0.0 and 1.0 representing the
  *                 desired position in the CSV file.
- *
- * This function ensures that:
- * - The playback position does not exceed the CSV boundaries.
- * - Plot data accurately reflects the new position on both forward and
- *   backward movements.
- * - Timestamp tracking remains synchronized with the current playback position.
- *
- * @note A silent reset is performed to refresh the dashboard plots without
- *       emitting unnecessary signals.
  */
 void CSV::Player::setProgress(const double progress)
 {
@@ -414,89 +812,386 @@ void CSV::Player::setProgress(const double progress)
 
   // Only process if position changes
   if (newFramePos != m_framePos)
-  {
-    // Update frame position and reset dashboard data silently
-    m_framePos = newFramePos;
-    UI::Dashboard::instance().resetData(false);
-
-    // Calculate frames to load around the new frame position
-    int framesToLoad = UI::Dashboard::instance().points();
-    int startFrame = std::max(1, m_framePos - framesToLoad);
-    int endFrame = std::min(frameCount() - 1, m_framePos);
-
-    // Populate dashboard with frames within capped range
-    for (int i = startFrame; i <= endFrame; ++i)
-      IO::Manager::instance().processPayload(getFrame(i));
-
-    // Update with current data
-    updateData();
-  }
+    seek(newFramePos);
 }
 
+//------------------------------------------------------------------------------
+// Playback
+//------------------------------------------------------------------------------
+
 /**
  * Generates a JSON data frame by combining the values of the current CSV
  * row & the structure of the JSON map file loaded in the @c JsonParser class.
- *
- * If playback is enabled, this function calculates the difference in
- * milliseconds between the current row and the next row & schedules a re-call
- * of this function using a timer.
  */
 void CSV::Player::updateData()
 {
   // File not open, abort
-  if (!isOpen())
+  if (!isOpen() || framePosition() >= frameCount())
     return;
 
-  // Update timestamp string
-  bool error = true;
-  auto timestamp = getCellValue(framePosition(), 0, error);
-  if (!error)
+  // Update timestamp string & process the current row
+  m_timestamp = frameTimestamp(framePosition());
+  IO::Manager::instance().processPayload(getFrame(framePosition()));
+  Q_EMIT timestampChanged();
+}
+
+/**
+ * @brief Delivers the frames that are due since the last UI tick.
+ *
+ * The playback clock maps the time elapsed since playback started (scaled by
+ * the playback speed) to the time of the recording. Every frame whose time
+ * has been reached is delivered, up to kMaxBatchRows frames per tick. When
+ * playing as fast as possible, kMaxBatchRows frames are delivered every tick.
+ *
+ * All the due frames but the last one are appended to the dashboard plots in
+ * a single batch, see loadFrames(). The last frame is processed normally, so
+ * that every widget (including text datasets) is updated. Both go through the
+ * processing thread, so they are applied in order.
+ */
+void CSV::Player::playFrames()
+{
+  // Not playing, abort
+  if (!isOpen() || !isPlaying())
+    return;
+
+  // Pause at end of CSV
+  const int lastFrame = frameCount() - 1;
+  if (framePosition() >= lastFrame)
   {
-    m_timestamp = timestamp;
-    IO::Manager::instance().processPayload(getFrame(framePosition()));
-    Q_EMIT timestampChanged();
+    pause();
+    return;
   }
 
-  // If the user wants to 'play' the CSV, get time difference between this
-  // frame and the next frame & schedule an automated update
-  if (!error && isPlaying())
+  // Find the last frame that is due
+  int last = qMin(lastFrame, framePosition() + kMaxBatchRows);
+  if (m_speed > 0)
   {
-    // Get first frame
-    if (framePosition() < frameCount() - 1)
+    const auto target
+        = m_clockOrigin + static_cast<qint64>(m_clock.elapsed() * m_speed);
+
+    int due = framePosition();
+    while (due < last && frameTime(due + 1) <= target)
+      ++due;
+
+    last = due;
+  }
+
+  // Nothing to deliver
+  if (last == framePosition())
+    return;
+
+  // Append the frames before the last one in a single batch
+  const int first = framePosition() + 1;
+  if (last - first > 0)
+    loadFrames(first, last, false);
+
+  // Process the last frame
+  m_framePos = last;
+  updateData();
+}
+
+/**
+ * @brief Synchronizes the playback clock with the current frame.
+ */
+void CSV::Player::restartClock()
+{
+  m_clock.start();
+  if (isOpen() && framePosition() < frameCount())
+    m_clockOrigin = frameTime(framePosition());
+}
+
+/**
+ * @brief Moves the playback position to @a position.
+ *
+ * The dashboard plots are rebuilt with up to `UI::Dashboard::points()` frames
+ * before the new position, which are decoded in a single batch by
+ * loadFrames(). The frame at the new position is then processed normally,
+ * so that every widget (including text datasets) is updated.
+ *
+ * Both are queued to the processing thread, so frames that were queued before
+ * the seek (e.g. while scrubbing during playback) are applied before the
+ * history is replaced, and never after it.
+ */
+void CSV::Player::seek(const int position)
+{
+  // Update frame position
+  m_framePos = std::clamp(position, 0, qMax(0, frameCount() - 1));
+
+  // Populate the dashboard with the frames before the new position
+  const int first = qMax(0, m_framePos - UI::Dashboard::instance().points());
+  loadFrames(first, m_framePos, true);
+
+  // Keep timestamp, data & playback clock in sync
+  updateData();
+  restartClock();
+}
+
+/**
+ * @brief Queues the frames in [@a first, @a last) to be loaded into the
+ *        dashboard plots, replacing their history if @a replace is set.
+ *
+ * The cells of each row (except the date/time column) are parsed directly
+ * from the mapped file into a matrix of numbers, where cell @c N feeds the
+ * dataset with index @c N+1, just like the comma-separated frames generated
+ * by getFrame(). The values of binary recordings are copied without any
+ * parsing, to the dataset index each column was recorded from, and datasets
+ * that were not recorded are left as NaN. Cells that are empty or not
+ * numeric keep the value of the previous row, which is also what the frame
+ * parser does with empty cells.
+ *
+ * The matrix is handed to the dashboard through the processing thread, so
+ * that it is applied in order with the frames queued by updateData(). If the
+ * dashboard model has not been built yet, the rows are parsed as frames
+ * instead.
+ */
+void CSV::Player::loadFrames(const int first, const int last,
+                             const bool replace)
+{
+  // Decode the row before the first one too, it only seeds the values of the
+  // cells that are empty in the first row
+  const int seed = qMax(0, first - 1);
+  const int count = qMax(0, last - seed);
+
+  // Use the number of cells of the first row as the number of channels, or
+  // the highest dataset index of binary recordings
+  int channels = 0;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  if (m_recording.isLoaded())
+    channels = m_recording.channels();
+
+  else if (count > 0)
+  {
+    const auto offset = rowOffset(seed);
+    if (offset >= 0)
     {
-      // Obtain time for current & next frame
-      auto currTime = getDateTime(framePosition());
-      auto nextTime = getDateTime(framePosition() + 1);
+      forEachCell(data + offset, data + rowEnd(offset),
+                  [&](const char *, const char *) { ++channels; });
+    }
+
+    if (m_timeColumn >= 0 && m_timeColumn < channels)
+      --channels;
+  }
+
+  // Decode the numeric value of each cell, datasets that are not in a binary
+  // recording are left as NaN
+  qsizetype rows = 0;
+  const double fill = m_recording.isLoaded()
+                          ? std::numeric_limits<double>::quiet_NaN()
+                          : 0;
+  std::vector<double> samples(static_cast<std::size_t>(count) * channels,
+                              fill);
+  for (int i = seed; i < last && channels > 0; ++i)
+  {
+    // Start with the values of the previous row
+    double *row = samples.data() + rows * channels;
+    if (rows > 0)
+      std::copy(row - channels, row, row);
 
-      // No error, calculate difference & schedule update
-      if (currTime.isValid() && nextTime.isValid())
+    // Copy the values of binary recordings to their datasets
+    if (m_recording.isLoaded())
+    {
+      for (int c = 0; c < m_recording.columns(); ++c)
       {
-        // Obtain millis between the two frames
-        const auto msecsToNextF = abs(currTime.msecsTo(nextTime));
+        const auto value = m_recording.value(i, c);
+        if (!std::isnan(value))
+          row[m_recording.datasetIndex(c) - 1] = value;
+      }
+    }
 
-        // Jump to next frame
-        QTimer::singleShot(msecsToNextF, Qt::PreciseTimer, this, [=, this] {
-          if (isOpen() && isPlaying() && framePosition() < frameCount())
+    // Parse the cells of the row
+    else
+    {
+      const auto offset = rowOffset(i);
+      if (offset < 0)
+        break;
+
+      int cell = 0;
+      int channel = 0;
+      forEachCell(data + offset, data + rowEnd(offset),
+                  [&](const char *begin, const char *end) {
+                    if (cell++ == m_timeColumn || channel >= channels)
+                      return;
+
+                    double value;
+                    if (JSON::parse_number(begin, end - begin, value))
+                      row[channel] = value;
+
+                    ++channel;
+                  });
+    }
+
+    ++rows;
+  }
+
+  // Drop the seed row
+  const qsizetype skip = (seed < first && rows > 0) ? 1 : 0;
+
+  // Update the dashboard history in order with the queued frames
+  IO::Manager::instance().processTask(
+      [samples = std::move(samples), skip, rows, channels, replace] {
+        const double *values = samples.data() + skip * channels;
+        if (UI::Dashboard::instance().loadSamples(values, rows - skip,
+                                                  channels, replace))
+          return;
+
+        // The dashboard is not ready, parse the rows as frames instead
+        auto &builder = JSON::FrameBuilder::instance();
+        for (qsizetype r = 0; r < rows - skip; ++r)
+        {
+          QByteArray frame;
+          const double *row = values + r * channels;
+          for (int c = 0; c < channels; ++c)
           {
-            ++m_framePos;
-            updateData();
+            if (c > 0)
+              frame.append(',');
+
+            if (!std::isnan(row[c]))
+              frame.append(QByteArray::number(row[c], 'g',
+                                              QLocale::FloatingPointShortest));
           }
-        });
-      }
 
-      // Error - pause playback
-      else
+          frame.append('\n');
+          builder.hotpathRxFrame(frame);
+        }
+      });
+}
+
+//------------------------------------------------------------------------------
+// Row indexing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Waits for the indexing thread to finish & releases it.
+ *
+ * Pending progress notifications of the thread are discarded by changing the
+ * indexing session.
+ */
+void CSV::Player::stopIndexing()
+{
+  if (!m_indexThread)
+    return;
+
+  ++m_indexSession;
+  m_abortIndex = true;
+  m_indexThread->wait();
+  delete m_indexThread;
+  m_indexThread = nullptr;
+}
+
+/**
+ * @brief Reports the file as open and displays the first frame, provided that
+ *        the index contains enough rows.
+ */
+void CSV::Player::beginPlayback()
+{
+  // Begin reading data
+  if (frameCount() >= 2)
+  {
+    m_framePos = 0;
+    updateData();
+    Q_EMIT openChanged();
+    Q_EMIT playerStateChanged();
+  }
+
+  // Handle case where CSV file does not contain at least two frames
+  else
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Insufficient Data in CSV File"),
+        tr("The CSV file must contain at least two frames (data rows) to "
+           "proceed. Please check the file and try again."),
+        QMessageBox::Critical);
+    closeFile();
+  }
+}
+
+/**
+ * @brief Called on the main thread once the indexing thread is done.
+ *
+ * Releases the thread and begins playback.
+ *
+ * @param session Indexing session that finished.
+ */
+void CSV::Player::finishIndexing(const quint64 session)
+{
+  // Ignore notifications from aborted sessions
+  if (session != m_indexSession || !m_indexThread)
+    return;
+
+  // Release the thread
+  m_indexThread->wait();
+  delete m_indexThread;
+  m_indexThread = nullptr;
+  Q_EMIT indexingChanged();
+
+  // Begin reading data
+  beginPlayback();
+}
+
+/**
+ * @brief Builds the row index of the mapped file, runs on a worker thread.
+ *
+ * Registers every non-empty row starting at @a offset in the index. Only the
+ * first row of each block is parsed, to obtain the time of the block. If it
+ * does not contain a valid date/time, the time of the previous block is used.
+ *
+ * The progress is reported to the main thread in steps of 1%.
+ *
+ * @param offset Byte offset of the first data row.
+ * @param msecs Time of the first data row.
+ * @param session Indexing session, used to discard stale notifications.
+ */
+void CSV::Player::indexRows(qint64 offset, qint64 msecs, const quint64 session)
+{
+  m_index.reset(0);
+
+  int percent = 0;
+  qint64 nextReport = m_size / 100;
+  const bool timed = m_timeColumn >= 0;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+
+  while (offset < m_size && !m_abortIndex.load(std::memory_order_relaxed))
+  {
+    // Register the row if it contains data
+    const auto end = rowEnd(offset);
+    if (!isBlankRow(data + offset, data + end))
+    {
+      if (m_index.startsBlock())
       {
-        pause();
-        qWarning() << "Error getting timestamp difference" << currTime
-                   << nextTime;
+        if (timed)
+          rowTime(offset, msecs);
+
+        m_index.beginBlock(offset, msecs);
       }
+
+      m_index.appendRow();
     }
 
-    // Pause at end of CSV
-    else
-      pause();
+    // Move to the next row
+    offset = end + 1;
+
+    // Report progress
+    if (offset >= nextReport)
+    {
+      percent = static_cast<int>(qMin<qint64>(100, offset * 100 / m_size));
+      nextReport = m_size * (percent + 1) / 100;
+      QMetaObject::invokeMethod(
+          this,
+          [this, percent, session] {
+            if (session == m_indexSession)
+            {
+              m_indexProgress = percent / 100.0;
+              Q_EMIT indexProgressChanged();
+            }
+          },
+          Qt::QueuedConnection);
+    }
   }
+
+  // Notify the main thread
+  QMetaObject::invokeMethod(
+      this, [this, session] { finishIndexing(session); },
+      Qt::QueuedConnection);
 }
 
 /**
@@ -504,17 +1199,21 @@ void CSV::Player::updateData()
  *
  * This function checks if the CSV file has valid headers, then asks the user
  * to either select a date/time column or manually enter an interval between
- * rows in milliseconds. Depending on the user's choice, either date/time
- * values are generated based on the interval, or an existing column is
- * converted to date/time values.
+ * rows in milliseconds. The choice is stored in @c m_timeColumn (set to -1 if
+ * an interval is used) and @c m_interval.
+ *
+ * @param header Byte offset of the title row.
  *
  * @return true if the user successfully provided a date/time option or
  *         interval, false if cancelled or invalid input.
  */
-bool CSV::Player::promptUserForDateTimeOrInterval()
+bool CSV::Player::promptUserForDateTimeOrInterval(const qint64 header)
 {
+  // Obtain header labels
+  const auto headerLabels = rowCells(header);
+
   // Check if there are headers available for the combobox
-  if (m_csvData.isEmpty() || m_csvData.first().isEmpty())
+  if (headerLabels.isEmpty())
   {
     Misc::Utilities::showMessageBox(
         tr("Invalid CSV"),
@@ -523,9 +1222,6 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
     return false;
   }
 
-  // Obtain header labels
-  const auto headerLabels = m_csvData.first().toList();
-
   // Ask the user if they want to select a date/time column or enter an interval
   bool ok;
   QStringList options;
@@ -548,7 +1244,9 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
 
     if (ok)
     {
-      generateDateTimeForRows(interval);
+      m_timeColumn = -1;
+      m_interval = interval;
+      m_startTime = QDateTime::currentDateTime();
       return true;
     }
   }
@@ -573,8 +1271,8 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
         return false;
       }
 
-      // Convert the selected column to date/time
-      convertColumnToDateTime(columnIndex);
+      // Use the selected column as the date/time column
+      m_timeColumn = columnIndex;
       return true;
     }
   }
@@ -583,174 +1281,280 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
   return false;
 }
 
+//------------------------------------------------------------------------------
+// CSV conversion
+//------------------------------------------------------------------------------
+
 /**
- * @brief Generates date/time values for each row based on a fixed interval.
+ * @brief Cancels the conversion thread, waits for it to finish & releases it.
  *
- * This function generates date/time strings starting from the current time
- * and increments them by a user-specified interval in milliseconds. It then
- * prepends the generated date/time string to each row of the CSV data.
- *
- * @param interval The interval in milliseconds between each row.
+ * The partially written CSV file is discarded, and pending notifications of
+ * the thread are ignored by changing the conversion session.
  */
-void CSV::Player::generateDateTimeForRows(int interval)
+void CSV::Player::stopConversion()
 {
-  const auto startTime = QDateTime::currentDateTime();
-  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  if (!m_convertThread)
+    return;
 
-  for (int i = 0; i < m_csvData.size(); ++i)
-  {
-    QString dateTimeString = startTime.addMSecs(i * interval).toString(format);
-    m_csvData[i].prepend(dateTimeString);
-  }
+  ++m_convertSession;
+  m_abortConvert = true;
+  m_convertThread->wait();
+  delete m_convertThread;
+  m_convertThread = nullptr;
 }
 
 /**
- * @brief Converts the specified column in the CSV data to a date/time format
- *        and moves it to the start of each row.
- *
- * This function processes the specified column (excluding the header row) in
- * the CSV data and converts each value to a `QDateTime` object using the
- * formats defined in the `getDateTime` function. If a valid `QDateTime` is not
- * found, the current date/time is used. The converted date/time string is then
- * moved to the start of each row.
+ * @brief Called on the main thread once the conversion thread is done.
  *
- * The header row (row 0) is excluded from this operation to ensure it remains
- * intact. The selected column is removed from its original position and moved
- * to the start of the row as a formatted date/time string.
+ * Releases the thread and reports the result to the user.
  *
- * @param columnIndex The index of the column to convert and move to the start
- * of each row.
+ * @param session   Conversion session that finished.
+ * @param converted Whether the CSV file & its index were written.
+ * @param path      Location of the CSV file.
  */
-void CSV::Player::convertColumnToDateTime(int columnIndex)
+void CSV::Player::finishConversion(const quint64 session, const bool converted,
+                                   const QString &path)
 {
-  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-  for (int i = 1; i < m_csvData.size(); ++i)
+  // Ignore notifications from aborted sessions
+  if (session != m_convertSession || !m_convertThread)
+    return;
+
+  // Release the thread
+  m_convertThread->wait();
+  delete m_convertThread;
+  m_convertThread = nullptr;
+  Q_EMIT convertingChanged();
+
+  // Report the result to the user
+  if (converted)
   {
-    // Parse the date/time from the specified column
-    auto dateTime = getDateTime(i);
-    if (!dateTime.isValid())
-      dateTime = QDateTime::currentDateTime();
+    Misc::Utilities::showMessageBox(
+        tr("Recording Converted"),
+        tr("The recording was saved as \"%1\".").arg(path),
+        QMessageBox::Information);
+  }
 
-    // Move the $TIME column to the start
-    m_csvData[i].remove(columnIndex);
-    m_csvData[i].prepend(dateTime.toString(format));
+  else
+  {
+    Misc::Utilities::showMessageBox(
+        tr("Cannot write CSV file"),
+        tr("Please check file permissions & location"), QMessageBox::Critical);
   }
 }
 
+//------------------------------------------------------------------------------
+// Row access
+//------------------------------------------------------------------------------
+
 /**
- * @brief Retrieves the date/time value from a specific cell in the CSV.
- *
- * This function attempts to parse the date/time value in the first column of
- * the specified cell. It tries several predefined date/time formats, returning
- * the first valid date/time it finds. If no valid date/time can be found, an
- * invalid QDateTime object is returned.
- *
- * @param cell The index of the cell to retrieve the date/time from.
- * @return QDateTime The parsed date/time value or an invalid QDateTime if
- *                   parsing fails.
+ * Returns the byte offset of the line break (or end of file) that terminates
+ * the row that starts at @a offset.
  */
-QDateTime CSV::Player::getDateTime(const int row)
+qint64 CSV::Player::rowEnd(const qint64 offset) const
 {
-  bool error;
-  auto value = getCellValue(row, 0, error);
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  const auto *end = static_cast<const char *>(
+      std::memchr(data + offset, '\n', m_size - offset));
 
-  if (!error)
-    return getDateTime(value);
+  return end ? end - data : m_size;
+}
 
-  return QDateTime();
+/**
+ * Returns the byte offset of the first non-empty row that starts at or after
+ * @a offset, or -1 if there are no more rows in the file.
+ */
+qint64 CSV::Player::nextRow(qint64 offset) const
+{
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  while (offset < m_size)
+  {
+    const auto end = rowEnd(offset);
+    if (!isBlankRow(data + offset, data + end))
+      return offset;
+
+    offset = end + 1;
+  }
+
+  return -1;
 }
 
 /**
- * @brief Parses a date/time string from a given cell in the CSV data.
- *
- * This function attempts to convert a string into a `QDateTime` object using a
- * list of predefined date/time formats. It iterates through multiple formats to
- * find a valid match. If no valid format is found, an invalid `QDateTime`
- * object is returned.
- *
- * The function uses common date/time formats such as "yyyy/MM/dd HH:mm:ss::zzz"
- * and its variations to handle different possible formats that might be present
- * in the CSV file.
+ * Splits the row that starts at @a offset into a list of trimmed cells.
+ */
+QStringList CSV::Player::rowCells(const qint64 offset) const
+{
+  QStringList cells;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  forEachCell(data + offset, data + rowEnd(offset),
+              [&](const char *begin, const char *end) {
+                cells.append(QString::fromUtf8(begin, end - begin));
+              });
+
+  return cells;
+}
+
+/**
+ * Parses the date/time column of the row that starts at @a offset.
  *
- * @param cell The string representing the cell in the CSV that contains the
- *             date/time data.
+ * @return @c false if the row does not contain a valid date/time, in which
+ *         case @a msecs is not modified.
+ */
+bool CSV::Player::rowTime(const qint64 offset, qint64 &msecs) const
+{
+  const char *cellBegin;
+  const char *cellEnd;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  if (!findCell(data + offset, data + rowEnd(offset), m_timeColumn, cellBegin,
+                cellEnd))
+    return false;
+
+  return parseTimestamp(cellBegin, cellEnd, msecs);
+}
+
+/**
+ * Returns the byte offset of the given frame, or -1 if the file does not
+ * match its index.
  *
- * @return QDateTime The parsed `QDateTime` object. If no valid date/time format
- *                   is found, an invalid `QDateTime` is returned.
+ * The rows are scanned from the first row of the frame's block, or from the
+ * last frame that was located if it precedes the given frame within the same
+ * block, which makes sequential access O(1).
  */
-QDateTime CSV::Player::getDateTime(const QString &cell)
+qint64 CSV::Player::rowOffset(const int row) const
 {
-  // Initialize parameters
-  QDateTime dateTime;
+  // Start from the first row of the block
+  const auto block = row / Index::kBlockRows;
+  qint64 current = block * Index::kBlockRows;
+  qint64 offset = m_index.blockOffset(block);
+
+  // Continue from the last located row if possible
+  if (m_cursorRow >= current && m_cursorRow <= row)
+  {
+    current = m_cursorRow;
+    offset = m_cursorOffset;
+  }
 
-  // Create a list of available date/time formats
-  static const QStringList formats
-      = {QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz"),
-         QStringLiteral("yyyy/MM/dd/ HH:mm:ss::zzz"),
-         QStringLiteral("yyyy/MM/dd HH:mm:ss"),
-         QStringLiteral("yyyy/MM/dd/ HH:mm:ss")};
+  // Skip the preceding rows
+  for (; current < row && offset >= 0; ++current)
+    offset = nextRow(rowEnd(offset) + 1);
 
-  // Try to obtain date/time string
-  for (const auto &format : formats)
+  // Update the cursor
+  if (offset >= 0)
   {
-    dateTime = QDateTime::fromString(cell, format);
-    if (dateTime.isValid())
-      break;
+    m_cursorRow = row;
+    m_cursorOffset = offset;
   }
 
-  // Return date/time
-  return dateTime;
+  return offset;
 }
 
 /**
- * Generates a frame from the data at the given @a row. The first item of each
- * row is ignored because it contains the RX date/time, which is used to
- * regulate the interval at which the frames are parsed.
+ * Returns the time (in milliseconds) of the given frame, used to regulate
+ * the interval at which frames are replayed. If the frame does not contain a
+ * valid date/time, the time of its block is used.
  */
-QByteArray CSV::Player::getFrame(const int row)
+qint64 CSV::Player::frameTime(const int row) const
 {
-  QByteArray frame;
+  if (m_recording.isLoaded())
+    return m_recording.time(row);
 
-  if (m_csvData.count() > row)
-  {
-    const auto &list = m_csvData[row];
-    for (int i = 1; i < list.count(); ++i)
-    {
-      frame.append(list[i].toUtf8());
-      if (i < list.count() - 1)
-        frame.append(',');
-      else
-        frame.append('\n');
-    }
-  }
+  if (m_timeColumn < 0)
+    return row * m_interval;
 
-  return frame;
+  qint64 msecs = m_index.blockTime(row / Index::kBlockRows);
+  const auto offset = rowOffset(row);
+  if (offset >= 0)
+    rowTime(offset, msecs);
+
+  return msecs;
+}
+
+/**
+ * Returns the date/time string displayed for the given frame.
+ */
+QString CSV::Player::frameTimestamp(const int row) const
+{
+  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  if (m_recording.isLoaded())
+    return QDateTime::fromMSecsSinceEpoch(frameTime(row)).toString(format);
+
+  if (m_timeColumn < 0)
+    return m_startTime.addMSecs(frameTime(row)).toString(format);
+
+  const char *cellBegin;
+  const char *cellEnd;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  const auto offset = rowOffset(row);
+  if (offset < 0
+      || !findCell(data + offset, data + rowEnd(offset), m_timeColumn,
+                   cellBegin, cellEnd))
+    return QString();
+
+  return QString::fromUtf8(cellBegin, cellEnd - cellBegin);
 }
 
 /**
- * Safely returns the value in the cell at the given @a row & @a column. If an
- * error occurs or the cell does not exist, the value of @a error shall be set
- * to @c true.
+ * Generates a frame from the data at the given @a row. The date/time column
+ * is skipped because it is only used to regulate the interval at which the
+ * frames are parsed.
  */
-const QString CSV::Player::getCellValue(const int row, const int column,
-                                        bool &error)
+QByteArray CSV::Player::getFrame(const int row) const
 {
-  static auto defaultValue = QLatin1String("");
+  QByteArray frame;
+  if (row < 0 || row >= frameCount())
+    return frame;
 
-  if (m_csvData.count() > row)
+  // Place the values of binary recordings by dataset index, leaving NaN
+  // values & datasets that were not recorded empty
+  if (m_recording.isLoaded())
   {
-    const auto &list = m_csvData[row];
-    if (list.count() > column)
+    std::vector<double> values(m_recording.channels(),
+                               std::numeric_limits<double>::quiet_NaN());
+    for (int c = 0; c < m_recording.columns(); ++c)
+      values[m_recording.datasetIndex(c) - 1] = m_recording.value(row, c);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
     {
-      error = false;
-      return list[column];
+      if (i > 0)
+        frame.append(',');
+
+      if (!std::isnan(values[i]))
+        frame.append(QByteArray::number(values[i], 'g',
+                                        QLocale::FloatingPointShortest));
     }
+
+    frame.append('\n');
+    return frame;
   }
 
-  error = true;
-  return defaultValue;
+  const auto offset = rowOffset(row);
+  if (offset < 0)
+    return frame;
+
+  int column = 0;
+  bool firstCell = true;
+  const auto *data = reinterpret_cast<const char *>(m_map);
+  forEachCell(data + offset, data + rowEnd(offset),
+              [&](const char *begin, const char *end) {
+                if (column != m_timeColumn)
+                {
+                  if (!firstCell)
+                    frame.append(',');
+
+                  firstCell = false;
+                  frame.append(begin, end - begin);
+                }
+
+                ++column;
+              });
+
+  frame.append('\n');
+  return frame;
 }
 
+//------------------------------------------------------------------------------
+// Keyboard controls
+//------------------------------------------------------------------------------
+
 /**
  * @brief Event filter to capture and handle key events for playback controls.
  *
@@ -21,10 +21,17 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QFile>
 #include <QObject>
-#include <QVector>
+#include <QThread>
+#include <QDateTime>
 #include <QKeyEvent>
+#include <QElapsedTimer>
+
+#include "CSV/Index.h"
+#include "CSV/Recording.h"
 
 namespace CSV
 {
@@ -33,6 +40,20 @@ namespace CSV
  *
  * The CSV player class allows users to select a CSV file and "re-play" it
  * with Serial Studio.
+ *
+ * The file is memory-mapped instead of being read into memory. Rows are
+ * located through a CSV::Index, which is loaded from the sidecar file written
+ * by CSV::Export when available. Otherwise, a background thread scans the file
+ * once to build it, reporting its progress through indexProgress(). Rows are
+ * only split and converted into frames when they are replayed.
+ *
+ * Binary recordings (see CSV::Recording) are replayed from the mapped file as
+ * well. They do not need an index, and can be converted to CSV files with
+ * convertToCsv(), which runs on a background thread and reports its progress
+ * through conversionProgress().
+ *
+ * Playback is driven by the UI timer: on every tick, the frames that are due
+ * at the selected speed() are delivered to the dashboard as a batch.
  */
 class Player : public QObject
 {
@@ -41,6 +62,9 @@ class Player : public QObject
   Q_PROPERTY(bool isOpen
              READ isOpen
              NOTIFY openChanged)
+  Q_PROPERTY(bool isBinary
+             READ isBinary
+             NOTIFY openChanged)
   Q_PROPERTY(double progress
              READ progress
              NOTIFY timestampChanged)
@@ -53,6 +77,22 @@ class Player : public QObject
   Q_PROPERTY(bool isPlaying
              READ isPlaying
              NOTIFY playerStateChanged)
+  Q_PROPERTY(double speed
+             READ speed
+             WRITE setSpeed
+             NOTIFY speedChanged)
+  Q_PROPERTY(bool isIndexing
+             READ isIndexing
+             NOTIFY indexingChanged)
+  Q_PROPERTY(double indexProgress
+             READ indexProgress
+             NOTIFY indexProgressChanged)
+  Q_PROPERTY(bool isConverting
+             READ isConverting
+             NOTIFY convertingChanged)
+  Q_PROPERTY(double conversionProgress
+             READ conversionProgress
+             NOTIFY conversionProgressChanged)
   Q_PROPERTY(const QString& timestamp
              READ timestamp
              NOTIFY timestampChanged)
@@ -60,8 +100,13 @@ class Player : public QObject
 
 signals:
   void openChanged();
+  void speedChanged();
+  void indexingChanged();
   void timestampChanged();
+  void convertingChanged();
   void playerStateChanged();
+  void indexProgressChanged();
+  void conversionProgressChanged();
 
 private:
   explicit Player();
@@ -70,12 +115,20 @@ private:
   Player &operator=(Player &&) = delete;
   Player &operator=(const Player &) = delete;
 
+  ~Player();
+
 public:
   static Player &instance();
 
   [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool isBinary() const;
   [[nodiscard]] double progress() const;
+  [[nodiscard]] double speed() const;
   [[nodiscard]] bool isPlaying() const;
+  [[nodiscard]] bool isIndexing() const;
+  [[nodiscard]] double indexProgress() const;
+  [[nodiscard]] bool isConverting() const;
+  [[nodiscard]] double conversionProgress() const;
   [[nodiscard]] int frameCount() const;
   [[nodiscard]] int framePosition() const;
 
@@ -90,23 +143,41 @@ public slots:
   void closeFile();
   void nextFrame();
   void previousFrame();
+  void convertToCsv();
+  void setSpeed(const double speed);
   void openFile(const QString &filePath);
   void setProgress(const double progress);
 
 private slots:
   void updateData();
+  void playFrames();
 
 private:
-  bool promptUserForDateTimeOrInterval();
-  void generateDateTimeForRows(int interval);
-  void convertColumnToDateTime(int columnIndex);
+  void restartClock();
+  void seek(const int position);
+  void loadFrames(const int first, const int last, const bool replace);
+
+  void stopIndexing();
+  void beginPlayback();
+  void finishIndexing(const quint64 session);
+  void indexRows(qint64 offset, qint64 msecs, const quint64 session);
+
+  void stopConversion();
+  void finishConversion(const quint64 session, const bool converted,
+                        const QString &path);
 
-  QDateTime getDateTime(int row);
-  QDateTime getDateTime(const QString &cell);
+  bool promptUserForDateTimeOrInterval(const qint64 header);
 
-  QByteArray getFrame(const int row);
+  [[nodiscard]] qint64 rowEnd(const qint64 offset) const;
+  [[nodiscard]] qint64 nextRow(const qint64 offset) const;
+  [[nodiscard]] QStringList rowCells(const qint64 offset) const;
+  [[nodiscard]] bool rowTime(const qint64 offset, qint64 &msecs) const;
 
-  const QString getCellValue(const int row, const int column, bool &error);
+  [[nodiscard]] qint64 rowOffset(const int row) const;
+  [[nodiscard]] qint64 frameTime(const int row) const;
+  [[nodiscard]] QString frameTimestamp(const int row) const;
+
+  [[nodiscard]] QByteArray getFrame(const int row) const;
 
 protected:
   bool eventFilter(QObject *obj, QEvent *event) override;
@@ -117,6 +188,30 @@ private:
   bool m_playing;
   QFile m_csvFile;
   QString m_timestamp;
-  QList<QStringList> m_csvData;
+
+  double m_speed;
+  QElapsedTimer m_clock;
+  qint64 m_clockOrigin;
+
+  uchar *m_map;
+  qint64 m_size;
+  int m_timeColumn;
+  qint64 m_interval;
+  QDateTime m_startTime;
+
+  quint64 m_indexSession;
+  double m_indexProgress;
+  QThread *m_indexThread;
+  std::atomic_bool m_abortIndex;
+
+  quint64 m_convertSession;
+  double m_convertProgress;
+  QThread *m_convertThread;
+  std::atomic_bool m_abortConvert;
+
+  Index m_index;
+  Recording m_recording;
+  mutable int m_cursorRow;
+  mutable qint64 m_cursorOffset;
 };
 } // namespace CSV
@@ -0,0 +1,576 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <QDebug>
+#include <QLocale>
+#include <QtEndian>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include "CSV/Index.h"
+#include "CSV/Recording.h"
+
+//------------------------------------------------------------------------------
+// File layout
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Identifies recording files ("SSRC"), followed by the format version.
+ *
+ * The file is little-endian and laid out as:
+ * - magic (u32), version (u32), size of the header document (u32), zero (u32)
+ * - header document (compact UTF-8 JSON), padded with zeros to 8 bytes:
+ *   @code
+ *   {
+ *     "frame": { ... },
+ *     "columns": [ { "index": 1, "title": "Group/Dataset", "type": "f64" } ]
+ *   }
+ *   @endcode
+ * - for each block: number of rows (u32), zero (u32), the time of each row
+ *   (i64, milliseconds since the epoch), then the values of each column (f64)
+ */
+static constexpr quint32 kMagic = 0x43525353;
+static constexpr quint32 kVersion = 1;
+static constexpr qint64 kHeaderSize = 16;
+static constexpr qint64 kBlockHeaderSize = 8;
+
+/**
+ * @brief Type name of the data columns in the header document.
+ */
+static const QString kFloat64 = QStringLiteral("f64");
+
+/**
+ * @brief Returns the size in bytes of a block with @a rows rows.
+ */
+static inline qint64 blockSize(const qint64 rows, const int columns)
+{
+  return kBlockHeaderSize + rows * 8 * (1 + static_cast<qint64>(columns));
+}
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a recording that is neither open nor loaded.
+ */
+CSV::Recording::Recording()
+  : m_columns(0)
+  , m_pendingRows(0)
+  , m_rows(0)
+  , m_channels(0)
+  , m_data(nullptr)
+{
+}
+
+/**
+ * @brief Writes the pending rows & closes the file, if open.
+ */
+CSV::Recording::~Recording()
+{
+  close();
+}
+
+//------------------------------------------------------------------------------
+// Recording
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if the recording is open for writing.
+ */
+bool CSV::Recording::isOpen() const
+{
+  return m_file.isOpen();
+}
+
+/**
+ * @brief Creates the recording file at @a path and writes its header.
+ *
+ * @param path    Location of the recording.
+ * @param frame   Frame structure stored in the header.
+ * @param columns Dataset index & title of each data column.
+ *
+ * @return @c false if the file cannot be written.
+ */
+bool CSV::Recording::open(const QString &path, const JSON::Frame &frame,
+                          const QVector<QPair<int, QString>> &columns)
+{
+  close();
+
+  // Build the header document
+  QJsonArray list;
+  for (const auto &column : columns)
+  {
+    QJsonObject object;
+    object.insert(QStringLiteral("index"), column.first);
+    object.insert(QStringLiteral("title"), column.second);
+    object.insert(QStringLiteral("type"), kFloat64);
+    list.append(object);
+  }
+
+  QJsonObject header;
+  header.insert(QStringLiteral("frame"), JSON::serialize(frame));
+  header.insert(QStringLiteral("columns"), list);
+  auto document = QJsonDocument(header).toJson(QJsonDocument::Compact);
+  const auto documentSize = static_cast<quint32>(document.size());
+  document.append((8 - document.size() % 8) % 8, '\0');
+
+  // Write the header
+  uchar fields[kHeaderSize];
+  qToLittleEndian<quint32>(kMagic, fields);
+  qToLittleEndian<quint32>(kVersion, fields + 4);
+  qToLittleEndian<quint32>(documentSize, fields + 8);
+  qToLittleEndian<quint32>(0, fields + 12);
+
+  m_file.setFileName(path);
+  if (!m_file.open(QIODevice::WriteOnly)
+      || m_file.write(reinterpret_cast<const char *>(fields), kHeaderSize)
+             != kHeaderSize
+      || m_file.write(document) != document.size())
+  {
+    m_file.close();
+    return false;
+  }
+
+  // Allocate the block buffers
+  m_pendingRows = 0;
+  m_columns = static_cast<int>(columns.count());
+  m_times.resize(kBlockRows);
+  m_values.resize(static_cast<std::size_t>(m_columns) * kBlockRows);
+  return true;
+}
+
+/**
+ * @brief Appends a row recorded at @a msecs (milliseconds since the epoch)
+ *        with one value per data column.
+ *
+ * The row is buffered and written with the rest of its block.
+ */
+void CSV::Recording::appendRow(const qint64 msecs, const double *values)
+{
+  if (!isOpen())
+    return;
+
+  m_times[m_pendingRows] = msecs;
+  for (int c = 0; c < m_columns; ++c)
+    m_values[static_cast<std::size_t>(c) * kBlockRows + m_pendingRows]
+        = values[c];
+
+  if (++m_pendingRows == kBlockRows)
+    writeBlock();
+}
+
+/**
+ * @brief Writes the buffered rows as a block & flushes the file.
+ */
+void CSV::Recording::flush()
+{
+  if (!isOpen())
+    return;
+
+  writeBlock();
+  m_file.flush();
+}
+
+/**
+ * @brief Writes the buffered rows & closes the file.
+ */
+void CSV::Recording::close()
+{
+  if (!isOpen())
+    return;
+
+  writeBlock();
+  m_file.close();
+  m_columns = 0;
+  m_times.clear();
+  m_values.clear();
+  m_block.clear();
+}
+
+/**
+ * @brief Encodes the buffered rows in a single block & writes it.
+ */
+void CSV::Recording::writeBlock()
+{
+  if (m_pendingRows <= 0)
+    return;
+
+  const qint64 rows = m_pendingRows;
+  m_block.resize(blockSize(rows, m_columns));
+
+  auto *dst = reinterpret_cast<uchar *>(m_block.data());
+  qToLittleEndian<quint32>(m_pendingRows, dst);
+  qToLittleEndian<quint32>(0, dst + 4);
+  dst += kBlockHeaderSize;
+
+  for (qint64 r = 0; r < rows; ++r, dst += 8)
+    qToLittleEndian<qint64>(m_times[r], dst);
+
+  for (int c = 0; c < m_columns; ++c)
+  {
+    const double *column = m_values.data() + c * kBlockRows;
+    for (qint64 r = 0; r < rows; ++r, dst += 8)
+      qToLittleEndian<quint64>(std::bit_cast<quint64>(column[r]), dst);
+  }
+
+  if (m_file.write(m_block) != m_block.size())
+    qWarning() << "Recording: Cannot write to" << m_file.fileName();
+
+  m_pendingRows = 0;
+}
+
+//------------------------------------------------------------------------------
+// Playback
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true if a recording is attached with load().
+ */
+bool CSV::Recording::isLoaded() const
+{
+  return m_data != nullptr;
+}
+
+/**
+ * @brief Returns the number of rows of the loaded recording.
+ */
+qint64 CSV::Recording::rows() const
+{
+  return m_rows;
+}
+
+/**
+ * @brief Returns the number of data columns of the loaded recording.
+ */
+int CSV::Recording::columns() const
+{
+  return m_titles.count();
+}
+
+/**
+ * @brief Returns the number of values of a frame of the loaded recording,
+ *        which is the highest dataset index of its data columns.
+ */
+int CSV::Recording::channels() const
+{
+  return m_channels;
+}
+
+/**
+ * @brief Returns the dataset index that @a column was recorded from, or -1
+ *        if there is no such column.
+ */
+int CSV::Recording::datasetIndex(const int column) const
+{
+  if (column < 0 || column >= columns())
+    return -1;
+
+  return m_indexes[column];
+}
+
+/**
+ * @brief Returns the title of each data column of the loaded recording.
+ */
+QStringList CSV::Recording::titles() const
+{
+  return m_titles;
+}
+
+/**
+ * @brief Returns the frame structure stored in the loaded recording.
+ */
+const QJsonObject &CSV::Recording::frame() const
+{
+  return m_frame;
+}
+
+/**
+ * @brief Returns the time of @a row, in milliseconds since the epoch.
+ */
+qint64 CSV::Recording::time(const qint64 row) const
+{
+  const auto b = blockOf(row);
+  if (b < 0)
+    return 0;
+
+  const auto *src = m_data + m_blockOffsets[b] + kBlockHeaderSize;
+  return qFromLittleEndian<qint64>(src + (row - m_blockRows[b]) * 8);
+}
+
+/**
+ * @brief Returns the value of @a column at @a row, NaN if it is not numeric.
+ */
+double CSV::Recording::value(const qint64 row, const int column) const
+{
+  const auto b = blockOf(row);
+  if (b < 0 || column < 0 || column >= columns())
+    return std::numeric_limits<double>::quiet_NaN();
+
+  const auto next = b + 1 < static_cast<qsizetype>(m_blockRows.size())
+                        ? m_blockRows[b + 1]
+                        : m_rows;
+  const auto count = next - m_blockRows[b];
+  const auto *src = m_data + m_blockOffsets[b] + kBlockHeaderSize + count * 8;
+  const auto raw = qFromLittleEndian<quint64>(
+      src + (column * count + row - m_blockRows[b]) * 8);
+
+  return std::bit_cast<double>(raw);
+}
+
+/**
+ * @brief Attaches the recording stored in @a data, which must remain valid
+ *        until unload() is called (e.g. a memory-mapped file).
+ *
+ * Only the header and the row count of each block are read. A block that
+ * extends past the end of the data, e.g. because the recording was
+ * interrupted while it was being written, is ignored with the ones after it.
+ *
+ * @return @c false if @a data does not hold a valid recording.
+ */
+bool CSV::Recording::load(const uchar *data, const qint64 size)
+{
+  unload();
+
+  // Validate the header
+  if (!data || size < kHeaderSize
+      || qFromLittleEndian<quint32>(data) != kMagic
+      || qFromLittleEndian<quint32>(data + 4) != kVersion)
+    return false;
+
+  const qint64 documentSize = qFromLittleEndian<quint32>(data + 8);
+  const qint64 first = kHeaderSize + (documentSize + 7) / 8 * 8;
+  if (first > size)
+    return false;
+
+  // Read the header document
+  QJsonParseError error;
+  const auto document = QJsonDocument::fromJson(
+      QByteArray::fromRawData(reinterpret_cast<const char *>(data)
+                                  + kHeaderSize,
+                              documentSize),
+      &error);
+  if (error.error != QJsonParseError::NoError || !document.isObject())
+    return false;
+
+  // Read the data columns, only float64 columns are supported
+  const auto header = document.object();
+  const auto list = header.value(QStringLiteral("columns")).toArray();
+  for (const auto &item : list)
+  {
+    const auto column = item.toObject();
+    if (column.value(QStringLiteral("type")).toString() != kFloat64)
+    {
+      m_titles.clear();
+      m_indexes.clear();
+      m_channels = 0;
+      return false;
+    }
+
+    // Columns without a valid dataset index feed the next dataset
+    int index = column.value(QStringLiteral("index")).toInt(0);
+    if (index <= 0)
+      index = m_channels + 1;
+
+    m_indexes.push_back(index);
+    m_channels = qMax(m_channels, index);
+    m_titles.append(column.value(QStringLiteral("title")).toString());
+  }
+
+  // Locate the blocks
+  qint64 offset = first;
+  while (offset + kBlockHeaderSize <= size)
+  {
+    const qint64 rows = qFromLittleEndian<quint32>(data + offset);
+    const auto length = blockSize(rows, columns());
+    if (rows <= 0 || length > size - offset)
+      break;
+
+    m_blockRows.push_back(m_rows);
+    m_blockOffsets.push_back(offset);
+    m_rows += rows;
+    offset += length;
+  }
+
+  m_data = data;
+  m_frame = header.value(QStringLiteral("frame")).toObject();
+  return true;
+}
+
+/**
+ * @brief Detaches the loaded recording.
+ */
+void CSV::Recording::unload()
+{
+  m_rows = 0;
+  m_channels = 0;
+  m_data = nullptr;
+  m_frame = QJsonObject();
+  m_titles.clear();
+  m_indexes.clear();
+  m_blockRows.clear();
+  m_blockOffsets.clear();
+}
+
+/**
+ * @brief Returns the block that contains @a row, or -1 if there is none.
+ */
+qsizetype CSV::Recording::blockOf(const qint64 row) const
+{
+  if (!m_data || row < 0 || row >= m_rows)
+    return -1;
+
+  const auto it = std::upper_bound(m_blockRows.begin(), m_blockRows.end(), row);
+  return std::distance(m_blockRows.begin(), it) - 1;
+}
+
+//------------------------------------------------------------------------------
+// CSV conversion
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Writes the loaded recording as a CSV file at @a csvPath.
+ *
+ * The CSV file has the same layout as the ones written by CSV::Export, and
+ * its row index is saved next to it, so that CSV::Player opens it without
+ * scanning it. Each value is written to the column of its dataset index, so
+ * the CSV file replays like the recording. NaN values and datasets that
+ * were not recorded are written as empty cells.
+ *
+ * If set, @a progress is called with the percentage of rows written every
+ * time it increases. The conversion is cancelled (leaving any existing file
+ * at @a csvPath untouched) if it returns @c false.
+ *
+ * @return @c false if the CSV file or its index cannot be written, or if the
+ *         conversion was cancelled.
+ */
+bool CSV::Recording::convertToCsv(
+    const QString &csvPath, const std::function<bool(int)> &progress) const
+{
+  if (!isLoaded())
+    return false;
+
+  QSaveFile file(csvPath);
+  if (!file.open(QIODevice::WriteOnly))
+    return false;
+
+  // Write the title row
+  QStringList titles(m_channels);
+  for (int c = 0; c < columns(); ++c)
+    titles[m_indexes[c] - 1] = m_titles[c];
+
+  QByteArray buffer("\xEF\xBB\xBF" "RX Date/Time");
+  for (const auto &title : std::as_const(titles))
+    buffer.append(',').append(title.toUtf8());
+
+  buffer.append('\n');
+
+  // Write the data rows, indexing them as they are written
+  Index index;
+  int percent = 0;
+  qint64 offset = 0;
+  qint64 lastTime = 0;
+  QByteArray timestamp;
+  index.reset(m_channels);
+  std::vector<double> values(m_channels);
+  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+  for (qint64 row = 0; row < m_rows; ++row)
+  {
+    // Format the date/time only when it changes
+    const auto msecs = time(row);
+    const auto dateTime = QDateTime::fromMSecsSinceEpoch(msecs);
+    if (row == 0 || msecs != lastTime)
+    {
+      lastTime = msecs;
+      timestamp = dateTime.toString(format).toUtf8();
+    }
+
+    // Register the row
+    if (index.startsBlock())
+      index.beginBlock(offset + buffer.size(), Index::localMSecs(dateTime));
+
+    index.appendRow();
+
+    // Place the values by dataset index
+    std::fill(values.begin(), values.end(),
+              std::numeric_limits<double>::quiet_NaN());
+    for (int c = 0; c < columns(); ++c)
+      values[m_indexes[c] - 1] = value(row, c);
+
+    // Write the values
+    buffer.append(timestamp);
+    for (int c = 0; c < m_channels; ++c)
+    {
+      buffer.append(',');
+      const auto v = values[c];
+      if (!std::isnan(v))
+      {
+        index.addValue(c, v);
+        buffer.append(
+            QByteArray::number(v, 'g', QLocale::FloatingPointShortest));
+      }
+    }
+
+    buffer.append('\n');
+
+    // Write the buffer to the file in large chunks
+    if (buffer.size() >= 1 << 20 || row == m_rows - 1)
+    {
+      if (file.write(buffer) != buffer.size())
+        return false;
+
+      offset += buffer.size();
+      buffer.clear();
+    }
+
+    // Report progress
+    const auto done = static_cast<int>((row + 1) * 100 / m_rows);
+    if (progress && done > percent)
+    {
+      percent = done;
+      if (!progress(percent))
+        return false;
+    }
+  }
+
+  // Write the title row of an empty recording
+  if (m_rows == 0 && file.write(buffer) != buffer.size())
+    return false;
+
+  // Save the CSV file & its index
+  return file.commit() && index.save(csvPath, QFileInfo(csvPath).size());
+}
+
+/**
+ * @brief Returns @c true if @a path refers to a recording (*.ssrec) file.
+ */
+bool CSV::Recording::isRecording(const QString &path)
+{
+  return path.endsWith(QStringLiteral(".ssrec"), Qt::CaseInsensitive);
+}
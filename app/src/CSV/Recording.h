@@ -0,0 +1,114 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <vector>
+#include <functional>
+
+#include <QFile>
+#include <QPair>
+#include <QVector>
+#include <QJsonObject>
+#include <QStringList>
+
+#include "JSON/Frame.h"
+
+namespace CSV
+{
+/**
+ * @class CSV::Recording
+ * @brief Compact binary alternative to CSV recordings (*.ssrec files).
+ *
+ * A recording starts with a header that holds the frame structure of the
+ * project and the list of data columns, followed by blocks of up to
+ * kBlockRows rows. Each block stores its rows column by column: first the
+ * time of every row (milliseconds since the epoch, as int64), then every
+ * value of the first data column (as float64), then every value of the second
+ * one, and so on. Values that are not numeric are stored as NaN.
+ *
+ * Rows are appended without formatting any text, and the column-major layout
+ * keeps similar values together, so blocks compress well with general-purpose
+ * tools. A block is written every time the buffered rows are flushed, so a
+ * recording that was not closed properly loses at most the unflushed rows.
+ *
+ * Each data column records the dataset index it was taken from, so that
+ * recordings that leave out some datasets are replayed into the right ones.
+ *
+ * CSV::Export writes recordings through open(), appendRow(), flush() and
+ * close(). CSV::Player replays them by attaching the mapped file with load(),
+ * and convertToCsv() turns them into regular CSV files (with their index).
+ */
+class Recording
+{
+public:
+  static constexpr int kBlockRows = 1024;
+
+  Recording();
+  ~Recording();
+
+  [[nodiscard]] bool isOpen() const;
+  bool open(const QString &path, const JSON::Frame &frame,
+            const QVector<QPair<int, QString>> &columns);
+  void appendRow(const qint64 msecs, const double *values);
+  void flush();
+  void close();
+
+  [[nodiscard]] bool isLoaded() const;
+  [[nodiscard]] qint64 rows() const;
+  [[nodiscard]] int columns() const;
+  [[nodiscard]] int channels() const;
+  [[nodiscard]] int datasetIndex(const int column) const;
+  [[nodiscard]] QStringList titles() const;
+  [[nodiscard]] const QJsonObject &frame() const;
+  [[nodiscard]] qint64 time(const qint64 row) const;
+  [[nodiscard]] double value(const qint64 row, const int column) const;
+
+  bool load(const uchar *data, const qint64 size);
+  void unload();
+
+  bool convertToCsv(const QString &csvPath,
+                    const std::function<bool(int)> &progress = {}) const;
+
+  [[nodiscard]] static bool isRecording(const QString &path);
+
+private:
+  void writeBlock();
+  [[nodiscard]] qsizetype blockOf(const qint64 row) const;
+
+private:
+  QFile m_file;
+  int m_columns;
+  int m_pendingRows;
+  QByteArray m_block;
+  std::vector<qint64> m_times;
+  std::vector<double> m_values;
+
+  qint64 m_rows;
+  int m_channels;
+  const uchar *m_data;
+  QJsonObject m_frame;
+  QStringList m_titles;
+  std::vector<int> m_indexes;
+  std::vector<qint64> m_blockRows;
+  std::vector<qint64> m_blockOffsets;
+};
+} // namespace CSV
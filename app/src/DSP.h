@@ -27,16 +27,37 @@
 #include <QVector>
 #include <QVector3D>
 
+#include <bit>
+#include <new>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <cstdlib>
 
+#include <span>
+#include <array>
 #include <memory>
 #include <vector>
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)                \
+    || defined(_M_IX86)
+#  define DSP_SIMD_X86
+#  include <immintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  endif
+#endif
+
+#if defined(DSP_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#  define DSP_TARGET(isa) __attribute__((target(isa)))
+#else
+#  define DSP_TARGET(isa)
+#endif
+
 namespace DSP
 {
 //------------------------------------------------------------------------------
@@ -50,6 +71,11 @@ namespace DSP
  * Once full, new elements overwrite the oldest ones. Internally backed by
  * a shared pointer to a heap-allocated array.
  *
+ * The underlying array is rounded up to a power-of-two size, so that ring
+ * positions are wrapped with a bit mask instead of a modulo. Only the
+ * logical capacity is used to store elements. Code that walks the raw buffer
+ * must therefore wrap indexes with mask(), not with capacity().
+ *
  * @tparam T Type of elements stored in the queue.
  */
 template<typename T>
@@ -62,12 +88,39 @@ public:
    */
   explicit FixedQueue(std::size_t capacity = 100)
     : m_capacity(capacity)
-    , m_data(std::shared_ptr<T[]>(new T[capacity]))
+    , m_mask(storageSize(capacity) - 1)
+    , m_data(std::shared_ptr<T[]>(new T[m_mask + 1]))
+    , m_start(0)
+    , m_size(0)
+  {
+  }
+
+  /**
+   * @brief Constructs a FixedQueue over externally allocated storage.
+   *
+   * Used to place several queues in a single allocation (see SeriesStore).
+   *
+   * @param capacity Maximum number of elements the queue can hold.
+   * @param storage Array of at least storageSize(capacity) elements.
+   */
+  FixedQueue(std::size_t capacity, std::shared_ptr<T[]> storage)
+    : m_capacity(capacity)
+    , m_mask(storageSize(capacity) - 1)
+    , m_data(std::move(storage))
     , m_start(0)
     , m_size(0)
   {
   }
 
+  /**
+   * @brief Returns the number of elements allocated for a given capacity,
+   *        which is the next power of two.
+   */
+  [[nodiscard]] static constexpr std::size_t storageSize(std::size_t capacity)
+  {
+    return std::bit_ceil(std::max<std::size_t>(capacity, 1));
+  }
+
   /**
    * @brief Copy constructor.
    *
@@ -150,6 +203,16 @@ public:
    */
   [[nodiscard]] std::size_t capacity() const { return m_capacity; }
 
+  /**
+   * @brief Returns the mask used to wrap indexes into the internal buffer.
+   *
+   * The internal buffer holds mask() + 1 elements, so the raw index that
+   * follows @c i is `(i + 1) & mask()`.
+   *
+   * @return Size of the internal buffer minus one.
+   */
+  [[nodiscard]] std::size_t mask() const { return m_mask; }
+
   /**
    * @brief Checks whether the queue is full.
    * @return True if the queue is full.
@@ -296,12 +359,14 @@ public:
     if (newCapacity == m_capacity)
       return;
 
-    std::shared_ptr<T[]> newData(new T[newCapacity]);
+    const auto newMask = storageSize(newCapacity) - 1;
+    std::shared_ptr<T[]> newData(new T[newMask + 1]);
     std::size_t elementsToCopy = std::min(m_size, newCapacity);
     for (std::size_t i = 0; i < elementsToCopy; ++i)
       newData[i] = std::move((*this)[m_size - elementsToCopy + i]);
 
     m_start = 0;
+    m_mask = newMask;
     m_size = elementsToCopy;
     m_capacity = newCapacity;
     m_data = std::move(newData);
@@ -312,7 +377,7 @@ private:
    * @brief Computes the index where the next element will be inserted.
    * @return Index in the underlying array.
    */
-  std::size_t endIndex() const { return (m_start + m_size) % m_capacity; }
+  std::size_t endIndex() const { return (m_start + m_size) & m_mask; }
 
   /**
    * @brief Computes the actual buffer index for a logical element index.
@@ -321,7 +386,7 @@ private:
    */
   std::size_t wrappedIndex(std::size_t index) const
   {
-    return (m_start + index) % m_capacity;
+    return (m_start + index) & m_mask;
   }
 
   /**
@@ -333,11 +398,12 @@ private:
     if (m_size < m_capacity)
       ++m_size;
     else
-      m_start = (m_start + 1) % m_capacity;
+      m_start = (m_start + 1) & m_mask;
   }
 
 private:
   std::size_t m_capacity;      ///< Maximum number of elements.
+  std::size_t m_mask;          ///< Internal buffer size minus one.
   std::shared_ptr<T[]> m_data; ///< Shared pointer to the internal buffer.
   std::size_t m_start;         ///< Index of the oldest element.
   std::size_t m_size;          ///< Current number of elements.
@@ -363,6 +429,341 @@ typedef FixedQueue<double> AxisData;
  */
 typedef std::vector<AxisData> MultiPlotDataY;
 
+//------------------------------------------------------------------------------
+// Multi-resolution min/max index
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Incremental min/max summary of a ring buffer of doubles.
+ *
+ * The ring storage is split into blocks of (up to) 64 samples. Each block
+ * keeps the position and value of its smallest and largest finite sample,
+ * and a binary tree over the blocks merges these summaries up to the root.
+ *
+ * Writing a sample only rescans its own block and walks up the tree, which
+ * is O(block + log n). The extrema of any range are obtained by scanning the
+ * (partial) blocks at its edges and merging at most O(log n) tree nodes, so
+ * a plot can find the first/min/max/last points of every screen column
+ * without visiting the whole history.
+ *
+ * The summary reads the ring storage directly: it must be updated every time
+ * a position of the buffer is written (see SeriesStore::push()).
+ */
+class MinMaxPyramid
+{
+public:
+  /**
+   * @brief Extrema of a range of samples.
+   *
+   * Positions are physical indexes when returned by query(), and logical
+   * indexes (0 = oldest sample) when returned by extrema(). If the range has
+   * no finite samples, @c min is +inf and @c max is -inf.
+   */
+  struct Node
+  {
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    std::size_t minI = 0;
+    std::size_t maxI = 0;
+
+    [[nodiscard]] bool empty() const { return min > max; }
+  };
+
+  /**
+   * @brief Builds the summary of a ring buffer of @p storage elements.
+   *
+   * @param data    Pointer to the ring storage, which must outlive the index.
+   * @param storage Number of elements in the storage (a power of two).
+   */
+  void reset(const double *data, std::size_t storage)
+  {
+    m_data = data;
+    m_shift = std::min<unsigned>(kBlockShift, std::countr_zero(storage));
+    m_leaves = storage >> m_shift;
+    m_nodes.assign(2 * m_leaves, Node());
+
+    for (std::size_t b = 0; b < m_leaves; ++b)
+      m_nodes[m_leaves + b] = scan(b << m_shift, (b + 1) << m_shift);
+
+    for (std::size_t i = m_leaves - 1; i >= 1; --i)
+      m_nodes[i] = merge(m_nodes[2 * i], m_nodes[2 * i + 1]);
+  }
+
+  /**
+   * @brief Refreshes the summary after the sample at physical position
+   *        @p pos has been written.
+   */
+  void update(std::size_t pos)
+  {
+    const std::size_t block = pos >> m_shift;
+    std::size_t node = m_leaves + block;
+    m_nodes[node] = scan(block << m_shift, (block + 1) << m_shift);
+
+    for (node >>= 1; node >= 1; node >>= 1)
+      m_nodes[node] = merge(m_nodes[2 * node], m_nodes[2 * node + 1]);
+  }
+
+  /**
+   * @brief Returns the extrema of the physical range [begin, end).
+   *
+   * The range must not wrap around the end of the storage.
+   */
+  [[nodiscard]] Node query(std::size_t begin, std::size_t end) const
+  {
+    // Small ranges that do not cover a whole block are scanned directly
+    const std::size_t firstBlock = (begin + blockSize() - 1) >> m_shift;
+    const std::size_t lastBlock = end >> m_shift;
+    if (firstBlock >= lastBlock)
+      return scan(begin, end);
+
+    // Scan the partial blocks at both edges of the range
+    Node result = scan(begin, firstBlock << m_shift);
+    result = merge(result, scan(lastBlock << m_shift, end));
+
+    // Merge the tree nodes that cover the whole blocks in between
+    std::size_t l = m_leaves + firstBlock;
+    std::size_t r = m_leaves + lastBlock;
+    for (; l < r; l >>= 1, r >>= 1)
+    {
+      if (l & 1)
+        result = merge(result, m_nodes[l++]);
+      if (r & 1)
+        result = merge(result, m_nodes[--r]);
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Returns the extrema of the logical range [begin, end) of @p q,
+   *        with logical result indexes.
+   *
+   * @p q must be the ring buffer that this index was built for.
+   */
+  [[nodiscard]] Node extrema(const AxisData &q, std::size_t begin,
+                             std::size_t end) const
+  {
+    const std::size_t storage = q.mask() + 1;
+    const std::size_t front = q.frontIndex();
+    const std::size_t p0 = (front + begin) & q.mask();
+    const std::size_t count = end - begin;
+
+    // Query the range, splitting it in two if it wraps around
+    Node result;
+    if (p0 + count <= storage)
+      result = query(p0, p0 + count);
+    else
+      result = merge(query(p0, storage), query(0, p0 + count - storage));
+
+    // Convert physical positions into logical indexes
+    result.minI = (result.minI - front) & q.mask();
+    result.maxI = (result.maxI - front) & q.mask();
+    return result;
+  }
+
+  /**
+   * @brief Returns the ring storage that this index summarizes.
+   */
+  [[nodiscard]] const double *data() const { return m_data; }
+
+private:
+  static constexpr unsigned kBlockShift = 6;
+
+  [[nodiscard]] std::size_t blockSize() const
+  {
+    return std::size_t(1) << m_shift;
+  }
+
+  /**
+   * @brief Computes the extrema of the physical range [begin, end) by
+   *        visiting every sample.
+   */
+  [[nodiscard]] Node scan(std::size_t begin, std::size_t end) const
+  {
+    Node node;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const double v = m_data[i];
+      if (!std::isfinite(v))
+        continue;
+
+      if (v < node.min)
+      {
+        node.min = v;
+        node.minI = i;
+      }
+
+      if (v > node.max)
+      {
+        node.max = v;
+        node.maxI = i;
+      }
+    }
+
+    return node;
+  }
+
+  /**
+   * @brief Combines the extrema of two ranges.
+   */
+  [[nodiscard]] static Node merge(const Node &a, const Node &b)
+  {
+    Node node = a;
+    if (b.min < node.min)
+    {
+      node.min = b.min;
+      node.minI = b.minI;
+    }
+
+    if (b.max > node.max)
+    {
+      node.max = b.max;
+      node.maxI = b.maxI;
+    }
+
+    return node;
+  }
+
+private:
+  unsigned m_shift = 0;           ///< log2 of the block size
+  std::size_t m_leaves = 0;       ///< Number of blocks
+  const double *m_data = nullptr; ///< Summarized ring storage
+  std::vector<Node> m_nodes;      ///< Implicit tree, leaves at the end
+};
+
+//------------------------------------------------------------------------------
+// Columnar series storage
+//------------------------------------------------------------------------------
+
+/**
+ * @brief A set of equally sized series (columns) stored in a single arena.
+ *
+ * Every column is an AxisData ring whose buffer is a slice of one contiguous,
+ * cache-line aligned allocation, instead of a separate heap block per series.
+ * Slices are power-of-two sized, so each column starts on a cache line and
+ * ring positions are wrapped with a mask.
+ *
+ * Columns keep their own read/write positions, so they can be appended to
+ * individually with push() (e.g. when a plot is paused) or all at once with
+ * appendRow(). Both keep a MinMaxPyramid per column up to date, so plots can
+ * be downsampled without walking the whole history. Columns are therefore
+ * read-only from the outside.
+ *
+ * The arena is reference counted: copies of a column (or of the store) share
+ * the underlying memory, which stays valid until the last copy is released.
+ */
+class SeriesStore
+{
+public:
+  /**
+   * @brief Allocates @p columns series that hold up to @p capacity samples.
+   *
+   * Existing columns are released.
+   */
+  void allocate(std::size_t columns, std::size_t capacity)
+  {
+    clear();
+    if (columns == 0)
+      return;
+
+    // Allocate a single aligned block for all the columns
+    constexpr std::align_val_t align{64};
+    const auto stride = AxisData::storageSize(capacity);
+    auto *block = static_cast<double *>(
+        ::operator new[](columns * stride * sizeof(double), align));
+    std::shared_ptr<double[]> arena(block, [](double *p) {
+      ::operator delete[](p, std::align_val_t{64});
+    });
+    std::fill_n(block, columns * stride, 0.0);
+
+    // Create a ring view & a min/max index over each slice of the arena
+    m_columns.reserve(columns);
+    m_pyramids.resize(columns);
+    for (std::size_t i = 0; i < columns; ++i)
+    {
+      std::shared_ptr<double[]> slice(arena, block + i * stride);
+      m_columns.emplace_back(capacity, std::move(slice));
+      m_pyramids[i].reset(m_columns[i].raw(), stride);
+    }
+  }
+
+  /**
+   * @brief Releases all columns.
+   */
+  void clear()
+  {
+    m_columns.clear();
+    m_pyramids.clear();
+    m_columns.shrink_to_fit();
+    m_pyramids.shrink_to_fit();
+  }
+
+  /**
+   * @brief Fills every column with @p value, leaving them full.
+   */
+  void fill(double value)
+  {
+    for (std::size_t i = 0; i < m_columns.size(); ++i)
+    {
+      m_columns[i].fill(value);
+      m_pyramids[i].reset(m_columns[i].raw(), m_columns[i].mask() + 1);
+    }
+  }
+
+  /**
+   * @brief Appends one sample to the column at @p index.
+   */
+  void push(std::size_t index, double value)
+  {
+    auto &column = m_columns[index];
+    column.push(value);
+    m_pyramids[index].update((column.frontIndex() + column.size() - 1)
+                             & column.mask());
+  }
+
+  /**
+   * @brief Appends one sample to every column.
+   *
+   * @param row Array with one value per column.
+   */
+  void appendRow(const double *row)
+  {
+    const std::size_t count = m_columns.size();
+    for (std::size_t i = 0; i < count; ++i)
+      push(i, row[i]);
+  }
+
+  /**
+   * @brief Returns the number of columns.
+   */
+  [[nodiscard]] std::size_t size() const { return m_columns.size(); }
+
+  /**
+   * @brief Returns @c true if no columns are allocated.
+   */
+  [[nodiscard]] bool empty() const { return m_columns.empty(); }
+
+  /**
+   * @brief Returns the column at @p index.
+   */
+  [[nodiscard]] const AxisData &operator[](std::size_t index) const
+  {
+    return m_columns[index];
+  }
+
+  /**
+   * @brief Returns the min/max index of the column at @p index.
+   */
+  [[nodiscard]] const MinMaxPyramid &pyramid(std::size_t index) const
+  {
+    return m_pyramids[index];
+  }
+
+private:
+  std::vector<AxisData> m_columns;       ///< Ring views over the shared arena
+  std::vector<MinMaxPyramid> m_pyramids; ///< Min/max index of each column
+};
+
 //------------------------------------------------------------------------------
 // Composite Data Structures
 //------------------------------------------------------------------------------
@@ -377,11 +778,15 @@ typedef std::vector<AxisData> MultiPlotDataY;
  *
  * This type simplifies data processing by tightly coupling the related X and Y
  * data for a plot, ensuring that they are always accessed and managed together.
+ *
+ * When the Y data lives in a SeriesStore, `yIndex` points to its min/max index
+ * so that the plot can be downsampled without visiting every sample.
  */
 typedef struct
 {
-  AxisData *x; ///< X-axis data (e.g., time or samples)
-  AxisData *y; ///< Y-axis data (e.g., sensor readings)
+  const AxisData *x;                     ///< X-axis data (e.g., time)
+  const AxisData *y;                     ///< Y-axis data (e.g., readings)
+  const MinMaxPyramid *yIndex = nullptr; ///< Optional min/max index of Y
 } LineSeries;
 
 /**
@@ -392,23 +797,182 @@ typedef struct
  * sensors or variables are plotted against the same time base or domain.
  *
  * - `x`: Pointer to the shared X-axis data (e.g., time).
- * - `y`: A list of Y-axis data vectors, where each entry represents one curve.
+ * - `y`: One column per curve, stored in a single arena so that a whole frame
+ *        can be appended with SeriesStore::appendRow().
  *
  * All Y-series are expected to align with the length and indexing of the
  * shared X-axis.
  */
 typedef struct
 {
-  AxisData *x;             ///< Shared X-axis data (e.g., time or index)
-  std::vector<AxisData> y; ///< Y-axis data for each individual curve
+  const AxisData *x; ///< Shared X-axis data (e.g., time or index)
+  SeriesStore y;     ///< Y-axis data for each individual curve
 } MultiLineSeries;
 
 #ifdef BUILD_COMMERCIAL
 /**
- * @typedef PlotData3D
- * @brief Represents a list of 3D points.
+ * @brief A fixed-capacity trajectory of 3D points.
+ *
+ * The X, Y and Z coordinates are stored as three columns of a SeriesStore,
+ * so appending a point overwrites the oldest one in constant time instead of
+ * shifting the whole history, and the bounds of the points that are
+ * currently in the window are obtained from the min/max index of each
+ * column without visiting every point.
+ *
+ * Each column is exposed as (up to) two contiguous spans, oldest first, so
+ * that the renderer can copy the points without going through the ring
+ * index of every element. Renderers that mirror the ring slot by slot can
+ * use pushed() to find out how many points were appended since they last
+ * looked at the series.
  */
-typedef std::vector<QVector3D> LineSeries3D;
+class LineSeries3D
+{
+public:
+  /**
+   * @brief Allocates storage for up to @p capacity points, discarding the
+   *        current ones.
+   */
+  void allocate(std::size_t capacity)
+  {
+    m_pushed = 0;
+    m_store.allocate(3, capacity);
+  }
+
+  /**
+   * @brief Releases all points and their storage.
+   */
+  void clear()
+  {
+    m_pushed = 0;
+    m_store.clear();
+  }
+
+  /**
+   * @brief Appends a point, overwriting the oldest one if the series is
+   *        full.
+   */
+  void push(const QVector3D &point)
+  {
+    if (m_store.empty()) [[unlikely]]
+      return;
+
+    const double row[3] = {point.x(), point.y(), point.z()};
+    m_store.appendRow(row);
+    ++m_pushed;
+  }
+
+  /**
+   * @brief Returns the number of points appended since the series was
+   *        allocated, including the ones that were already overwritten.
+   */
+  [[nodiscard]] std::uint64_t pushed() const { return m_pushed; }
+
+  /**
+   * @brief Returns the number of slots of the ring (a power of two), or zero
+   *        if the series is not allocated.
+   */
+  [[nodiscard]] std::size_t slots() const
+  {
+    return m_store.empty() ? 0 : m_store[0].mask() + 1;
+  }
+
+  /**
+   * @brief Returns the ring slot of the oldest point.
+   */
+  [[nodiscard]] std::size_t frontSlot() const
+  {
+    return m_store.empty() ? 0 : m_store[0].frontIndex();
+  }
+
+  /**
+   * @brief Returns the point stored in ring slot @p slot.
+   */
+  [[nodiscard]] QVector3D at(std::size_t slot) const
+  {
+    return QVector3D(m_store[0].raw()[slot], m_store[1].raw()[slot],
+                     m_store[2].raw()[slot]);
+  }
+
+  /**
+   * @brief Returns the number of points in the series.
+   */
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_store.empty() ? 0 : m_store[0].size();
+  }
+
+  /**
+   * @brief Returns @c true if the series has no points.
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the contiguous parts of the X (0), Y (1) or Z (2) column,
+   *        from oldest to newest. The second span is empty if the column
+   *        does not wrap around the end of its storage.
+   */
+  [[nodiscard]] std::array<std::span<const double>, 2>
+  spans(std::size_t axis) const
+  {
+    if (m_store.empty())
+      return {};
+
+    const auto &column = m_store[axis];
+    const std::size_t storage = column.mask() + 1;
+    const std::size_t front = column.frontIndex();
+    const std::size_t first = std::min(column.size(), storage - front);
+    return {std::span<const double>(column.raw() + front, first),
+            std::span<const double>(column.raw(), column.size() - first)};
+  }
+
+  /**
+   * @brief Copies the points, from oldest to newest, into @p points.
+   */
+  void copyTo(std::vector<QVector3D> &points) const
+  {
+    points.resize(size());
+    if (points.empty())
+      return;
+
+    const auto x = spans(0);
+    const auto y = spans(1);
+    const auto z = spans(2);
+    const std::size_t split = x[0].size();
+    for (std::size_t i = 0; i < split; ++i)
+      points[i] = QVector3D(x[0][i], y[0][i], z[0][i]);
+    for (std::size_t i = 0; i < x[1].size(); ++i)
+      points[split + i] = QVector3D(x[1][i], y[1][i], z[1][i]);
+  }
+
+  /**
+   * @brief Obtains the bounding box of the finite coordinates of the points
+   *        that are currently in the series.
+   *
+   * @return @c false if the series has no finite coordinates.
+   */
+  bool bounds(QVector3D &min, QVector3D &max) const
+  {
+    const std::size_t count = size();
+    if (count == 0)
+      return false;
+
+    for (int i = 0; i < 3; ++i)
+    {
+      const auto e = m_store.pyramid(i).extrema(m_store[i], 0, count);
+      if (e.empty())
+        return false;
+
+      min[i] = static_cast<float>(e.min);
+      max[i] = static_cast<float>(e.max);
+    }
+
+    return true;
+  }
+
+private:
+  SeriesStore m_store;        ///< X, Y and Z columns
+  std::uint64_t m_pushed = 0; ///< Points appended since allocate()
+};
 #endif
 
 /**
@@ -478,6 +1042,12 @@ struct DownsampleWorkspace
   std::vector<std::size_t> firstI;
   std::vector<std::size_t> lastI;
 
+  // Column index of each sample in the block being bucketed
+  std::vector<int> col;
+
+  // Vertical scale of each curve (multi-series downsampling)
+  std::vector<double> curveScale;
+
   /**
    * @brief Prepare the workspace for a render pass with C columns.
    *
@@ -554,7 +1124,7 @@ inline void spanFromFixedQueue(const AxisData &q, const double *&p0,
   const double *base = q.raw();
 
   const std::size_t n = q.size();
-  const std::size_t cap = q.capacity();
+  const std::size_t cap = q.mask() + 1;
   const std::size_t i0 = q.frontIndex();
   const std::size_t tail = std::min<std::size_t>(n, cap - i0);
 
@@ -565,12 +1135,756 @@ inline void spanFromFixedQueue(const AxisData &q, const double *&p0,
   n1 = n - tail;
 }
 
-//------------------------------------------------------------------------------
-// Downsample 2D series into screen-space pixels
-//------------------------------------------------------------------------------
-
 /**
- * @brief Downsample a 2D series (X,Y) into screen-space pixels, preserving
+ * @brief Visit the logical range [begin, end) of two ring-buffered queues as
+ *        pairs of contiguous spans.
+ *
+ * X and Y may start at different positions of their buffers (or have buffers
+ * of different sizes), so the range is split at every point where either of
+ * them wraps around. For each piece, @p fn is called as:
+ *
+ * ```
+ * fn(const double *x, const double *y, std::size_t index, std::size_t count)
+ * ```
+ *
+ * where @c index is the logical index of the first element of the piece.
+ * The range is covered by at most three pieces.
+ *
+ * @param X     First ring buffer
+ * @param Y     Second ring buffer
+ * @param begin First logical index to visit
+ * @param end   One past the last logical index (at most the size of X and Y)
+ * @param fn    Callback invoked for each pair of spans
+ */
+template<typename Function>
+inline void forEachSpanPair(const AxisData &X, const AxisData &Y,
+                            std::size_t begin, std::size_t end, Function &&fn)
+{
+  const double *xb = X.raw();
+  const double *yb = Y.raw();
+  for (std::size_t i = begin; i < end;)
+  {
+    const std::size_t xp = (X.frontIndex() + i) & X.mask();
+    const std::size_t yp = (Y.frontIndex() + i) & Y.mask();
+    const std::size_t count
+        = std::min({end - i, X.mask() + 1 - xp, Y.mask() + 1 - yp});
+
+    fn(xb + xp, yb + yp, i, count);
+    i += count;
+  }
+}
+
+//------------------------------------------------------------------------------
+// SIMD kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Instruction set used by the vectorized kernels below.
+ */
+enum class SimdLevel
+{
+  Scalar, ///< Portable C++ loops
+  SSE41,  ///< 128-bit SSE4.1 kernels
+  AVX2    ///< 256-bit AVX2 kernels
+};
+
+/**
+ * @brief Queries the CPU for the best supported SimdLevel.
+ */
+inline SimdLevel detectSimdLevel()
+{
+#if defined(DSP_SIMD_X86) && defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  const int leaves = info[0];
+  __cpuid(info, 1);
+  const bool sse41 = info[2] & (1 << 19);
+  const bool osxsave = info[2] & (1 << 27);
+  const bool avx = info[2] & (1 << 28);
+
+  bool avx2 = false;
+  if (leaves >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6)
+  {
+    __cpuidex(info, 7, 0);
+    avx2 = info[1] & (1 << 5);
+  }
+
+  if (avx2)
+    return SimdLevel::AVX2;
+  if (sse41)
+    return SimdLevel::SSE41;
+
+  return SimdLevel::Scalar;
+#elif defined(DSP_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return SimdLevel::AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return SimdLevel::SSE41;
+
+  return SimdLevel::Scalar;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+/**
+ * @brief Returns the SimdLevel used by the kernels, detected once per process.
+ */
+inline SimdLevel simdLevel()
+{
+  static const SimdLevel level = detectSimdLevel();
+  return level;
+}
+
+/**
+ * @brief Smallest and largest finite values seen by a kernel.
+ *
+ * Kernels accumulate into an existing Extent, so a range split across several
+ * spans can be measured with one call per span.
+ */
+struct Extent
+{
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+
+  [[nodiscard]] bool empty() const { return min > max; }
+
+  void add(double v)
+  {
+    if (v < min)
+      min = v;
+    if (v > max)
+      max = v;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Scalar kernels (reference implementation & tail handling)
+//------------------------------------------------------------------------------
+
+inline void finiteExtentScalar(const double *x, const double *y, std::size_t n,
+                               Extent &ex, Extent &ey)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    if (!std::isfinite(x[i]) || !std::isfinite(y[i]))
+      continue;
+
+    ex.add(x[i]);
+    ey.add(y[i]);
+  }
+}
+
+inline void pointExtentScalar(const QPointF *p, std::size_t n, Extent &ex,
+                              Extent &ey)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    if (std::isfinite(p[i].x()))
+      ex.add(p[i].x());
+    if (std::isfinite(p[i].y()))
+      ey.add(p[i].y());
+  }
+}
+
+inline void scaleWindowScalar(const double *in, std::size_t n, double offset,
+                              double scale, const float *window, float *out)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const auto v = static_cast<float>((in[i] + offset) * scale);
+    out[i] = v * window[i];
+  }
+}
+
+inline void interleaveScalar(const double *x, const double *y, std::size_t n,
+                             QPointF *out)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    out[i].setX(x[i]);
+    out[i].setY(y[i]);
+  }
+}
+
+inline void columnIndexesScalar(const double *x, std::size_t n, double xmin,
+                                double scale, int w, int *cols)
+{
+  const auto last = static_cast<double>(w - 1);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    double c = (x[i] - xmin) * scale;
+    c = c > 0 ? c : 0;
+    c = c < last ? c : last;
+    cols[i] = static_cast<int>(c);
+  }
+}
+
+#ifdef DSP_SIMD_X86
+//------------------------------------------------------------------------------
+// SSE4.1 kernels
+//------------------------------------------------------------------------------
+
+DSP_TARGET("sse4.1")
+inline void finiteExtentSSE41(const double *x, const double *y, std::size_t n,
+                              Extent &ex, Extent &ey)
+{
+  const __m128d zero = _mm_setzero_pd();
+  __m128d xmin = _mm_set1_pd(ex.min);
+  __m128d xmax = _mm_set1_pd(ex.max);
+  __m128d ymin = _mm_set1_pd(ey.min);
+  __m128d ymax = _mm_set1_pd(ey.max);
+
+  // v - v is zero for finite values and NaN for NaN/inf
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    const __m128d xv = _mm_loadu_pd(x + i);
+    const __m128d yv = _mm_loadu_pd(y + i);
+    const __m128d ok = _mm_and_pd(_mm_cmpeq_pd(_mm_sub_pd(xv, xv), zero),
+                                  _mm_cmpeq_pd(_mm_sub_pd(yv, yv), zero));
+
+    xmin = _mm_blendv_pd(xmin, _mm_min_pd(xmin, xv), ok);
+    xmax = _mm_blendv_pd(xmax, _mm_max_pd(xmax, xv), ok);
+    ymin = _mm_blendv_pd(ymin, _mm_min_pd(ymin, yv), ok);
+    ymax = _mm_blendv_pd(ymax, _mm_max_pd(ymax, yv), ok);
+  }
+
+  // Fold the lanes into the extents
+  double t[2];
+  _mm_storeu_pd(t, xmin);
+  ex.min = std::min(t[0], t[1]);
+  _mm_storeu_pd(t, xmax);
+  ex.max = std::max(t[0], t[1]);
+  _mm_storeu_pd(t, ymin);
+  ey.min = std::min(t[0], t[1]);
+  _mm_storeu_pd(t, ymax);
+  ey.max = std::max(t[0], t[1]);
+
+  finiteExtentScalar(x + i, y + i, n - i, ex, ey);
+}
+
+DSP_TARGET("sse4.1")
+inline void pointExtentSSE41(const QPointF *p, std::size_t n, Extent &ex,
+                             Extent &ey)
+{
+  // Each register holds one (x, y) pair
+  const auto *d = reinterpret_cast<const double *>(p);
+  const __m128d zero = _mm_setzero_pd();
+  __m128d min = _mm_set_pd(ey.min, ex.min);
+  __m128d max = _mm_set_pd(ey.max, ex.max);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const __m128d v = _mm_loadu_pd(d + 2 * i);
+    const __m128d ok = _mm_cmpeq_pd(_mm_sub_pd(v, v), zero);
+    min = _mm_blendv_pd(min, _mm_min_pd(min, v), ok);
+    max = _mm_blendv_pd(max, _mm_max_pd(max, v), ok);
+  }
+
+  double lo[2], hi[2];
+  _mm_storeu_pd(lo, min);
+  _mm_storeu_pd(hi, max);
+  ex.min = lo[0];
+  ex.max = hi[0];
+  ey.min = lo[1];
+  ey.max = hi[1];
+}
+
+DSP_TARGET("sse4.1")
+inline void scaleWindowSSE41(const double *in, std::size_t n, double offset,
+                             double scale, const float *window, float *out)
+{
+  const __m128d off = _mm_set1_pd(offset);
+  const __m128d mul = _mm_set1_pd(scale);
+
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    // Normalize in double precision, then window in single precision
+    const __m128 a = _mm_cvtpd_ps(
+        _mm_mul_pd(_mm_add_pd(_mm_loadu_pd(in + i), off), mul));
+    const __m128 b = _mm_cvtpd_ps(
+        _mm_mul_pd(_mm_add_pd(_mm_loadu_pd(in + i + 2), off), mul));
+    const __m128 v = _mm_mul_ps(_mm_movelh_ps(a, b), _mm_loadu_ps(window + i));
+    _mm_storeu_ps(out + i, v);
+  }
+
+  scaleWindowScalar(in + i, n - i, offset, scale, window + i, out + i);
+}
+
+DSP_TARGET("sse4.1")
+inline void interleaveSSE41(const double *x, const double *y, std::size_t n,
+                            QPointF *out)
+{
+  auto *d = reinterpret_cast<double *>(out);
+
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    const __m128d xv = _mm_loadu_pd(x + i);
+    const __m128d yv = _mm_loadu_pd(y + i);
+    _mm_storeu_pd(d + 2 * i, _mm_unpacklo_pd(xv, yv));
+    _mm_storeu_pd(d + 2 * i + 2, _mm_unpackhi_pd(xv, yv));
+  }
+
+  interleaveScalar(x + i, y + i, n - i, out + i);
+}
+
+DSP_TARGET("sse4.1")
+inline void columnIndexesSSE41(const double *x, std::size_t n, double xmin,
+                               double scale, int w, int *cols)
+{
+  const __m128d zero = _mm_setzero_pd();
+  const __m128d base = _mm_set1_pd(xmin);
+  const __m128d mul = _mm_set1_pd(scale);
+  const __m128d last = _mm_set1_pd(static_cast<double>(w - 1));
+
+  // _mm_max_pd() returns its second operand for NaN, so NaN maps to column 0
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128d c = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(x + i), base), mul);
+    c = _mm_min_pd(_mm_max_pd(c, zero), last);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(cols + i),
+                     _mm_cvttpd_epi32(c));
+  }
+
+  columnIndexesScalar(x + i, n - i, xmin, scale, w, cols + i);
+}
+
+//------------------------------------------------------------------------------
+// AVX2 kernels
+//------------------------------------------------------------------------------
+
+DSP_TARGET("avx2")
+inline void finiteExtentAVX2(const double *x, const double *y, std::size_t n,
+                             Extent &ex, Extent &ey)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  __m256d xmin = _mm256_set1_pd(ex.min);
+  __m256d xmax = _mm256_set1_pd(ex.max);
+  __m256d ymin = _mm256_set1_pd(ey.min);
+  __m256d ymax = _mm256_set1_pd(ey.max);
+
+  // v - v is zero for finite values and NaN for NaN/inf
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m256d xv = _mm256_loadu_pd(x + i);
+    const __m256d yv = _mm256_loadu_pd(y + i);
+    const __m256d xok = _mm256_cmp_pd(_mm256_sub_pd(xv, xv), zero, _CMP_EQ_OQ);
+    const __m256d yok = _mm256_cmp_pd(_mm256_sub_pd(yv, yv), zero, _CMP_EQ_OQ);
+    const __m256d ok = _mm256_and_pd(xok, yok);
+
+    xmin = _mm256_blendv_pd(xmin, _mm256_min_pd(xmin, xv), ok);
+    xmax = _mm256_blendv_pd(xmax, _mm256_max_pd(xmax, xv), ok);
+    ymin = _mm256_blendv_pd(ymin, _mm256_min_pd(ymin, yv), ok);
+    ymax = _mm256_blendv_pd(ymax, _mm256_max_pd(ymax, yv), ok);
+  }
+
+  // Fold the lanes into the extents
+  double t[4];
+  _mm256_storeu_pd(t, xmin);
+  ex.min = std::min({t[0], t[1], t[2], t[3]});
+  _mm256_storeu_pd(t, xmax);
+  ex.max = std::max({t[0], t[1], t[2], t[3]});
+  _mm256_storeu_pd(t, ymin);
+  ey.min = std::min({t[0], t[1], t[2], t[3]});
+  _mm256_storeu_pd(t, ymax);
+  ey.max = std::max({t[0], t[1], t[2], t[3]});
+
+  finiteExtentScalar(x + i, y + i, n - i, ex, ey);
+}
+
+DSP_TARGET("avx2")
+inline void pointExtentAVX2(const QPointF *p, std::size_t n, Extent &ex,
+                            Extent &ey)
+{
+  // Each register holds two (x, y) pairs
+  const auto *d = reinterpret_cast<const double *>(p);
+  const __m256d zero = _mm256_setzero_pd();
+  __m256d min = _mm256_set_pd(ey.min, ex.min, ey.min, ex.min);
+  __m256d max = _mm256_set_pd(ey.max, ex.max, ey.max, ex.max);
+
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    const __m256d v = _mm256_loadu_pd(d + 2 * i);
+    const __m256d ok = _mm256_cmp_pd(_mm256_sub_pd(v, v), zero, _CMP_EQ_OQ);
+    min = _mm256_blendv_pd(min, _mm256_min_pd(min, v), ok);
+    max = _mm256_blendv_pd(max, _mm256_max_pd(max, v), ok);
+  }
+
+  double lo[4], hi[4];
+  _mm256_storeu_pd(lo, min);
+  _mm256_storeu_pd(hi, max);
+  ex.min = std::min(lo[0], lo[2]);
+  ex.max = std::max(hi[0], hi[2]);
+  ey.min = std::min(lo[1], lo[3]);
+  ey.max = std::max(hi[1], hi[3]);
+
+  pointExtentScalar(p + i, n - i, ex, ey);
+}
+
+DSP_TARGET("avx2")
+inline void scaleWindowAVX2(const double *in, std::size_t n, double offset,
+                            double scale, const float *window, float *out)
+{
+  const __m256d off = _mm256_set1_pd(offset);
+  const __m256d mul = _mm256_set1_pd(scale);
+
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    // Normalize in double precision, then window in single precision
+    const __m256d v = _mm256_loadu_pd(in + i);
+    const __m128 s = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_add_pd(v, off), mul));
+    _mm_storeu_ps(out + i, _mm_mul_ps(s, _mm_loadu_ps(window + i)));
+  }
+
+  scaleWindowScalar(in + i, n - i, offset, scale, window + i, out + i);
+}
+
+DSP_TARGET("avx2")
+inline void interleaveAVX2(const double *x, const double *y, std::size_t n,
+                           QPointF *out)
+{
+  auto *d = reinterpret_cast<double *>(out);
+
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    // (x0 y0 x2 y2) and (x1 y1 x3 y3), then swap the middle halves
+    const __m256d xv = _mm256_loadu_pd(x + i);
+    const __m256d yv = _mm256_loadu_pd(y + i);
+    const __m256d lo = _mm256_unpacklo_pd(xv, yv);
+    const __m256d hi = _mm256_unpackhi_pd(xv, yv);
+    _mm256_storeu_pd(d + 2 * i, _mm256_permute2f128_pd(lo, hi, 0x20));
+    _mm256_storeu_pd(d + 2 * i + 4, _mm256_permute2f128_pd(lo, hi, 0x31));
+  }
+
+  interleaveScalar(x + i, y + i, n - i, out + i);
+}
+
+DSP_TARGET("avx2")
+inline void columnIndexesAVX2(const double *x, std::size_t n, double xmin,
+                              double scale, int w, int *cols)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d base = _mm256_set1_pd(xmin);
+  const __m256d mul = _mm256_set1_pd(scale);
+  const __m256d last = _mm256_set1_pd(static_cast<double>(w - 1));
+
+  // _mm256_max_pd() returns its second operand for NaN (column 0)
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256d c = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(x + i), base), mul);
+    c = _mm256_min_pd(_mm256_max_pd(c, zero), last);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(cols + i),
+                     _mm256_cvttpd_epi32(c));
+  }
+
+  columnIndexesScalar(x + i, n - i, xmin, scale, w, cols + i);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Kernel dispatch
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Measures the X and Y extents of the points where both are finite.
+ *
+ * @param x  X values
+ * @param y  Y values
+ * @param n  Number of points
+ * @param ex Extent of X, updated in place
+ * @param ey Extent of Y, updated in place
+ */
+inline void finiteExtent(const double *x, const double *y, std::size_t n,
+                         Extent &ex, Extent &ey)
+{
+#ifdef DSP_SIMD_X86
+  switch (simdLevel())
+  {
+    case SimdLevel::AVX2:
+      return finiteExtentAVX2(x, y, n, ex, ey);
+    case SimdLevel::SSE41:
+      return finiteExtentSSE41(x, y, n, ex, ey);
+    default:
+      break;
+  }
+#endif
+  finiteExtentScalar(x, y, n, ex, ey);
+}
+
+/**
+ * @brief Measures the extents of the finite coordinates of a point list.
+ *
+ * Unlike finiteExtent(), X and Y are validated independently.
+ */
+inline void pointExtent(const QPointF *p, std::size_t n, Extent &ex,
+                        Extent &ey)
+{
+#ifdef DSP_SIMD_X86
+  if constexpr (sizeof(QPointF) == 2 * sizeof(double))
+  {
+    switch (simdLevel())
+    {
+      case SimdLevel::AVX2:
+        return pointExtentAVX2(p, n, ex, ey);
+      case SimdLevel::SSE41:
+        return pointExtentSSE41(p, n, ex, ey);
+      default:
+        break;
+    }
+  }
+#endif
+  pointExtentScalar(p, n, ex, ey);
+}
+
+/**
+ * @brief Normalizes and windows real samples into a real FFT input.
+ *
+ * Computes `out[i] = float((in[i] + offset) * scale) * window[i]`.
+ */
+inline void scaleWindow(const double *in, std::size_t n, double offset,
+                        double scale, const float *window, float *out)
+{
+#ifdef DSP_SIMD_X86
+  switch (simdLevel())
+  {
+    case SimdLevel::AVX2:
+      return scaleWindowAVX2(in, n, offset, scale, window, out);
+    case SimdLevel::SSE41:
+      return scaleWindowSSE41(in, n, offset, scale, window, out);
+    default:
+      break;
+  }
+#endif
+  scaleWindowScalar(in, n, offset, scale, window, out);
+}
+
+/**
+ * @brief Interleaves separate X and Y arrays into a point list.
+ */
+inline void interleave(const double *x, const double *y, std::size_t n,
+                       QPointF *out)
+{
+#ifdef DSP_SIMD_X86
+  if constexpr (sizeof(QPointF) == 2 * sizeof(double))
+  {
+    switch (simdLevel())
+    {
+      case SimdLevel::AVX2:
+        return interleaveAVX2(x, y, n, out);
+      case SimdLevel::SSE41:
+        return interleaveSSE41(x, y, n, out);
+      default:
+        break;
+    }
+  }
+#endif
+  interleaveScalar(x, y, n, out);
+}
+
+/**
+ * @brief Maps X values to screen columns.
+ *
+ * Computes `(x - xmin) * scale`, clamped to [0, w - 1] and truncated. NaN
+ * values map to column 0, so callers must still skip non-finite points.
+ */
+inline void columnIndexes(const double *x, std::size_t n, double xmin,
+                          double scale, int w, int *cols)
+{
+#ifdef DSP_SIMD_X86
+  switch (simdLevel())
+  {
+    case SimdLevel::AVX2:
+      return columnIndexesAVX2(x, n, xmin, scale, w, cols);
+    case SimdLevel::SSE41:
+      return columnIndexesSSE41(x, n, xmin, scale, w, cols);
+    default:
+      break;
+  }
+#endif
+  columnIndexesScalar(x, n, xmin, scale, w, cols);
+}
+
+//------------------------------------------------------------------------------
+// Downsample 2D series into screen-space pixels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the element at logical index @p i of a ring buffer, without
+ *        bounds checking.
+ */
+inline double ringAt(const AxisData &q, std::size_t i)
+{
+  return q.raw()[(q.frontIndex() + i) & q.mask()];
+}
+
+/**
+ * @brief Finds the first logical index in [lo, hi) whose screen column is at
+ *        least @p c, assuming that X is monotonic.
+ */
+inline std::size_t columnStart(const AxisData &X, std::size_t lo,
+                               std::size_t hi, double xmin, double scaleX,
+                               std::size_t c)
+{
+  while (lo < hi)
+  {
+    const std::size_t mid = lo + (hi - lo) / 2;
+    if ((ringAt(X, mid) - xmin) * scaleX < static_cast<double>(c))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+/**
+ * @brief Appends the first/min/max/last points of the samples [begin, end)
+ *        of a series, in time order, using a min/max index of Y.
+ *
+ * Non-finite samples are skipped. The min/max points are only emitted if
+ * they are at least one pixel apart, given the vertical scale @p scaleY.
+ */
+inline void appendIndexedColumn(const AxisData &X, const AxisData &Y,
+                                const MinMaxPyramid &index, std::size_t begin,
+                                std::size_t end, double scaleY,
+                                QList<QPointF> &out)
+{
+  auto finite = [&](std::size_t i) {
+    return std::isfinite(ringAt(X, i)) && std::isfinite(ringAt(Y, i));
+  };
+
+  // Locate the first and last valid points of the column
+  std::size_t a = begin;
+  while (a < end && !finite(a))
+    ++a;
+
+  if (a == end)
+    return;
+
+  std::size_t b = end - 1;
+  while (b > a && !finite(b))
+    --b;
+
+  // Utility lambda to avoid adding duplicated points
+  int k = 0;
+  std::size_t tmp[4];
+  auto push_unique = [&](std::size_t v) {
+    for (int j = 0; j < k; ++j)
+      if (tmp[j] == v)
+        return;
+
+    tmp[k++] = v;
+  };
+
+  // Add first point
+  push_unique(a);
+
+  // Add minimum & maximum points (if needed)
+  const auto mm = index.extrema(Y, a, b + 1);
+  if ((mm.max - mm.min) * scaleY >= 1.0)
+  {
+    if (std::isfinite(ringAt(X, mm.minI)))
+      push_unique(mm.minI);
+    if (std::isfinite(ringAt(X, mm.maxI)))
+      push_unique(mm.maxI);
+  }
+
+  // Add last point
+  push_unique(b);
+
+  // Sort the column points into ascending order
+  for (int i = 1; i < k; ++i)
+  {
+    int j = i - 1;
+    const std::size_t v = tmp[i];
+    while (j >= 0 && tmp[j] > v)
+    {
+      tmp[j + 1] = tmp[j];
+      --j;
+    }
+
+    tmp[j + 1] = v;
+  }
+
+  // Append the generated points
+  for (int j = 0; j < k; ++j)
+    out.append(QPointF(ringAt(X, tmp[j]), ringAt(Y, tmp[j])));
+}
+
+/**
+ * @brief Downsample a 2D series using a min/max index of the Y data.
+ *
+ * Produces the same first/min/max/last points per screen column as the
+ * bucket pass of downsampleMonotonic(), but locates column boundaries with a
+ * binary search over X and obtains the extrema of each column (and of the
+ * whole series) from @p index. A redraw is thus O(w · log n) instead of O(n).
+ *
+ * @return false if the series cannot be handled this way (no finite points,
+ *         or a degenerate X span), in which case the caller should fall back
+ *         to a full scan.
+ */
+inline bool downsampleIndexed(const AxisData &X, const AxisData &Y,
+                              const MinMaxPyramid &index, int w, int h,
+                              QList<QPointF> &out)
+{
+  // Find the first and last valid points
+  const std::size_t n = std::min<std::size_t>(X.size(), Y.size());
+  auto finite = [&](std::size_t i) {
+    return std::isfinite(ringAt(X, i)) && std::isfinite(ringAt(Y, i));
+  };
+
+  std::size_t first = 0;
+  while (first < n && !finite(first))
+    ++first;
+
+  if (first == n)
+    return false;
+
+  std::size_t last = n - 1;
+  while (last > first && !finite(last))
+    --last;
+
+  // Obtain data bounds, X is monotonic so it spans from first to last
+  const double xmin = ringAt(X, first);
+  const double xmax = ringAt(X, last);
+  const auto bounds = index.extrema(Y, first, last + 1);
+  if (!(xmin < xmax) || bounds.empty())
+    return false;
+
+  // Scaling constants
+  const std::size_t C = std::size_t(w);
+  const auto scaleX = static_cast<double>(w - 1) / std::max(1e-12, xmax - xmin);
+  const auto scaleY = static_cast<double>(h)
+                      / std::max(1e-12, bounds.max - bounds.min);
+
+  // Register time-ordered points per column: first, min, max, last
+  out.reserve(w * 3 / 2 + 8);
+  std::size_t begin = first;
+  for (std::size_t c = 0; c < C && begin <= last; ++c)
+  {
+    const auto end = (c + 1 < C)
+                         ? columnStart(X, begin, last + 1, xmin, scaleX, c + 1)
+                         : last + 1;
+
+    appendIndexedColumn(X, Y, index, begin, end, scaleY, out);
+    begin = end;
+  }
+
+  // Success
+  return true;
+}
+
+/**
+ * @brief Downsample a 2D series (X,Y) into screen-space pixels, preserving
  *        extremes.
  *
  * This algorithm assumes that X is monotonic (non-decreasing), which is the
@@ -593,18 +1907,23 @@ inline void spanFromFixedQueue(const AxisData &q, const double *&p0,
  * The output preserves important vertical features (peaks/valleys) while
  * reducing density enough to render interactively.
  *
- * @param X   Ring-buffer of X values (must be monotonic)
- * @param Y   Ring-buffer of Y values (same length as X)
- * @param w   Target plot width in pixels
- * @param h   Target plot height in pixels
- * @param out Output polyline of downsampled points (cleared before use)
- * @param ws  Workspace for temporary bucket storage (reused across calls)
+ * If a min/max index of Y is given, steps 1 and 3 are answered by the index
+ * instead of scanning the series (see downsampleIndexed()).
+ *
+ * @param X      Ring-buffer of X values (must be monotonic)
+ * @param Y      Ring-buffer of Y values (same length as X)
+ * @param w      Target plot width in pixels
+ * @param h      Target plot height in pixels
+ * @param out    Output polyline of downsampled points (cleared before use)
+ * @param ws     Workspace for temporary bucket storage (reused across calls)
+ * @param yIndex Optional min/max index maintained over the storage of Y
  *
  * @return true always, false only if inputs invalid.
  */
 inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
                                 int h, QList<QPointF> &out,
-                                DownsampleWorkspace *ws)
+                                DownsampleWorkspace *ws,
+                                const MinMaxPyramid *yIndex = nullptr)
 {
   // Clear the buffer and validate input data
   out.clear();
@@ -612,6 +1931,15 @@ inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
   if (n == 0 || w <= 0 || h <= 0)
     return true;
 
+  // Use the min/max index of Y when available
+  if (yIndex && yIndex->data() == Y.raw())
+  {
+    if (downsampleIndexed(X, Y, *yIndex, w, h, out))
+      return true;
+
+    out.clear();
+  }
+
   // Extract ring buffer spans from data containers
   std::size_t xn0, xn1, yn0, yn1;
   const double *xp0, *xp1, *yp0, *yp1;
@@ -626,43 +1954,36 @@ inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
     return (i < yn0) ? yp0[i] : yp1[i - yn0];
   };
 
-  // Find data bounds
-  std::size_t lastFinite = n;
-  std::size_t firstFinite = n;
-  double xmin = std::numeric_limits<double>::infinity();
-  double ymin = std::numeric_limits<double>::infinity();
-  double xmax = -std::numeric_limits<double>::infinity();
-  double ymax = -std::numeric_limits<double>::infinity();
-  for (std::size_t i = 0; i < n; ++i)
-  {
-    // Get & validate raw points
-    const double xv = xAt(i);
-    const double yv = yAt(i);
-    if (!std::isfinite(xv) || !std::isfinite(yv))
-      continue;
-
-    // Update data boundaries
-    if (xv < xmin)
-      xmin = xv;
-    if (xv > xmax)
-      xmax = xv;
-    if (yv < ymin)
-      ymin = yv;
-    if (yv > ymax)
-      ymax = yv;
+  // Find the first and last valid points
+  auto finite = [&](std::size_t i) {
+    return std::isfinite(xAt(i)) && std::isfinite(yAt(i));
+  };
 
-    // Set first valid point
-    if (firstFinite == n)
-      firstFinite = i;
-
-    // Update last valid point
-    lastFinite = i;
-  }
+  std::size_t firstFinite = 0;
+  while (firstFinite < n && !finite(firstFinite))
+    ++firstFinite;
 
   // Catch edge cases where all the data is invalid
   if (firstFinite == n)
     return false;
 
+  std::size_t lastFinite = n - 1;
+  while (lastFinite > firstFinite && !finite(lastFinite))
+    --lastFinite;
+
+  // Find data bounds
+  Extent ex, ey;
+  forEachSpanPair(X, Y, firstFinite, lastFinite + 1,
+                  [&](const double *xs, const double *ys, std::size_t,
+                      std::size_t count) {
+                    finiteExtent(xs, ys, count, ex, ey);
+                  });
+
+  const double xmin = ex.min;
+  const double xmax = ex.max;
+  const double ymin = ey.min;
+  const double ymax = ey.max;
+
   // If X axis is not monotonic, fallback to index sampling
   if (!(xmin < xmax))
   {
@@ -691,58 +2012,58 @@ inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
   const auto scaleX = static_cast<double>(w - 1) / std::max(1e-12, xmax - xmin);
   const auto scaleY = static_cast<double>(h) / std::max(1e-12, ymax - ymin);
 
-  // Lambda function to obtain the column index for a "raw" x index
-  auto getColFromX = [&](double x) -> std::size_t {
-    auto c = static_cast<long>((x - xmin) * scaleX);
-    if (c < 0)
-      c = 0;
-
-    else if (c >= w)
-      c = w - 1;
-
-    return std::size_t(c);
-  };
-
-  // Fill buckets
-  for (std::size_t i = 0; i < n; ++i)
-  {
-    // Obtain raw points & validate them
-    const double xv = xAt(i);
-    const double yv = yAt(i);
-    if (!std::isfinite(xv) || !std::isfinite(yv))
-      continue;
-
-    // Get column
-    const std::size_t c = getColFromX(xv);
-
-    // Register first point for column
-    if (ws->cnt[c] == 0)
-    {
-      ws->firstI[c] = ws->lastI[c] = i;
-      ws->minI[c] = ws->maxI[c] = i;
-      ws->minY[c] = ws->maxY[c] = yv;
-      ws->cnt[c] = 1;
-    }
-
-    // Register min/max values for column
-    else
-    {
-      if (yv < ws->minY[c])
-      {
-        ws->minY[c] = yv;
-        ws->minI[c] = i;
-      }
-
-      if (yv > ws->maxY[c])
-      {
-        ws->maxY[c] = yv;
-        ws->maxI[c] = i;
-      }
-
-      ws->lastI[c] = i;
-      ++ws->cnt[c];
-    }
-  }
+  // Fill buckets, mapping X values to columns one block at a time
+  constexpr std::size_t kBlock = 1024;
+  ws->col.resize(kBlock);
+  forEachSpanPair(
+      X, Y, firstFinite, lastFinite + 1,
+      [&](const double *xs, const double *ys, std::size_t base,
+          std::size_t count) {
+        for (std::size_t off = 0; off < count; off += kBlock)
+        {
+          const std::size_t len = std::min(kBlock, count - off);
+          columnIndexes(xs + off, len, xmin, scaleX, w, ws->col.data());
+          for (std::size_t j = 0; j < len; ++j)
+          {
+            // Obtain raw points & validate them
+            const double yv = ys[off + j];
+            if (!std::isfinite(xs[off + j]) || !std::isfinite(yv))
+              continue;
+
+            // Get column
+            const std::size_t i = base + off + j;
+            const std::size_t c = std::size_t(ws->col[j]);
+
+            // Register first point for column
+            if (ws->cnt[c] == 0)
+            {
+              ws->firstI[c] = ws->lastI[c] = i;
+              ws->minI[c] = ws->maxI[c] = i;
+              ws->minY[c] = ws->maxY[c] = yv;
+              ws->cnt[c] = 1;
+            }
+
+            // Register min/max values for column
+            else
+            {
+              if (yv < ws->minY[c])
+              {
+                ws->minY[c] = yv;
+                ws->minI[c] = i;
+              }
+
+              if (yv > ws->maxY[c])
+              {
+                ws->maxY[c] = yv;
+                ws->maxI[c] = i;
+              }
+
+              ws->lastI[c] = i;
+              ++ws->cnt[c];
+            }
+          }
+        }
+      });
 
   // Register time-ordered points per column: first, min, max, last
   out.reserve(w * 3 / 2 + 8);
@@ -803,8 +2124,8 @@ inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
 /**
  * Downsample a LineSeries (paired X and Y AxisData) for rendering.
  *
- * Convenience overload that just forwards to the main
- * downsampleMonotonic() implementation.
+ * Convenience overload that forwards to the main downsampleMonotonic()
+ * implementation, together with the min/max index of the series (if any).
  *
  * @param in     Input line series with X and Y data.
  * @param width  Target pixel width of output.
@@ -818,7 +2139,119 @@ inline bool downsampleMonotonic(const AxisData &X, const AxisData &Y, int w,
 inline bool downsampleMonotonic(const LineSeries &in, int width, int height,
                                 QList<QPointF> &out, DownsampleWorkspace *ws)
 {
-  return downsampleMonotonic(*in.x, *in.y, width, height, out, ws);
+  return downsampleMonotonic(*in.x, *in.y, width, height, out, ws, in.yIndex);
+}
+
+/**
+ * @brief Downsample every curve of a MultiLineSeries in a single pass.
+ *
+ * All curves share the same X axis, so the screen columns are located only
+ * once: for each column, the sample range is found with a binary search over
+ * X and then the first/min/max/last points of every visible curve are read
+ * from the min/max index of its SeriesStore column. Columns are laid out
+ * from the finite span of the shared X axis, so all curves use the same
+ * horizontal grid.
+ *
+ * Falls back to one downsampleMonotonic() call per curve if X does not span
+ * a valid range.
+ *
+ * @param in      Multi-series with shared X data.
+ * @param visible Visibility flag of each curve, hidden curves are skipped.
+ * @param width   Target pixel width of output.
+ * @param height  Target pixel height of output.
+ * @param out     One output polyline per curve, visible ones are cleared.
+ * @param ws      Workspace reused across calls.
+ *
+ * @return true on success, false on parameter mismatch.
+ */
+inline bool downsampleMultiple(const MultiLineSeries &in,
+                               const QList<bool> &visible, int width,
+                               int height, QList<QList<QPointF>> &out,
+                               DownsampleWorkspace *ws)
+{
+  // Validate input data
+  const auto &X = *in.x;
+  const std::size_t curves = in.y.size();
+  if (static_cast<std::size_t>(out.size()) < curves
+      || static_cast<std::size_t>(visible.size()) < curves)
+    return false;
+
+  // Clear the output of visible curves
+  for (std::size_t k = 0; k < curves; ++k)
+  {
+    if (visible[k])
+      out[k].clear();
+  }
+
+  if (curves == 0 || width <= 0 || height <= 0)
+    return true;
+
+  // Find the finite span of the shared X axis
+  const std::size_t n = std::min(X.size(), in.y[0].size());
+  std::size_t first = 0;
+  while (first < n && !std::isfinite(ringAt(X, first)))
+    ++first;
+
+  std::size_t last = n > 0 ? n - 1 : 0;
+  while (last > first && !std::isfinite(ringAt(X, last)))
+    --last;
+
+  // Degenerate X axis, downsample each curve on its own
+  const double xmin = first < n ? ringAt(X, first) : 0;
+  const double xmax = first < n ? ringAt(X, last) : 0;
+  if (!(xmin < xmax))
+  {
+    for (std::size_t k = 0; k < curves; ++k)
+    {
+      if (visible[k])
+        downsampleMonotonic(X, in.y[k], width, height, out[k], ws,
+                            &in.y.pyramid(k));
+    }
+
+    return true;
+  }
+
+  // Obtain the vertical scale of each curve, zero if it has no valid data
+  ws->curveScale.assign(curves, 0.0);
+  for (std::size_t k = 0; k < curves; ++k)
+  {
+    if (!visible[k])
+      continue;
+
+    const auto bounds = in.y.pyramid(k).extrema(in.y[k], first, last + 1);
+    if (!bounds.empty())
+    {
+      ws->curveScale[k] = static_cast<double>(height)
+                          / std::max(1e-12, bounds.max - bounds.min);
+      out[k].reserve(width * 3 / 2 + 8);
+    }
+  }
+
+  // Locate each column once, then emit its points for every curve
+  const std::size_t C = std::size_t(width);
+  const auto scaleX = static_cast<double>(width - 1) / (xmax - xmin);
+  std::size_t begin = first;
+  for (std::size_t c = 0; c < C && begin <= last; ++c)
+  {
+    const auto end = (c + 1 < C)
+                         ? columnStart(X, begin, last + 1, xmin, scaleX, c + 1)
+                         : last + 1;
+
+    if (end > begin)
+    {
+      for (std::size_t k = 0; k < curves; ++k)
+      {
+        if (ws->curveScale[k] > 0)
+          appendIndexedColumn(X, in.y[k], in.y.pyramid(k), begin, end,
+                              ws->curveScale[k], out[k]);
+      }
+    }
+
+    begin = end;
+  }
+
+  // Success
+  return true;
 }
 
 } // namespace DSP
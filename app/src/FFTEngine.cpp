@@ -0,0 +1,344 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+
+#include "FFTEngine.h"
+
+//------------------------------------------------------------------------------
+// Constants & window function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Interval at which the latest window is re-analyzed when samples
+ *        arrive slower than one hop per dashboard refresh.
+ */
+static constexpr qint64 kRefreshIntervalMs = 1000 / 24;
+
+/**
+ * @brief Lowest level reported by the spectrum, in dB.
+ */
+static constexpr float kFloorDB = -100.0f;
+
+/**
+ * @brief Smallest power used to compute decibel values.
+ */
+static constexpr float kMinPower = 1e-24f;
+
+/**
+ * @brief Computes a single coefficient of the 4-term Blackman-Harris window.
+ *
+ * This function implements the 4-term Blackman-Harris window formula:
+ * \f[
+ * w[n] = a_0 - a_1 \cos\left(\frac{2\pi n}{N-1}\right)
+ *        + a_2 \cos\left(\frac{4\pi n}{N-1}\right)
+ *        - a_3 \cos\left(\frac{6\pi n}{N-1}\right)
+ * \f]
+ *
+ * where the coefficients are:
+ * - a₀ = 0.35875
+ * - a₁ = 0.48829
+ * - a₂ = 0.14128
+ * - a₃ = 0.01168
+ *
+ * @param i Index of the coefficient (0 ≤ i < N).
+ * @param N Total number of points in the window.
+ * @return The computed window coefficient for index @p i.
+ *
+ * @note If N ≤ 1, the function returns 1.0f.
+ */
+static float blackman_harris_coeff(unsigned int i, unsigned int N)
+{
+  if (N <= 1)
+    return 1.0f;
+
+  constexpr float a0 = 0.35875f;
+  constexpr float a1 = 0.48829f;
+  constexpr float a2 = 0.14128f;
+  constexpr float a3 = 0.01168f;
+
+  const float two_pi = 6.28318530717958647692f;
+  const float k = two_pi / static_cast<float>(N - 1);
+  const float x = k * static_cast<float>(i);
+
+  return a0 - a1 * std::cos(x) + a2 * std::cos(2.0f * x)
+         - a3 * std::cos(3.0f * x);
+}
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Creates an FFT engine.
+ *
+ * @param samples  Requested window size, rounded down to a power of two.
+ * @param overlap  Percentage of samples shared by consecutive windows.
+ * @param averages Number of windows averaged into the published spectrum.
+ */
+DSP::FFTEngine::FFTEngine(const int samples, const int overlap,
+                          const int averages)
+  : m_size(sizeFor(samples))
+  , m_hop(1)
+  , m_pending(0)
+  , m_averages(qBound(1, averages, 64))
+  , m_offset(0)
+  , m_scale(1)
+  , m_plan(nullptr)
+  , m_input(m_size)
+  , m_historyCount(0)
+  , m_historyIndex(0)
+  , m_generation(0)
+{
+  // Obtain the number of new samples between analysis segments
+  const int percent = qBound(0, overlap, 95);
+  m_hop = qMax(1, m_size * (100 - percent) / 100);
+
+  // Start from a silent window, so that the FFT size never changes
+  m_input.fill(0);
+
+  // Create window function coefficients
+  m_window.resize(m_size);
+  const auto windowSize = static_cast<unsigned int>(m_size);
+  for (unsigned int i = 0; i < windowSize; ++i)
+    m_window[i] = blackman_harris_coeff(i, windowSize);
+
+  // Allocate work buffers
+  const auto bins = static_cast<std::size_t>(this->bins());
+  m_samples.resize(m_size);
+  m_power.resize(bins);
+  m_average.resize(bins);
+  m_decibels.resize(bins);
+  m_spectrum.assign(bins, kFloorDB);
+  m_output.resize(bins + 1);
+  m_history.resize(bins * (m_averages - 1));
+
+  // Create FFT plan
+  m_plan = kiss_fftr_alloc(m_size, 0, nullptr, nullptr);
+  m_timer.start();
+}
+
+/**
+ * @brief Releases the FFT plan.
+ */
+DSP::FFTEngine::~FFTEngine()
+{
+  if (m_plan)
+    kiss_fftr_free(m_plan);
+}
+
+//------------------------------------------------------------------------------
+// Member access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of samples between completed analysis segments.
+ */
+int DSP::FFTEngine::hop() const
+{
+  return m_hop;
+}
+
+/**
+ * @brief Returns the FFT window size.
+ */
+int DSP::FFTEngine::size() const
+{
+  return m_size;
+}
+
+/**
+ * @brief Returns the number of frequency bins of the spectrum (up to, but
+ *        excluding, the Nyquist frequency).
+ */
+int DSP::FFTEngine::bins() const
+{
+  return m_size / 2;
+}
+
+/**
+ * @brief Returns the number of windows averaged into the spectrum.
+ */
+int DSP::FFTEngine::averages() const
+{
+  return m_averages;
+}
+
+/**
+ * @brief Returns a counter that increases every time a spectrum is published.
+ *
+ * Widgets can compare it with the value returned by the last spectrum() call
+ * to skip redundant work.
+ */
+quint64 DSP::FFTEngine::generation() const
+{
+  return m_generation.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Copies the latest spectrum, in dB, into @p out.
+ *
+ * @return The generation of the copied spectrum.
+ */
+quint64 DSP::FFTEngine::spectrum(std::vector<float> &out) const
+{
+  QMutexLocker locker(&m_lock);
+  out.assign(m_spectrum.begin(), m_spectrum.end());
+  return m_generation.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the FFT size used for a requested number of samples, which
+ *        is the largest power of two that does not exceed it (at least 8).
+ */
+int DSP::FFTEngine::sizeFor(const int samples)
+{
+  const auto size = static_cast<unsigned int>(qMax(8, samples));
+  return static_cast<int>(std::bit_floor(size));
+}
+
+//------------------------------------------------------------------------------
+// Sample processing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Sets the expected input range, used to normalize samples to
+ *        [-1, 1] before the FFT.
+ *
+ * An empty or invalid range disables normalization.
+ */
+void DSP::FFTEngine::setRange(double min, double max)
+{
+  if (max < min)
+    std::swap(min, max);
+
+  if (max - min > 0.0)
+  {
+    m_offset = -(max + min) * 0.5;
+    m_scale = 1.0 / qMax(1e-12, (max - min) * 0.5);
+  }
+
+  else
+  {
+    m_offset = 0;
+    m_scale = 1;
+  }
+}
+
+/**
+ * @brief Adds a sample to the analysis window.
+ *
+ * Completes a segment every hop() samples. Between segments, the latest
+ * window is analyzed at most once per dashboard refresh.
+ */
+void DSP::FFTEngine::append(const double value)
+{
+  m_input.push(value);
+
+  if (++m_pending >= m_hop)
+  {
+    compute(true);
+    m_pending = 0;
+    m_timer.restart();
+  }
+
+  else if (m_timer.elapsed() >= kRefreshIntervalMs)
+  {
+    compute(false);
+    m_timer.restart();
+  }
+}
+
+/**
+ * @brief Analyzes the current window and publishes the averaged spectrum.
+ *
+ * @param segmentComplete If @c true, the power spectrum of the window is
+ *                        stored as a completed Welch segment.
+ */
+void DSP::FFTEngine::compute(const bool segmentComplete)
+{
+  // Normalize & window the samples of both ring spans
+  std::size_t n0, n1;
+  const double *p0, *p1;
+  spanFromFixedQueue(m_input, p0, n0, p1, n1);
+  scaleWindow(p0, n0, m_offset, m_scale, m_window.data(), m_samples.data());
+  scaleWindow(p1, n1, m_offset, m_scale, m_window.data() + n0,
+              m_samples.data() + n0);
+
+  // Run the real-input FFT
+  kiss_fftr(m_plan, m_samples.data(), m_output.data());
+
+  // Obtain the power spectrum of the window
+  const std::size_t bins = m_power.size();
+  const float norm = static_cast<float>(m_size) * static_cast<float>(m_size);
+  for (std::size_t i = 0; i < bins; ++i)
+  {
+    const float re = m_output[i].r;
+    const float im = m_output[i].i;
+    m_power[i] = (re * re + im * im) / norm;
+  }
+
+  // Average with the previously completed segments
+  std::copy(m_power.begin(), m_power.end(), m_average.begin());
+  for (std::size_t h = 0; h < m_historyCount; ++h)
+  {
+    const float *segment = m_history.data() + h * bins;
+    for (std::size_t i = 0; i < bins; ++i)
+      m_average[i] += segment[i];
+  }
+
+  // Convert to decibels
+  const float count = static_cast<float>(m_historyCount + 1);
+  for (std::size_t i = 0; i < bins; ++i)
+  {
+    const float power = std::max(m_average[i] / count, kMinPower);
+    m_decibels[i] = std::max(10.0f * std::log10(power), kFloorDB);
+  }
+
+  // Store the segment, replacing the oldest one
+  const std::size_t slots = static_cast<std::size_t>(m_averages - 1);
+  if (segmentComplete && slots > 0)
+  {
+    std::copy(m_power.begin(), m_power.end(),
+              m_history.begin() + m_historyIndex * bins);
+    m_historyIndex = (m_historyIndex + 1) % slots;
+    m_historyCount = std::min(m_historyCount + 1, slots);
+  }
+
+  // Publish a 3-bin moving average of the spectrum
+  QMutexLocker locker(&m_lock);
+  const auto last = static_cast<std::ptrdiff_t>(bins) - 1;
+  for (std::ptrdiff_t i = 0; i <= last; ++i)
+  {
+    const auto lo = std::max<std::ptrdiff_t>(0, i - 1);
+    const auto hi = std::min<std::ptrdiff_t>(last, i + 1);
+
+    float sum = 0.0f;
+    for (auto k = lo; k <= hi; ++k)
+      sum += m_decibels[k];
+
+    m_spectrum[i] = sum / static_cast<float>(hi - lo + 1);
+  }
+
+  m_generation.fetch_add(1, std::memory_order_release);
+}
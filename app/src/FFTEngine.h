@@ -0,0 +1,106 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include <kiss_fftr.h>
+
+#include "DSP.h"
+
+namespace DSP
+{
+/**
+ * @class DSP::FFTEngine
+ * @brief Streaming spectrum analyzer for a single dataset.
+ *
+ * The engine keeps the last size() samples of a dataset and computes their
+ * power spectrum with a real-input FFT (`kiss_fftr`) as samples arrive:
+ *
+ * - A new analysis segment is completed every hop() samples, where the hop
+ *   is derived from the overlap percentage between consecutive windows.
+ * - The published spectrum is the Welch average of the latest window and up
+ *   to averages() - 1 previously completed segments.
+ * - If samples arrive slowly, the latest window is also analyzed at the
+ *   dashboard refresh rate, so the plot does not wait for a whole hop.
+ *
+ * No work is done while no samples arrive. append() is called from the frame
+ * processing thread, while widgets read the latest result with spectrum()
+ * from the GUI thread.
+ */
+class FFTEngine
+{
+public:
+  FFTEngine(const int samples, const int overlap, const int averages);
+  ~FFTEngine();
+
+  FFTEngine(FFTEngine &&) = delete;
+  FFTEngine(const FFTEngine &) = delete;
+  FFTEngine &operator=(FFTEngine &&) = delete;
+  FFTEngine &operator=(const FFTEngine &) = delete;
+
+  [[nodiscard]] int hop() const;
+  [[nodiscard]] int size() const;
+  [[nodiscard]] int bins() const;
+  [[nodiscard]] int averages() const;
+  [[nodiscard]] quint64 generation() const;
+  quint64 spectrum(std::vector<float> &out) const;
+
+  [[nodiscard]] static int sizeFor(const int samples);
+
+  void setRange(double min, double max);
+  void append(const double value);
+
+private:
+  void compute(const bool segmentComplete);
+
+private:
+  int m_size;
+  int m_hop;
+  int m_pending;
+  int m_averages;
+  double m_offset;
+  double m_scale;
+
+  kiss_fftr_cfg m_plan;
+  AxisData m_input;
+  QElapsedTimer m_timer;
+
+  std::vector<float> m_window;
+  std::vector<float> m_samples;
+  std::vector<float> m_power;
+  std::vector<float> m_average;
+  std::vector<float> m_history;
+  std::vector<float> m_decibels;
+  std::vector<kiss_fft_cpx> m_output;
+  std::size_t m_historyCount;
+  std::size_t m_historyIndex;
+
+  mutable QMutex m_lock;
+  std::vector<float> m_spectrum;
+  std::atomic<quint64> m_generation;
+};
+} // namespace DSP
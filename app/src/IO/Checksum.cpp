@@ -21,431 +21,648 @@
 
 #include "IO/Checksum.h"
 
-#include <cstdint>
+#include <array>
+#include <cstring>
+#include <algorithm>
 
 //------------------------------------------------------------------------------
-// Endianess detection
+// Hardware acceleration detection
 //------------------------------------------------------------------------------
 
-#if defined(_MSC_VER)
-#  include <stdlib.h>
-#  define IS_LITTLE_ENDIAN 1
-#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
-#  define IS_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)               \
+    || defined(_M_IX86)
+#  define CRC32_PCLMUL 1
+#  include <immintrin.h>
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#    define PCLMUL_TARGET
+#  else
+#    define PCLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+#  endif
 #else
-#  include <endian.h>
-#  define IS_LITTLE_ENDIAN (__BYTE_ORDER == __LITTLE_ENDIAN)
+#  define CRC32_PCLMUL 0
 #endif
 
 //------------------------------------------------------------------------------
-// Endian-correct memory utilities for checksum formatting
+// Lookup tables
 //------------------------------------------------------------------------------
 
 //
-// These helpers write multibyte checksum values (e.g., CRCs, Adler, Fletcher)
-// into output buffers with a defined byte order, regardless of the host CPU's
-// native endianness.
+// All tables are generated at compile time from the generator polynomials.
 //
-// This ensures consistent output for binary formats, protocol compliance,
-// and cross-platform validation. For example:
-// - CRC-16-MODBUS requires little-endian output
-// - Network and file formats typically expect big-endian
+// - MSB-first CRCs (CRC-8, CRC-16, CRC-16-CCITT) use a single 256-entry table
+//   indexed by the top byte of the register.
+// - Reflected CRCs (CRC-16-MODBUS, CRC-32) are indexed by the low byte.
+// - CRC-32 additionally uses slicing-by-8, which consumes eight input bytes
+//   per iteration with eight independent table lookups.
 //
-// Use `big_endian_memcpy()` and `little_endian_memcpy()` instead of raw
-// memcpy() to ensure deterministic, spec-compliant results.
+
+namespace
+{
+constexpr std::array<uint8_t, 256> makeCrc8Table(const uint8_t poly)
+{
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; ++i)
+  {
+    auto crc = static_cast<uint8_t>(i);
+    for (int j = 0; j < 8; ++j)
+      crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ poly)
+                         : static_cast<uint8_t>(crc << 1);
+
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<uint16_t, 256> makeCrc16Table(const uint16_t poly)
+{
+  std::array<uint16_t, 256> table{};
+  for (int i = 0; i < 256; ++i)
+  {
+    auto crc = static_cast<uint16_t>(i << 8);
+    for (int j = 0; j < 8; ++j)
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ poly)
+                           : static_cast<uint16_t>(crc << 1);
+
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<uint16_t, 256> makeReflectedCrc16Table(const uint16_t poly)
+{
+  std::array<uint16_t, 256> table{};
+  for (int i = 0; i < 256; ++i)
+  {
+    auto crc = static_cast<uint16_t>(i);
+    for (int j = 0; j < 8; ++j)
+      crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ poly)
+                      : static_cast<uint16_t>(crc >> 1);
+
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<std::array<uint32_t, 256>, 8>
+makeReflectedCrc32Tables(const uint32_t poly)
+{
+  std::array<std::array<uint32_t, 256>, 8> tables{};
+  for (uint32_t i = 0; i < 256; ++i)
+  {
+    uint32_t crc = i;
+    for (int j = 0; j < 8; ++j)
+      crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+
+    tables[0][i] = crc;
+  }
+
+  for (uint32_t i = 0; i < 256; ++i)
+  {
+    for (int k = 1; k < 8; ++k)
+    {
+      const uint32_t prev = tables[k - 1][i];
+      tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xFF];
+    }
+  }
+
+  return tables;
+}
+
+constexpr auto kCrc8Table = makeCrc8Table(0x31);
+constexpr auto kCrc16Table = makeCrc16Table(0x1021);
+constexpr auto kCrc16ModbusTable = makeReflectedCrc16Table(0xA001);
+constexpr auto kCrc32Tables = makeReflectedCrc32Tables(0xEDB88320);
+} // namespace
+
+//------------------------------------------------------------------------------
+// Checksum kernels
+//------------------------------------------------------------------------------
+
+//
+// Each kernel updates a running register with a block of input data, so that
+// frames split across the two segments of a ring buffer can be processed
+// without concatenating them first. Initial values and final transformations
+// are applied by IO::ChecksumEngine.
 //
 
+namespace
+{
 /**
- * @brief Copies data in big-endian format to a frame buffer.
- *
- * This function ensures that data is stored in big-endian byte order,
- * regardless of the host machine's native endianness. On little-endian
- * systems, it reverses the byte order before copying.
- *
- * @param frame A pointer to the destination buffer.
- * @param data A pointer to the source data to copy.
- * @param size The number of bytes to copy.
- *
- * @pre `frame` and `data` must not be null.
- * @pre `size` must be greater than 0.
+ * @brief Updates a CRC-8 (polynomial 0x31) register.
  */
-static void big_endian_memcpy(uint8_t *frame, const void *data, size_t size)
+uint8_t crc8(uint8_t crc, const uint8_t *data, size_t length)
 {
-  assert(frame && data && size > 0);
-  const uint8_t *raw_data = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < length; ++i)
+    crc = kCrc8Table[crc ^ data[i]];
 
-#if IS_LITTLE_ENDIAN
-  for (size_t i = 0; i < size; ++i)
-    frame[i] = raw_data[size - 1 - i];
-#else
-  memcpy(frame, raw_data, size);
-#endif
+  return crc;
 }
 
 /**
- * @brief Copies data in little-endian format to a frame buffer.
+ * @brief Updates an MSB-first CRC-16 (polynomial 0x1021) register.
  *
- * This function ensures that data is stored in little-endian byte order,
- * regardless of the host machine's native endianness. On big-endian
- * systems, it reverses the byte order before copying.
- *
- * @param frame A pointer to the destination buffer.
- * @param data A pointer to the source data to copy.
- * @param size The number of bytes to copy.
- *
- * @pre `frame` and `data` must not be null.
- * @pre `size` must be greater than 0.
+ * Used by both "CRC-16" (initial value 0xFFFF) and "CRC-16-CCITT" (initial
+ * value 0x0000).
  */
-static void little_endian_memcpy(uint8_t *frame, const void *data, size_t size)
+uint16_t crc16(uint16_t crc, const uint8_t *data, size_t length)
 {
-  assert(frame && data && size > 0);
-  const uint8_t *raw_data = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < length; ++i)
+    crc = static_cast<uint16_t>(crc << 8)
+          ^ kCrc16Table[static_cast<uint8_t>(crc >> 8) ^ data[i]];
 
-#if IS_LITTLE_ENDIAN
-  memcpy(frame, raw_data, size);
-#else
-  for (size_t i = 0; i < size; ++i)
-    frame[i] = raw_data[size - 1 - i];
-#endif
+  return crc;
 }
 
-//------------------------------------------------------------------------------
-// Checksum implementations
-//------------------------------------------------------------------------------
-
-namespace IO
-{
 /**
- * @brief Computes an 8-bit XOR checksum.
- *
- * XORs all bytes in the input data. Useful for simple integrity checks in
- * lightweight protocols.
- *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 8-bit XOR checksum.
+ * @brief Updates a CRC-16-MODBUS (reflected polynomial 0xA001) register.
  */
-static uint8_t xor8(const char *data, const int length)
+uint16_t crc16_modbus(uint16_t crc, const uint8_t *data, size_t length)
 {
-  uint8_t checksum = 0;
-  for (int i = 0; i < length; ++i)
-    checksum ^= static_cast<uint8_t>(data[i]);
+  for (size_t i = 0; i < length; ++i)
+    crc = (crc >> 8) ^ kCrc16ModbusTable[(crc ^ data[i]) & 0xFF];
 
-  return checksum;
+  return crc;
 }
 
 /**
- * @brief Computes an 8-bit CRC (CRC-8) using polynomial 0x31.
- *
- * Common in SMBus and lightweight communication protocols.
- *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 8-bit CRC checksum.
+ * @brief Updates a CRC-32 (reflected polynomial 0xEDB88320) register using
+ *        slicing-by-8.
  */
-static uint8_t crc8(const char *data, const int length)
+uint32_t crc32_slice8(uint32_t crc, const uint8_t *data, size_t length)
 {
-  uint8_t crc = 0xFF;
-  for (int i = 0; i < length; ++i)
+  while (length >= 8)
   {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
-    {
-      if (crc & 0x80)
-        crc = (crc << 1) ^ 0x31;
-      else
-        crc <<= 1;
-    }
+    const uint32_t one
+        = crc
+          ^ (uint32_t(data[0]) | uint32_t(data[1]) << 8
+             | uint32_t(data[2]) << 16 | uint32_t(data[3]) << 24);
+    const uint32_t two = uint32_t(data[4]) | uint32_t(data[5]) << 8
+                         | uint32_t(data[6]) << 16 | uint32_t(data[7]) << 24;
+
+    crc = kCrc32Tables[7][one & 0xFF] ^ kCrc32Tables[6][(one >> 8) & 0xFF]
+          ^ kCrc32Tables[5][(one >> 16) & 0xFF] ^ kCrc32Tables[4][one >> 24]
+          ^ kCrc32Tables[3][two & 0xFF] ^ kCrc32Tables[2][(two >> 8) & 0xFF]
+          ^ kCrc32Tables[1][(two >> 16) & 0xFF] ^ kCrc32Tables[0][two >> 24];
+
+    data += 8;
+    length -= 8;
   }
+
+  for (size_t i = 0; i < length; ++i)
+    crc = (crc >> 8) ^ kCrc32Tables[0][(crc ^ data[i]) & 0xFF];
+
   return crc;
 }
 
+#if CRC32_PCLMUL
 /**
- * @brief Computes an additive modulo-256 checksum.
- *
- * Sums all bytes in the input and returns the result modulo 256.
- *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 8-bit additive checksum.
+ * @brief Returns @c true if the CPU supports PCLMULQDQ and SSE4.1.
  */
-static uint8_t mod256(const char *data, const int length)
+bool cpuSupportsPclmul()
 {
-  uint16_t sum = 0;
-  for (int i = 0; i < length; ++i)
-    sum += static_cast<uint8_t>(data[i]);
-  return static_cast<uint8_t>(sum & 0xFF);
+#  if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 1)) && (info[2] & (1 << 19));
+#  else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#  endif
 }
 
 /**
- * @brief Computes a 16-bit CRC using a custom bitwise algorithm.
+ * @brief Folds a 128-bit accumulator into the next 128-bit block.
+ */
+PCLMUL_TARGET inline __m128i fold128(__m128i acc, __m128i next, __m128i k)
+{
+  const __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+  const __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(hi, next), lo);
+}
+
+/**
+ * @brief Updates a CRC-32 register by folding 128-bit blocks with carry-less
+ *        multiplication.
  *
- * This is not a standard CRC-16 variant. Rename if needed for clarity.
+ * Implements the folding/Barrett reduction scheme described in Intel's
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * white paper, with constants for the reflected 0xEDB88320 polynomial.
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 16-bit CRC checksum.
+ * @param crc Current (non-inverted) CRC register.
+ * @param data Input bytes.
+ * @param length Number of bytes, must be >= 64 and a multiple of 16.
  */
-static uint16_t crc16(const char *data, const int length)
+PCLMUL_TARGET uint32_t crc32_pclmul(uint32_t crc, const uint8_t *data,
+                                    size_t length)
 {
-  uint8_t x;
-  uint16_t crc = 0xFFFF;
+  alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+  alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+  alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+  alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+  auto load = [](const uint8_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  };
+
+  // Load the first 64 bytes and mix in the initial CRC
+  __m128i x1 = load(data + 0x00);
+  __m128i x2 = load(data + 0x10);
+  __m128i x3 = load(data + 0x20);
+  __m128i x4 = load(data + 0x30);
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+  data += 64;
+  length -= 64;
 
-  for (int i = 0; i < length; ++i)
+  // Fold 512 bits at a time
+  __m128i x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+  while (length >= 64)
   {
-    x = crc >> 8 ^ static_cast<uint8_t>(data[i]);
-    x ^= x >> 4;
-    crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5)) ^ x;
+    const __m128i x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    const __m128i x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    const __m128i x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+    const __m128i x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), load(data + 0x00));
+    x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), load(data + 0x10));
+    x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), load(data + 0x20));
+    x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), load(data + 0x30));
+
+    data += 64;
+    length -= 64;
   }
 
-  return crc;
+  // Fold the four accumulators into one 128-bit value
+  x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+  x1 = fold128(x1, x2, x0);
+  x1 = fold128(x1, x3, x0);
+  x1 = fold128(x1, x4, x0);
+
+  // Fold any remaining 16-byte blocks
+  while (length >= 16)
+  {
+    x1 = fold128(x1, load(data), x0);
+    data += 16;
+    length -= 16;
+  }
+
+  // Fold 128 bits down to 64 bits
+  const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+  x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, mask);
+  x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction down to 32 bits
+  x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+  x2 = _mm_and_si128(x1, mask);
+  x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+  x2 = _mm_and_si128(x2, mask);
+  x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
 }
+#endif
 
 /**
- * @brief Computes a 32-bit CRC (CRC-32) using polynomial 0xEDB88320.
+ * @brief Updates a CRC-32 register, selecting the fastest available kernel.
  *
- * Common in Ethernet, ZIP, PNG, and other file/integrity systems.
- *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 32-bit CRC checksum.
+ * Blocks of at least 64 bytes are processed with PCLMULQDQ folding when the
+ * CPU supports it; the tail (and everything on other CPUs) goes through the
+ * slicing-by-8 tables.
  */
-static uint32_t crc32(const char *data, const int length)
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length)
 {
-  uint32_t crc = 0xFFFFFFFF;
+#if CRC32_PCLMUL
+  static const bool pclmul = cpuSupportsPclmul();
+  if (pclmul && length >= 64)
+  {
+    const size_t blocks = length & ~size_t(15);
+    crc = crc32_pclmul(crc, data, blocks);
+    data += blocks;
+    length -= blocks;
+  }
+#endif
+
+  return crc32_slice8(crc, data, length);
+}
 
-  for (int i = 0; i < length; ++i)
+/**
+ * @brief Updates Adler-32 sums (RFC 1950), deferring the modulo operation.
+ *
+ * 5552 is the largest number of bytes that can be summed before the 32-bit
+ * accumulators may overflow.
+ */
+void adler32(uint32_t &a, uint32_t &b, const uint8_t *data, size_t length)
+{
+  constexpr uint32_t MOD_ADLER = 65521;
+  while (length > 0)
   {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
+    const size_t block = std::min<size_t>(length, 5552);
+    for (size_t i = 0; i < block; ++i)
     {
-      if (crc & 1)
-        crc = (crc >> 1) ^ 0xEDB88320;
-      else
-        crc >>= 1;
+      a += data[i];
+      b += a;
     }
-  }
 
-  return ~crc;
+    a %= MOD_ADLER;
+    b %= MOD_ADLER;
+    data += block;
+    length -= block;
+  }
 }
 
 /**
- * @brief Computes the Adler-32 checksum of the input data.
- *
- * Fast checksum algorithm defined in RFC 1950 (used in zlib).
+ * @brief Updates Fletcher-16 sums, deferring the modulo operation.
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 32-bit Adler-32 checksum.
+ * 5802 is the largest number of bytes that can be summed before the 32-bit
+ * accumulators may overflow.
  */
-static uint32_t adler32(const char *data, const int length)
+void fletcher16(uint32_t &sum1, uint32_t &sum2, const uint8_t *data,
+                size_t length)
 {
-  const uint32_t MOD_ADLER = 65521;
-  uint32_t a = 1, b = 0;
-
-  for (int i = 0; i < length; ++i)
+  while (length > 0)
   {
-    a = (a + static_cast<uint8_t>(data[i])) % MOD_ADLER;
-    b = (b + a) % MOD_ADLER;
+    const size_t block = std::min<size_t>(length, 5802);
+    for (size_t i = 0; i < block; ++i)
+    {
+      sum1 += data[i];
+      sum2 += sum1;
+    }
+
+    sum1 %= 255;
+    sum2 %= 255;
+    data += block;
+    length -= block;
   }
+}
 
-  return (b << 16) | a;
+/**
+ * @brief Writes @p size bytes of @p value to @p out in big-endian order.
+ */
+qsizetype writeBigEndian(char *out, uint32_t value, qsizetype size)
+{
+  for (qsizetype i = 0; i < size; ++i)
+    out[i] = static_cast<char>(value >> (8 * (size - 1 - i)));
+
+  return size;
 }
 
 /**
- * @brief Computes a Fletcher-16 checksum.
- *
- * Offers stronger error detection than simple checksums, with low overhead.
- *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed Fletcher-16 checksum.
+ * @brief Writes @p size bytes of @p value to @p out in little-endian order.
  */
-static uint16_t fletcher16(const char *data, const int length)
+qsizetype writeLittleEndian(char *out, uint32_t value, qsizetype size)
 {
-  uint16_t sum1 = 0;
-  uint16_t sum2 = 0;
+  for (qsizetype i = 0; i < size; ++i)
+    out[i] = static_cast<char>(value >> (8 * i));
 
-  for (int i = 0; i < length; ++i)
-  {
-    sum1 = (sum1 + static_cast<uint8_t>(data[i])) % 255;
-    sum2 = (sum2 + sum1) % 255;
-  }
+  return size;
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Checksum engine
+//------------------------------------------------------------------------------
 
-  return (sum2 << 8) | sum1;
+/**
+ * @brief Constructs a null engine that produces an empty checksum.
+ */
+IO::ChecksumEngine::ChecksumEngine()
+  : m_algorithm(Algorithm::None)
+  , m_state(0)
+  , m_sum(0)
+{
 }
 
 /**
- * @brief Computes a 16-bit CRC (CRC-16-MODBUS) using polynomial 0x8005
- * (reflected: 0xA001).
+ * @brief Constructs an engine for the algorithm with the given name.
  *
- * Standard in industrial MODBUS RTU communications.
+ * Unknown names produce a null engine.
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 16-bit CRC-MODBUS checksum.
+ * @param name One of the names returned by IO::availableChecksums().
+ */
+IO::ChecksumEngine::ChecksumEngine(const QString &name)
+  : m_algorithm(algorithms().value(name, Algorithm::None))
+  , m_state(0)
+  , m_sum(0)
+{
+  reset();
+}
+
+/**
+ * @brief Returns @c true if the engine does not compute any checksum.
  */
-static uint16_t crc16_modbus(const char *data, const int length)
+bool IO::ChecksumEngine::isNull() const
 {
-  uint16_t crc = 0xFFFF;
+  return m_algorithm == Algorithm::None;
+}
 
-  for (int i = 0; i < length; ++i)
+/**
+ * @brief Returns the number of bytes written by finalize().
+ */
+qsizetype IO::ChecksumEngine::length() const
+{
+  switch (m_algorithm)
   {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
-    {
-      if (crc & 0x0001)
-        crc = (crc >> 1) ^ 0xA001;
-      else
-        crc >>= 1;
-    }
+    case Algorithm::XOR8:
+    case Algorithm::MOD256:
+    case Algorithm::CRC8:
+      return 1;
+    case Algorithm::CRC16:
+    case Algorithm::CRC16Modbus:
+    case Algorithm::CRC16CCITT:
+    case Algorithm::Fletcher16:
+      return 2;
+    case Algorithm::CRC32:
+    case Algorithm::Adler32:
+      return 4;
+    default:
+      return 0;
   }
+}
 
-  return crc;
+/**
+ * @brief Restores the initial register values of the algorithm.
+ */
+void IO::ChecksumEngine::reset()
+{
+  m_sum = 0;
+  switch (m_algorithm)
+  {
+    case Algorithm::CRC8:
+      m_state = 0xFF;
+      break;
+    case Algorithm::CRC16:
+    case Algorithm::CRC16Modbus:
+      m_state = 0xFFFF;
+      break;
+    case Algorithm::CRC32:
+      m_state = 0xFFFFFFFF;
+      break;
+    case Algorithm::Adler32:
+      m_state = 1;
+      break;
+    default:
+      m_state = 0;
+      break;
+  }
 }
 
 /**
- * @brief Computes a 16-bit CRC (CRC-CCITT) using polynomial 0x1021 and initial
- * value 0x0000.
+ * @brief Feeds a block of data into the checksum.
  *
- * Used in XModem, HDLC, and general-purpose data integrity.
+ * May be called any number of times between reset() and finalize().
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed CRC-16-CCITT checksum.
+ * @param data Pointer to the input bytes.
+ * @param length Number of bytes to process.
  */
-static uint16_t crc16_ccitt(const char *data, const int length)
+void IO::ChecksumEngine::update(const char *data, qsizetype length)
 {
-  uint16_t crc = 0x0000;
+  if (length <= 0)
+    return;
 
-  for (int i = 0; i < length; ++i)
+  const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+  const auto size = static_cast<size_t>(length);
+  switch (m_algorithm)
   {
-    crc ^= static_cast<uint8_t>(data[i]) << 8;
-    for (int j = 0; j < 8; ++j)
-    {
-      if (crc & 0x8000)
-        crc = (crc << 1) ^ 0x1021;
-      else
-        crc <<= 1;
-    }
+    case Algorithm::XOR8:
+      for (size_t i = 0; i < size; ++i)
+        m_state ^= bytes[i];
+      break;
+    case Algorithm::MOD256:
+      for (size_t i = 0; i < size; ++i)
+        m_state += bytes[i];
+      break;
+    case Algorithm::CRC8:
+      m_state = crc8(static_cast<uint8_t>(m_state), bytes, size);
+      break;
+    case Algorithm::CRC16:
+    case Algorithm::CRC16CCITT:
+      m_state = crc16(static_cast<uint16_t>(m_state), bytes, size);
+      break;
+    case Algorithm::CRC16Modbus:
+      m_state = crc16_modbus(static_cast<uint16_t>(m_state), bytes, size);
+      break;
+    case Algorithm::Fletcher16:
+      fletcher16(m_state, m_sum, bytes, size);
+      break;
+    case Algorithm::CRC32:
+      m_state = crc32(m_state, bytes, size);
+      break;
+    case Algorithm::Adler32:
+      adler32(m_state, m_sum, bytes, size);
+      break;
+    default:
+      break;
   }
-
-  return crc;
 }
-} // namespace IO
-
-//------------------------------------------------------------------------------
-// Utility functions
-//------------------------------------------------------------------------------
 
 /**
- * @brief Returns a list of supported checksum and CRC algorithm names.
+ * @brief Writes the checksum of all data fed since the last reset().
  *
- * The list is derived directly from the internal checksum function map.
- * It reflects all available algorithms that can be passed to IO::checksum().
+ * The engine state is not modified, so more data may be appended afterwards.
  *
- * @return A reference to a static QStringList containing supported algorithm
- * names.
+ * @param out Destination buffer with room for at least MaxLength bytes.
+ * @return Number of bytes written (same as length()).
  */
-const QStringList &IO::availableChecksums()
+qsizetype IO::ChecksumEngine::finalize(char *out) const
 {
-  static QStringList list;
-  if (list.isEmpty())
+  switch (m_algorithm)
   {
-    const auto &map = checksumFunctionMap();
-    for (auto it = map.begin(); it != map.end(); ++it)
-      list.append(it.key());
+    case Algorithm::XOR8:
+    case Algorithm::MOD256:
+    case Algorithm::CRC8:
+      return writeBigEndian(out, m_state & 0xFF, 1);
+    case Algorithm::CRC16:
+    case Algorithm::CRC16CCITT:
+      return writeBigEndian(out, m_state, 2);
+    case Algorithm::CRC16Modbus:
+      return writeLittleEndian(out, m_state, 2);
+    case Algorithm::Fletcher16:
+      return writeBigEndian(out, (m_sum << 8) | m_state, 2);
+    case Algorithm::CRC32:
+      return writeBigEndian(out, ~m_state, 4);
+    case Algorithm::Adler32:
+      return writeBigEndian(out, (m_sum << 16) | m_state, 4);
+    default:
+      return 0;
   }
+}
 
-  return list;
+/**
+ * @brief Returns the checksum of all data fed since the last reset() as a
+ *        QByteArray.
+ */
+QByteArray IO::ChecksumEngine::result() const
+{
+  char out[MaxLength];
+  const auto size = finalize(out);
+  return QByteArray(out, size);
 }
 
 /**
- * @brief Returns a static map of supported checksum algorithm names to their
- *        implementations.
- *
- * The map keys are canonical algorithm names (e.g., "CRC-16", "Adler-32") and
- * the values are function objects that compute the corresponding checksum over
- * raw input data. Each function returns the checksum as a QByteArray containing
- * the raw bytes (1, 2, or 4 bytes depending on the algorithm).
+ * @brief Returns a static map of supported checksum algorithm names.
  *
- * This map is initialized once and reused for all checksum dispatch operations.
- *
- * @return A reference to the static QMap of checksum algorithm names to
- *         functions.
+ * The map keys are canonical algorithm names (e.g., "CRC-16", "Adler-32").
+ * An empty name maps to "no checksum".
  */
-const QMap<QString, IO::ChecksumFunc> &IO::checksumFunctionMap()
+const QMap<QString, IO::ChecksumEngine::Algorithm> &
+IO::ChecksumEngine::algorithms()
 {
-  static const QMap<QString, IO::ChecksumFunc> map = {
-      {QLatin1String(""), [](const char *, int) { return QByteArray(); }},
+  static const QMap<QString, Algorithm> map = {
+      {QLatin1String(""), Algorithm::None},
 
       // 8-bit checksums
-      {QStringLiteral("XOR-8"),
-       [](const char *d, int l) {
-         uint8_t v = xor8(d, l);
-         return QByteArray(reinterpret_cast<const char *>(&v), sizeof(v));
-       }},
-      {QStringLiteral("MOD-256"),
-       [](const char *d, int l) {
-         uint8_t v = mod256(d, l);
-         return QByteArray(reinterpret_cast<const char *>(&v), sizeof(v));
-       }},
-      {QStringLiteral("CRC-8"),
-       [](const char *d, int l) {
-         uint8_t v = crc8(d, l);
-         return QByteArray(reinterpret_cast<const char *>(&v), sizeof(v));
-       }},
+      {QStringLiteral("XOR-8"), Algorithm::XOR8},
+      {QStringLiteral("MOD-256"), Algorithm::MOD256},
+      {QStringLiteral("CRC-8"), Algorithm::CRC8},
 
       // 16-bit checksums
-      {QStringLiteral("CRC-16"),
-       [](const char *d, int l) {
-         uint8_t out[2];
-         uint16_t v = crc16(d, l);
-         big_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
-      {QStringLiteral("CRC-16-MODBUS"),
-       [](const char *d, int l) {
-         uint8_t out[2];
-         uint16_t v = crc16_modbus(d, l);
-         little_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
-      {QStringLiteral("CRC-16-CCITT"),
-       [](const char *d, int l) {
-         uint8_t out[2];
-         uint16_t v = crc16_ccitt(d, l);
-         big_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
-      {QStringLiteral("Fletcher-16"),
-       [](const char *d, int l) {
-         uint8_t out[2];
-         uint16_t v = fletcher16(d, l);
-         big_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
+      {QStringLiteral("CRC-16"), Algorithm::CRC16},
+      {QStringLiteral("CRC-16-MODBUS"), Algorithm::CRC16Modbus},
+      {QStringLiteral("CRC-16-CCITT"), Algorithm::CRC16CCITT},
+      {QStringLiteral("Fletcher-16"), Algorithm::Fletcher16},
 
       // 32-bit checksums
-      {QStringLiteral("CRC-32"),
-       [](const char *d, int l) {
-         uint8_t out[4];
-         uint32_t v = crc32(d, l);
-         big_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
-      {QStringLiteral("Adler-32"),
-       [](const char *d, int l) {
-         uint8_t out[4];
-         uint32_t v = adler32(d, l);
-         big_endian_memcpy(out, &v, sizeof(v));
-         return QByteArray(reinterpret_cast<char *>(out), sizeof(out));
-       }},
+      {QStringLiteral("CRC-32"), Algorithm::CRC32},
+      {QStringLiteral("Adler-32"), Algorithm::Adler32},
   };
 
   return map;
 }
 
+//------------------------------------------------------------------------------
+// Utility functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns a list of supported checksum and CRC algorithm names.
+ *
+ * It reflects all available algorithms that can be passed to IO::checksum()
+ * and IO::ChecksumEngine.
+ *
+ * @return A reference to a static QStringList containing supported algorithm
+ * names.
+ */
+const QStringList &IO::availableChecksums()
+{
+  static const QStringList list = ChecksumEngine::algorithms().keys();
+  return list;
+}
+
 /**
  * @brief Computes a checksum or CRC value for the given data using the
  * specified algorithm.
@@ -456,6 +673,9 @@ const QMap<QString, IO::ChecksumFunc> &IO::checksumFunctionMap()
  * The algorithm name must match exactly one of the entries returned by
  * IO::availableChecksums(). The comparison is case-sensitive.
  *
+ * @note For per-frame validation, construct an IO::ChecksumEngine once and
+ *       reuse it instead of calling this function.
+ *
  * @param name Name of the checksum or CRC algorithm.
  * @param data Input data buffer to be checksummed.
  *
@@ -464,10 +684,7 @@ const QMap<QString, IO::ChecksumFunc> &IO::checksumFunctionMap()
  */
 QByteArray IO::checksum(const QString &name, const QByteArray &data)
 {
-  const auto &map = checksumFunctionMap();
-  const auto it = map.find(name);
-  if (it != map.end())
-    return it.value()(data.constData(), data.size());
-
-  return {};
+  ChecksumEngine engine(name);
+  engine.update(data.constData(), data.size());
+  return engine.result();
 }
@@ -22,13 +22,78 @@
 #pragma once
 
 #include <QMap>
+#include <QByteArray>
 #include <QStringList>
 
+#include <cstdint>
+
 namespace IO
 {
-using ChecksumFunc = std::function<QByteArray(const char *, int)>;
+/**
+ * @class IO::ChecksumEngine
+ * @brief Incremental checksum/CRC calculator resolved once per algorithm.
+ *
+ * The engine is created from one of the names returned by
+ * IO::availableChecksums(). After that, computing a checksum involves no
+ * string lookups, no type-erased calls and no heap allocations:
+ *
+ * @code
+ * IO::ChecksumEngine crc(QStringLiteral("CRC-32"));
+ * crc.reset();
+ * crc.update(block1, size1);
+ * crc.update(block2, size2);
+ *
+ * char out[IO::ChecksumEngine::MaxLength];
+ * const auto length = crc.finalize(out);
+ * @endcode
+ *
+ * CRCs are table-driven; CRC-32 uses slicing-by-8 tables and switches to a
+ * carry-less multiplication (PCLMULQDQ) folding kernel for large inputs when
+ * the CPU supports it.
+ *
+ * The output byte order matches the values produced by IO::checksum().
+ */
+class ChecksumEngine
+{
+public:
+  static constexpr qsizetype MaxLength = 4;
+
+  ChecksumEngine();
+  explicit ChecksumEngine(const QString &name);
+
+  [[nodiscard]] bool isNull() const;
+  [[nodiscard]] qsizetype length() const;
+
+  void reset();
+  void update(const char *data, qsizetype length);
+  qsizetype finalize(char *out) const;
+
+  [[nodiscard]] QByteArray result() const;
+
+private:
+  enum class Algorithm : uint8_t
+  {
+    None,
+    XOR8,
+    MOD256,
+    CRC8,
+    CRC16,
+    CRC16Modbus,
+    CRC16CCITT,
+    Fletcher16,
+    CRC32,
+    Adler32,
+  };
+
+  static const QMap<QString, Algorithm> &algorithms();
+  friend const QStringList &availableChecksums();
+
+private:
+  Algorithm m_algorithm;
+  uint32_t m_state;
+  uint32_t m_sum;
+};
 
 [[nodiscard]] const QStringList &availableChecksums();
-[[nodiscard]] const QMap<QString, ChecksumFunc> &checksumFunctionMap();
 [[nodiscard]] QByteArray checksum(const QString &name, const QByteArray &data);
 } // namespace IO
@@ -23,10 +23,252 @@
 
 #include <vector>
 #include <cstring>
+#include <algorithm>
 #include <QByteArray>
 
 namespace IO
 {
+/**
+ * @brief Precompiled byte pattern used to search a CircularBuffer.
+ *
+ * Stores the pattern bytes together with its Knuth-Morris-Pratt (KMP) failure
+ * table, so that the table is computed once when a delimiter is configured
+ * instead of on every search.
+ *
+ * Patterns of one or two bytes (e.g. `\n` or `\r\n`) skip the KMP table and
+ * are searched with `memchr()`, which is vectorized by most C libraries.
+ */
+class PatternMatcher
+{
+public:
+  PatternMatcher() = default;
+
+  /**
+   * @brief Compiles a search pattern.
+   * @param pattern The byte sequence to search for.
+   */
+  explicit PatternMatcher(const QByteArray &pattern)
+  {
+    m_bytes.assign(pattern.cbegin(), pattern.cend());
+    computeKMPTable();
+  }
+
+  /**
+   * @brief Returns the number of bytes in the pattern.
+   */
+  [[nodiscard]] qsizetype size() const
+  {
+    return static_cast<qsizetype>(m_bytes.size());
+  }
+
+  /**
+   * @brief Returns @c true if the pattern has no bytes.
+   */
+  [[nodiscard]] bool isEmpty() const { return m_bytes.empty(); }
+
+  /**
+   * @brief Returns the pattern byte at @p index.
+   */
+  [[nodiscard]] uint8_t at(qsizetype index) const { return m_bytes[index]; }
+
+  /**
+   * @brief Returns the KMP fallback position for a mismatch after @p matched
+   *        bytes.
+   */
+  [[nodiscard]] int fallback(int matched) const { return m_lps[matched - 1]; }
+
+private:
+  /**
+   * @brief Computes the longest prefix suffix (LPS) table for the pattern.
+   */
+  void computeKMPTable()
+  {
+    const qsizetype m = size();
+    m_lps.assign(m, 0);
+
+    qsizetype len = 0;
+    qsizetype i = 1;
+    while (i < m)
+    {
+      if (m_bytes[i] == m_bytes[len])
+      {
+        len++;
+        m_lps[i++] = len;
+      }
+
+      else if (len != 0)
+        len = m_lps[len - 1];
+
+      else
+        m_lps[i++] = 0;
+    }
+  }
+
+private:
+  std::vector<int> m_lps;
+  std::vector<uint8_t> m_bytes;
+};
+
+/**
+ * @brief Read-only, non-owning view over a range of a CircularBuffer.
+ *
+ * Because the data of a ring buffer may wrap around the end of its storage, a
+ * range is described by up to two contiguous segments:
+ *
+ *   [first, first + firstSize)  followed by  [second, second + secondSize)
+ *
+ * The view allows random access, sub-ranges and linear scans of the segments
+ * without copying. Use copy() to materialize an owning container once the data
+ * must outlive the next modification of the buffer.
+ *
+ * @warning A view is invalidated by any call that modifies the buffer it was
+ *          obtained from (append, read, discard, clear...).
+ *
+ * @tparam T Owning container type returned by copy() (e.g., QByteArray).
+ * @tparam StorageType The element type used by the circular buffer.
+ */
+template<typename T, typename StorageType = uint8_t>
+class CircularBufferView
+{
+public:
+  CircularBufferView()
+    : m_first(nullptr)
+    , m_second(nullptr)
+    , m_firstSize(0)
+    , m_secondSize(0)
+  {
+  }
+
+  CircularBufferView(const StorageType *first, qsizetype firstSize,
+                     const StorageType *second, qsizetype secondSize)
+    : m_first(first)
+    , m_second(second)
+    , m_firstSize(firstSize)
+    , m_secondSize(secondSize)
+  {
+  }
+
+  /**
+   * @brief Returns the total number of elements covered by the view.
+   */
+  [[nodiscard]] qsizetype size() const { return m_firstSize + m_secondSize; }
+
+  /**
+   * @brief Returns @c true if the view does not cover any element.
+   */
+  [[nodiscard]] bool isEmpty() const { return size() == 0; }
+
+  /**
+   * @brief Returns @c true if the view is stored in a single segment.
+   */
+  [[nodiscard]] bool isContiguous() const { return m_secondSize == 0; }
+
+  /**
+   * @brief Returns a pointer to the first contiguous segment.
+   */
+  [[nodiscard]] const StorageType *first() const { return m_first; }
+
+  /**
+   * @brief Returns a pointer to the second contiguous segment (may be null).
+   */
+  [[nodiscard]] const StorageType *second() const { return m_second; }
+
+  /**
+   * @brief Returns the number of elements in the first segment.
+   */
+  [[nodiscard]] qsizetype firstSize() const { return m_firstSize; }
+
+  /**
+   * @brief Returns the number of elements in the second segment.
+   */
+  [[nodiscard]] qsizetype secondSize() const { return m_secondSize; }
+
+  /**
+   * @brief Provides read-only access to the element at @p index.
+   * @param index Index relative to the start of the view, in [0, size()).
+   */
+  [[nodiscard]] const StorageType &operator[](qsizetype index) const
+  {
+    if (index < m_firstSize)
+      return m_first[index];
+
+    return m_second[index - m_firstSize];
+  }
+
+  /**
+   * @brief Returns a sub-view of @p length elements starting at @p pos.
+   *
+   * The range is clamped to the bounds of this view.
+   */
+  [[nodiscard]] CircularBufferView mid(qsizetype pos, qsizetype length) const
+  {
+    pos = std::clamp<qsizetype>(pos, 0, size());
+    length = std::clamp<qsizetype>(length, 0, size() - pos);
+
+    if (pos >= m_firstSize)
+      return CircularBufferView(m_second + (pos - m_firstSize), length,
+                                nullptr, 0);
+
+    const qsizetype n0 = std::min(length, m_firstSize - pos);
+    return CircularBufferView(m_first + pos, n0, m_second, length - n0);
+  }
+
+  /**
+   * @brief Copies the elements of the view into @p dest.
+   * @param dest Destination buffer with room for at least size() elements.
+   */
+  void copyTo(StorageType *dest) const
+  {
+    if (m_firstSize > 0)
+      std::memcpy(dest, m_first, m_firstSize * sizeof(StorageType));
+    if (m_secondSize > 0)
+      std::memcpy(dest + m_firstSize, m_second,
+                  m_secondSize * sizeof(StorageType));
+  }
+
+  /**
+   * @brief Returns an owning copy of the elements covered by the view.
+   */
+  [[nodiscard]] T copy() const
+  {
+    T result;
+    result.resize(size());
+    copyTo(reinterpret_cast<StorageType *>(result.data()));
+    return result;
+  }
+
+  /**
+   * @brief Compares the elements of the view with a raw byte sequence.
+   *
+   * @param data Pointer to the bytes to compare against.
+   * @param length Number of bytes pointed to by @p data.
+   * @return @c true if both ranges have the same size and contents.
+   */
+  [[nodiscard]] bool equals(const void *data, qsizetype length) const
+  {
+    if (length != size())
+      return false;
+
+    const auto *bytes = static_cast<const StorageType *>(data);
+    if (m_firstSize > 0
+        && std::memcmp(m_first, bytes, m_firstSize * sizeof(StorageType)))
+      return false;
+
+    if (m_secondSize > 0
+        && std::memcmp(m_second, bytes + m_firstSize,
+                       m_secondSize * sizeof(StorageType)))
+      return false;
+
+    return true;
+  }
+
+private:
+  const StorageType *m_first;
+  const StorageType *m_second;
+  qsizetype m_firstSize;
+  qsizetype m_secondSize;
+};
+
 /**
  * @brief A generic circular buffer for managing data with fixed capacity.
  *
@@ -43,6 +285,8 @@ template<typename T, typename StorageType = uint8_t>
 class CircularBuffer
 {
 public:
+  using View = CircularBufferView<T, StorageType>;
+
   explicit CircularBuffer(qsizetype capacity = 1024 * 1024 * 10);
 
   [[nodiscard]] StorageType &operator[](qsizetype index);
@@ -54,13 +298,17 @@ public:
   [[nodiscard]] qsizetype size() const;
   [[nodiscard]] qsizetype freeSpace() const;
 
+  void discard(qsizetype size);
   [[nodiscard]] T read(qsizetype size);
   [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] View view(qsizetype pos, qsizetype length) const;
 
-  [[nodiscard]] int findPatternKMP(const T &pattern, const int pos = 0);
+  [[nodiscard]] int findPattern(const PatternMatcher &pattern,
+                                const qsizetype pos = 0) const;
 
 private:
-  [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
+  [[nodiscard]] const StorageType *contiguous(qsizetype index,
+                                              qsizetype &length) const;
 
 private:
   qsizetype m_size;
@@ -202,6 +450,22 @@ qsizetype IO::CircularBuffer<T, StorageType>::freeSpace() const
   return m_capacity - m_size;
 }
 
+/**
+ * @brief Removes data from the front of the circular buffer without copying.
+ *
+ * @param size The number of bytes to remove.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::discard(qsizetype size)
+{
+  if (size > m_size)
+    throw std::underflow_error("Not enough data in buffer");
+
+  m_head = (m_head + size) % m_capacity;
+  m_size -= size;
+}
+
 /**
  * @brief Reads data from the circular buffer.
  *
@@ -266,107 +530,143 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
 }
 
 /**
- * @brief Searches for a pattern in the circular buffer using the KMP algorithm.
+ * @brief Returns a zero-copy view over a range of the buffer.
  *
- * This function uses the Knuth-Morris-Pratt (KMP) string matching algorithm
- * to efficiently find the first occurrence of a given pattern within the
- * circular buffer, starting from a specified position. The circular nature of
- * the buffer is correctly handled to ensure accurate matching, even if the
- * pattern spans the end of the buffer and the beginning.
+ * The range is clamped to the data currently stored in the buffer. The view
+ * stays valid until the buffer is modified.
  *
- * @tparam T The type of elements stored in the pattern and the buffer.
- * @tparam StorageType The type of storage used for the circular buffer.
- * @param pattern The pattern to search for in the buffer.
- * @param pos The starting position (relative to the logical start of the
- *            buffer) for the search. Defaults to the beginning if set to 0.
+ * @param pos Logical index of the first element of the range.
+ * @param length Number of elements in the range.
+ * @return A view composed of up to two contiguous segments.
+ */
+template<typename T, typename StorageType>
+typename IO::CircularBuffer<T, StorageType>::View
+IO::CircularBuffer<T, StorageType>::view(qsizetype pos, qsizetype length) const
+{
+  pos = std::clamp<qsizetype>(pos, 0, m_size);
+  length = std::clamp<qsizetype>(length, 0, m_size - pos);
+  if (length == 0)
+    return View();
+
+  qsizetype firstSize;
+  const auto *first = contiguous(pos, firstSize);
+  if (firstSize >= length)
+    return View(first, length, nullptr, 0);
+
+  return View(first, firstSize, m_buffer.data(), length - firstSize);
+}
+
+/**
+ * @brief Returns a pointer to the contiguous block starting at a logical
+ *        index.
  *
- * @return The index (relative to the logical start of the buffer) of the first
- *         occurrence of the pattern, or -1 if the pattern is not found.
+ * The logical data of the ring is stored in at most two contiguous blocks.
+ * This function maps @p index to its physical location and reports how many
+ * bytes can be read linearly from there before wrapping around or reaching
+ * the end of the valid data.
  *
- * @warning If the `pattern` is empty or its size exceeds the current size of
- *          the buffer, the function returns -1 immediately.
+ * @param index Logical index (0 = oldest byte in the buffer).
+ * @param length Output number of bytes readable from the returned pointer.
+ * @return Pointer into the internal storage.
+ */
+template<typename T, typename StorageType>
+const StorageType *
+IO::CircularBuffer<T, StorageType>::contiguous(qsizetype index,
+                                               qsizetype &length) const
+{
+  qsizetype physical = m_head + index;
+  if (physical >= m_capacity)
+    physical -= m_capacity;
+
+  length = std::min(m_size - index, m_capacity - physical);
+  return m_buffer.data() + physical;
+}
+
+/**
+ * @brief Searches for a precompiled pattern in the circular buffer.
+ *
+ * The search walks the two contiguous blocks of the ring directly instead of
+ * computing a modulo per byte:
  *
- * @pre The buffer must be properly initialized, and the pattern should not
- *      exceed the capacity of the buffer.
+ * - One and two byte patterns are located with `memchr()` on the first byte,
+ *   checking the second byte (which may lie across the wrap point) on a hit.
+ * - Longer patterns use the Knuth-Morris-Pratt algorithm with the failure
+ *   table stored in @p pattern, so no allocation happens per search.
+ *
+ * @param pattern The compiled pattern to search for.
+ * @param pos The starting position (relative to the logical start of the
+ *            buffer) for the search.
+ *
+ * @return The index (relative to the logical start of the buffer) of the first
+ *         occurrence of the pattern at or after @p pos, or -1 if not found.
  */
 template<typename T, typename StorageType>
-int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
-                                                       const int pos)
+int IO::CircularBuffer<T, StorageType>::findPattern(
+    const PatternMatcher &pattern, const qsizetype pos) const
 {
   // Validate search pattern
-  if (pattern.isEmpty() || m_size < pattern.size())
+  const qsizetype n = pattern.size();
+  if (n == 0 || pos < 0 || m_size < n || pos > m_size - n)
     return -1;
 
-  // Start search at `pos`
-  std::vector<int> lps = computeKMPTable(pattern);
-  qsizetype bufferIdx = (m_head + pos) % m_capacity;
-  int i = pos, j = 0;
-
-  while (i < m_size)
+  // Fast path for short delimiters
+  if (n <= 2)
   {
-    // Compare current buffer character with the pattern
-    if (m_buffer[bufferIdx] == pattern[j])
+    const auto first = pattern.at(0);
+    const qsizetype last = m_size - n;
+
+    qsizetype i = pos;
+    while (i <= last)
     {
-      i++;
-      j++;
-      bufferIdx = (bufferIdx + 1) % m_capacity;
+      qsizetype length;
+      const auto *block = contiguous(i, length);
+      const auto *hit = static_cast<const StorageType *>(
+          std::memchr(block, first, static_cast<size_t>(length)));
 
-      // If the whole pattern is matched, return the logical start index
-      if (j == pattern.size())
+      if (!hit)
       {
-        int matchStart = i - j;
-        return matchStart;
+        i += length;
+        continue;
       }
-    }
 
-    // Mismatch after some matches, fall back in pattern
-    else if (j != 0)
-      j = lps[j - 1];
+      const qsizetype index = i + (hit - block);
+      if (index > last)
+        return -1;
 
-    // Mismatch at the start, move forward
-    else
-    {
-      i++;
-      bufferIdx = (bufferIdx + 1) % m_capacity;
-    }
-  }
+      if (n == 1)
+        return static_cast<int>(index);
 
-  // Pattern not found
-  return -1;
-}
+      qsizetype nextLength;
+      const auto next = static_cast<uint8_t>(*contiguous(index + 1, nextLength));
+      if (next == pattern.at(1))
+        return static_cast<int>(index);
 
-/**
- * @brief Computes the KMP table for a given p.
- *
- * Prepares the longest prefix suffix (LPS) table used by the KMP algorithm.
- *
- * @param p The QByteArray representing the p.
- * @return A vector of integers representing the LPS table.
- */
-template<typename T, typename StorageType>
-std::vector<int>
-IO::CircularBuffer<T, StorageType>::computeKMPTable(const T &p) const
-{
-  qsizetype m = p.size();
-  std::vector<int> lps(m, 0);
+      i = index + 1;
+    }
 
-  qsizetype len = 0;
-  qsizetype i = 1;
+    return -1;
+  }
 
-  while (i < m)
+  // KMP search over both contiguous blocks
+  int j = 0;
+  qsizetype i = pos;
+  while (i < m_size)
   {
-    if (p[i] == p[len])
+    qsizetype length;
+    const auto *block = contiguous(i, length);
+    for (qsizetype k = 0; k < length; ++k)
     {
-      len++;
-      lps[i++] = len;
-    }
+      const auto c = static_cast<uint8_t>(block[k]);
+      while (j > 0 && c != pattern.at(j))
+        j = pattern.fallback(j);
 
-    else if (len != 0)
-      len = lps[len - 1];
+      if (c == pattern.at(j) && ++j == n)
+        return static_cast<int>(i + k - n + 1);
+    }
 
-    else
-      lps[i++] = 0;
+    i += length;
   }
 
-  return lps;
+  // Pattern not found
+  return -1;
 }
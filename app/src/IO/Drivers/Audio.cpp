@@ -28,6 +28,25 @@
 
 #include <QtEndian>
 
+#include <algorithm>
+
+//------------------------------------------------------------------------------
+// Ring buffer sizes
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Number of capture blocks that can be queued for the input worker.
+ *
+ * With 16 KiB blocks, this holds ~340 ms of 8-channel 32-bit audio at
+ * 192 kHz, while the worker drains the ring every 10 ms.
+ */
+static constexpr std::size_t kInputRingBlocks = 128;
+
+/**
+ * @brief Number of playback frames that can be queued by write().
+ */
+static constexpr std::size_t kOutputRingFrames = 8192;
+
 //------------------------------------------------------------------------------
 // Utility functions
 //------------------------------------------------------------------------------
@@ -63,6 +82,62 @@ static bool deviceListsDiffer(const QVector<ma_device_info> &a,
   return false;
 }
 
+/**
+ * @brief Converts interleaved little-endian samples to numbers.
+ *
+ * Integer formats keep their native range (no normalization), so that the
+ * values match the ones written by the CSV text path.
+ *
+ * @param src    Raw sample data, as delivered by MiniAudio.
+ * @param dst    Output array with room for @p count values.
+ * @param count  Number of samples (frames times channels) to convert.
+ * @param format Sample format of @p src.
+ */
+static void decodeSamples(const char *src, double *dst, const qsizetype count,
+                          const ma_format format)
+{
+  const auto *b = reinterpret_cast<const quint8 *>(src);
+  switch (format)
+  {
+    case ma_format_u8:
+      for (qsizetype i = 0; i < count; ++i)
+        dst[i] = b[i];
+      break;
+    case ma_format_s16:
+      for (qsizetype i = 0; i < count; ++i)
+        dst[i] = qFromLittleEndian<qint16>(b + i * 2);
+      break;
+    case ma_format_s24:
+      for (qsizetype i = 0; i < count; ++i, b += 3)
+      {
+        qint32 sample = static_cast<qint32>(b[0])
+                        | (static_cast<qint32>(b[1]) << 8)
+                        | (static_cast<qint32>(b[2]) << 16);
+
+        if (sample & 0x800000)
+          sample |= 0xFF000000;
+
+        dst[i] = sample;
+      }
+      break;
+    case ma_format_s32:
+      for (qsizetype i = 0; i < count; ++i)
+        dst[i] = qFromLittleEndian<qint32>(b + i * 4);
+      break;
+    case ma_format_f32:
+      for (qsizetype i = 0; i < count; ++i)
+      {
+        float sample;
+        std::memcpy(&sample, b + i * 4, sizeof(float));
+        dst[i] = sample;
+      }
+      break;
+    default:
+      std::fill(dst, dst + count, 0.0);
+      break;
+  }
+}
+
 /**
  * @brief Extracts audio device capabilities using MiniAudio's backend context.
  *
@@ -265,6 +340,9 @@ IO::Drivers::Audio::Audio()
   , m_selectedOutputDevice(-1)
   , m_selectedOutputSampleFormat(0)
   , m_selectedOutputChannelConfiguration(0)
+  , m_inputOverruns(0)
+  , m_numericOutput(false)
+  , m_samplesNotifyPending(false)
   , m_inputWorkerTimer(nullptr)
 {
   // Manually select backend for each operating system
@@ -353,7 +431,7 @@ IO::Drivers::Audio &IO::Drivers::Audio::instance()
  * - Uninitializes the MiniAudio device
  * - Stops and deletes the worker timer used for input processing
  * - Gracefully shuts down the input worker thread
- * - Clears both the input buffer and output queue (thread-safe)
+ * - Drops any samples left in the capture & playback rings
  * - Updates the internal state to reflect that the device is closed
  *
  * It ensures proper teardown of all audio-related resources to avoid memory
@@ -384,18 +462,22 @@ void IO::Drivers::Audio::closeDevice()
     m_inputWorkerThread.wait();
   }
 
-  // Clear internal input buffer
+  // Drop queued samples, both the audio callback & the worker are stopped
+  if (m_inputRing)
   {
-    QMutexLocker locker(&m_inputBufferLock);
-    m_rawInput.clear();
+    while (m_inputRing->try_pop())
+      continue;
   }
 
-  // Clear internal output queue
+  if (m_outputRing)
   {
-    QMutexLocker locker(&m_outputBufferLock);
-    m_outputQueue.clear();
+    while (m_outputRing->try_pop())
+      continue;
   }
 
+  // Reset overrun counter
+  m_inputOverruns = 0;
+
   // Set open flag to false
   m_isOpen = false;
 }
@@ -476,6 +558,13 @@ bool IO::Drivers::Audio::configurationOk() const
 /**
  * @brief Writes a CSV-formatted audio frame into the internal output queue.
  *
+ * The frame is encoded in the playback format and pushed to the playback
+ * ring, which is drained by the audio callback.
+ *
+ * @note The playback ring has a single producer, so this function must
+ *       always be called from the same thread (normally the GUI thread,
+ *       through IO::Manager::writeData()).
+ *
  * @param data A comma-separated list of channel values (1 per channel).
  * @return Number of bytes written, or 0 if invalid.
  */
@@ -499,108 +588,110 @@ quint64 IO::Drivers::Audio::write(const QByteArray &data)
     return 0;
   }
 
-  // Initialize a vector with outputs for each channel
-  QVector<quint8> frame;
+  // Ensure that the encoded frame fits in a ring slot
+  OutputFrame frame;
+  const auto frameBytes = ma_get_bytes_per_frame(format, channels);
+  if (frameBytes == 0 || frameBytes > frame.bytes.size())
+  {
+    qWarning() << "Unsupported output format or channel count";
+    return 0;
+  }
+
+  // Encode each channel value in the output format
+  quint8 *dst = frame.bytes.data();
   for (int i = 0; i < channels; ++i)
   {
     bool ok = false;
-
-    // Convert to uint8_t
-    if (format == ma_format_u8)
+    switch (format)
     {
-      int value = parts[i].toInt(&ok);
-      if (!ok)
-      {
-        qWarning() << "Invalid Unigned 8-bit number:" << parts[i];
-        return 0;
-      }
-
-      frame.append(static_cast<quint8>(qBound(0, value, 255)));
-      break;
-    }
+      // Convert to uint8_t
+      case ma_format_u8: {
+        const int value = parts[i].toInt(&ok);
+        if (!ok)
+        {
+          qWarning() << "Invalid Unigned 8-bit number:" << parts[i];
+          return 0;
+        }
 
-    // Convert to int16_t
-    else if (format == ma_format_s16)
-    {
-      int value = parts[i].toInt(&ok);
-      if (!ok)
-      {
-        qWarning() << "Invalid Signed 16-bit number:" << parts[i];
-        return 0;
+        *dst++ = static_cast<quint8>(qBound(0, value, 255));
+        break;
       }
 
-      const qint16 sample = static_cast<qint16>(qBound(-32768, value, 32767));
-      const quint8 *bytes = reinterpret_cast<const quint8 *>(&sample);
-      frame.append(bytes[0]);
-      frame.append(bytes[1]);
-      break;
-    }
+      // Convert to int16_t
+      case ma_format_s16: {
+        const int value = parts[i].toInt(&ok);
+        if (!ok)
+        {
+          qWarning() << "Invalid Signed 16-bit number:" << parts[i];
+          return 0;
+        }
 
-    // Convert to 24-bit signed integer (S24LE, packed 3 bytes)
-    else if (format == ma_format_s24)
-    {
-      int value = parts[i].toInt(&ok);
-      if (!ok)
-      {
-        qWarning() << "Invalid Signed 24-bit number:" << parts[i];
-        return 0;
+        const auto sample = static_cast<qint16>(qBound(-32768, value, 32767));
+        qToLittleEndian<qint16>(sample, dst);
+        dst += sizeof(qint16);
+        break;
       }
 
-      value = qBound(-8388608, value, 8388607);
-      frame.append(static_cast<quint8>(value & 0xFF));
-      frame.append(static_cast<quint8>((value >> 8) & 0xFF));
-      frame.append(static_cast<quint8>((value >> 16) & 0xFF));
-      break;
-    }
+      // Convert to 24-bit signed integer (S24LE, packed 3 bytes)
+      case ma_format_s24: {
+        int value = parts[i].toInt(&ok);
+        if (!ok)
+        {
+          qWarning() << "Invalid Signed 24-bit number:" << parts[i];
+          return 0;
+        }
 
-    // Convert to 32-bit signed integer
-    else if (format == ma_format_s32)
-    {
-      qint32 value = parts[i].toInt(&ok);
-      if (!ok)
-      {
-        qWarning() << "Invalid Signed 32-bit number:" << parts[i];
-        return 0;
+        value = qBound(-8388608, value, 8388607);
+        *dst++ = static_cast<quint8>(value & 0xFF);
+        *dst++ = static_cast<quint8>((value >> 8) & 0xFF);
+        *dst++ = static_cast<quint8>((value >> 16) & 0xFF);
+        break;
       }
 
-      value = qBound(-2147483647, value, 2147483647);
-      const quint8 *bytes = reinterpret_cast<const quint8 *>(&value);
-      frame.append(bytes[0]);
-      frame.append(bytes[1]);
-      frame.append(bytes[2]);
-      frame.append(bytes[3]);
-      break;
-    }
+      // Convert to 32-bit signed integer
+      case ma_format_s32: {
+        qint32 value = parts[i].toInt(&ok);
+        if (!ok)
+        {
+          qWarning() << "Invalid Signed 32-bit number:" << parts[i];
+          return 0;
+        }
 
-    // Convert to 32-bit float
-    else if (format == ma_format_f32)
-    {
-      float value = parts[i].toFloat(&ok);
-      if (!ok)
-      {
-        qWarning() << "Invalid 32-bit Float number:" << parts[i];
-        return 0;
+        value = qBound(-2147483647, value, 2147483647);
+        qToLittleEndian<qint32>(value, dst);
+        dst += sizeof(qint32);
+        break;
       }
 
-      value = qBound(-1.0f, value, 1.0f);
-      const quint8 *bytes = reinterpret_cast<const quint8 *>(&value);
-      for (size_t b = 0; b < sizeof(float); ++b)
-        frame.append(bytes[b]);
+      // Convert to 32-bit float
+      case ma_format_f32: {
+        float value = parts[i].toFloat(&ok);
+        if (!ok)
+        {
+          qWarning() << "Invalid 32-bit Float number:" << parts[i];
+          return 0;
+        }
 
-      break;
-    }
+        value = qBound(-1.0f, value, 1.0f);
+        std::memcpy(dst, &value, sizeof(float));
+        dst += sizeof(float);
+        break;
+      }
 
-    // Unsupported format
-    else
-    {
-      qWarning() << "Unsupported format:" << static_cast<int>(format);
-      return 0;
+      // Unsupported format
+      default:
+        qWarning() << "Unsupported format:" << static_cast<int>(format);
+        return 0;
     }
   }
 
-  // Write data to output queue
-  QMutexLocker locker(&m_outputBufferLock);
-  m_outputQueue.push_back(std::move(frame));
+  // Hand the frame to the audio callback, without blocking
+  frame.size = frameBytes;
+  if (!m_outputRing->try_enqueue(std::move(frame)))
+  {
+    qWarning() << "Audio output queue is full, dropping frame";
+    return 0;
+  }
 
   // Return the number of bytes that have been written
   return data.size();
@@ -694,6 +785,12 @@ bool IO::Drivers::Audio::open(const QIODevice::OpenMode mode)
     m_config.playback.channels = 0;
   }
 
+  // Allocate the capture & playback rings outside of the audio callback
+  if (!m_inputRing)
+    m_inputRing = std::make_unique<Ring<InputBlock>>(kInputRingBlocks);
+  if (!m_outputRing)
+    m_outputRing = std::make_unique<Ring<OutputFrame>>(kOutputRingFrames);
+
   // Try to initialize the duplex device
   std::memset(&m_device, 0, sizeof(m_device));
   if (ma_device_init(&m_context, &m_config, &m_device) != MA_SUCCESS)
@@ -1015,6 +1112,66 @@ QStringList IO::Drivers::Audio::outputChannelConfigurations() const
   return list;
 }
 
+//------------------------------------------------------------------------------
+// Numeric sample output
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Checks whether captured audio is published as numbers through
+ *        takeSamples() instead of CSV text through `dataReceived()`.
+ */
+bool IO::Drivers::Audio::numericOutput() const
+{
+  return m_numericOutput.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Retrieves the next block of captured samples, if any.
+ *
+ * Must only be called from a single consumer thread. Calling this function
+ * also re-arms the samplesReady() notification, so a consumer should keep
+ * calling it until it returns @c false.
+ *
+ * @param samples Receives the block; pass it back through recycleSamples()
+ *                once it has been processed.
+ * @return @c true if a block was retrieved.
+ */
+bool IO::Drivers::Audio::takeSamples(AudioSamples &samples)
+{
+  m_samplesNotifyPending.store(false, std::memory_order_release);
+  return m_sampleQueue.try_dequeue(samples);
+}
+
+/**
+ * @brief Returns a processed block to the driver so that its memory can be
+ *        reused for upcoming samples.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param samples The block previously obtained through takeSamples().
+ */
+void IO::Drivers::Audio::recycleSamples(AudioSamples &&samples)
+{
+  samples.values.clear();
+  (void)m_recycledSamples.try_enqueue(std::move(samples));
+}
+
+/**
+ * @brief Selects how captured audio is handed over to the application.
+ *
+ * When enabled, samples are converted straight to numbers and published
+ * through takeSamples(), skipping the CSV text round trip. This is only
+ * useful if the consumer does not need text frames (i.e. in Quick Plot
+ * mode), since `dataReceived()` is not emitted and the frame reader stays
+ * silent. The consumer is responsible for feeding the raw data consumers.
+ *
+ * @param enabled @c true to publish numeric sample blocks.
+ */
+void IO::Drivers::Audio::setNumericOutput(const bool enabled)
+{
+  m_numericOutput.store(enabled, std::memory_order_relaxed);
+}
+
 //------------------------------------------------------------------------------
 // Sample rate configuration
 //------------------------------------------------------------------------------
@@ -1314,14 +1471,17 @@ void IO::Drivers::Audio::configureOutput()
  * @brief Converts raw audio input into CSV-formatted text and emits it.
  *
  * This function is periodically called by a high-resolution timer running
- * in a worker thread. It processes the raw audio buffer filled by the
- * MiniAudio callback, converts each frame to a CSV-like string, and emits
- * the result via the `dataReceived` signal.
+ * in a worker thread. It drains the capture ring filled by the MiniAudio
+ * callback, converts each frame to a CSV-like string, and emits the result
+ * via the `dataReceived` signal.
+ *
+ * If numeric output is enabled, the samples are handed to publishSamples()
+ * instead, and no text is generated at all.
  *
  * The function performs the following steps:
- * - Locks and swaps out the internal raw audio buffer (`m_rawInput`)
- *   to avoid contention.
- * - Validates audio configuration and buffer integrity.
+ * - Reports capture blocks dropped because the ring was full.
+ * - Dequeues each block into a reusable scratch block, without locking or
+ *   allocating memory.
  * - Parses each frame based on sample format (`u8`, `s16`, `s32`, or `f32`)
  *   and channel count.
  * - Writes parsed values into a reusable `QBuffer`-backed `QTextStream`
@@ -1329,90 +1489,101 @@ void IO::Drivers::Audio::configureOutput()
  * - Flushes the stream to ensure the data is written into `m_csvData`.
  * - Emits only the valid portion of the buffer via `dataReceived()`.
  *
- * @note This function is optimized for performance and minimal allocations.
- *       It assumes exclusive ownership of `m_rawInput` and reuses
+ * @note This function is the only consumer of the capture ring, and reuses
  *       `m_csvData` to avoid repeated memory churn.
  */
 void IO::Drivers::Audio::processInputBuffer()
 {
-  // Copy audio data
-  QByteArray raw;
-  {
-    QMutexLocker locker(&m_inputBufferLock);
-    if (m_rawInput.isEmpty())
-      return;
+  // Report blocks dropped by the audio callback
+  const auto overruns = m_inputOverruns.exchange(0);
+  if (overruns > 0)
+    qWarning() << "Audio input overrun, dropped" << overruns << "blocks";
 
-    raw = std::move(m_rawInput);
-    m_rawInput.clear();
-  }
+  // Stop if there is nothing to process
+  if (!m_inputRing || m_inputRing->size_approx() == 0)
+    return;
 
   // Device config
   const int channels = m_config.capture.channels;
   const ma_format format = m_config.capture.format;
   const int bytesPerSample = ma_get_bytes_per_sample(format);
   const int frameSize = bytesPerSample * channels;
-  if (frameSize <= 0 || channels <= 0 || raw.size() % frameSize != 0)
+  if (frameSize <= 0 || channels <= 0)
+  {
+    while (m_inputRing->try_pop())
+      continue;
+
     return;
+  }
 
-  // Calculate the number of audio frames
-  const int totalFrames = raw.size() / frameSize;
+  // Hand the samples over as numbers, bypassing the CSV text stream
+  if (m_numericOutput.load(std::memory_order_relaxed))
+  {
+    publishSamples(format, channels);
+    return;
+  }
 
   // Reset the CSV output buffer to start position
   m_csvBuffer.seek(0);
 
-  // Convert raw audio data to CSV-like format
-  const char *ptr = raw.constData();
-  for (int i = 0; i < totalFrames; ++i)
+  // Convert each queued block to CSV-like format
+  auto &block = m_inputBlock;
+  while (m_inputRing->try_dequeue(block))
   {
-    for (int ch = 0; ch < channels; ++ch)
+    const char *ptr = block.bytes.data();
+    const int totalFrames = static_cast<int>(block.size) / frameSize;
+    for (int i = 0; i < totalFrames; ++i)
     {
-      switch (format)
+      for (int ch = 0; ch < channels; ++ch)
       {
-        case ma_format_u8: {
-          const auto sample = static_cast<quint8>(*ptr);
-          m_csvStream << static_cast<int>(sample);
-          break;
-        }
-        case ma_format_s16: {
-          const qint16 sample = qFromLittleEndian<qint16>(
-              reinterpret_cast<const quint8 *>(ptr));
-          m_csvStream << sample;
-          break;
+        switch (format)
+        {
+          case ma_format_u8: {
+            const auto sample = static_cast<quint8>(*ptr);
+            m_csvStream << static_cast<int>(sample);
+            break;
+          }
+          case ma_format_s16: {
+            const qint16 sample = qFromLittleEndian<qint16>(
+                reinterpret_cast<const quint8 *>(ptr));
+            m_csvStream << sample;
+            break;
+          }
+          case ma_format_s24: {
+            const quint8 *b = reinterpret_cast<const quint8 *>(ptr);
+            qint32 sample = static_cast<qint32>(b[0])
+                            | (static_cast<qint32>(b[1]) << 8)
+                            | (static_cast<qint32>(b[2]) << 16);
+
+            if (sample & 0x800000)
+              sample |= 0xFF000000;
+
+            m_csvStream << sample;
+            break;
+          }
+          case ma_format_s32: {
+            const qint32 sample = qFromLittleEndian<qint32>(
+                reinterpret_cast<const quint8 *>(ptr));
+            m_csvStream << sample;
+            break;
+          }
+          case ma_format_f32: {
+            float sample;
+            std::memcpy(&sample, ptr, sizeof(float));
+            m_csvStream << sample;
+            break;
+          }
+          default:
+            break;
         }
-        case ma_format_s24: {
-          const quint8 *b = reinterpret_cast<const quint8 *>(ptr);
-          qint32 sample = static_cast<qint32>(b[0])
-                          | (static_cast<qint32>(b[1]) << 8)
-                          | (static_cast<qint32>(b[2]) << 16);
 
-          if (sample & 0x800000)
-            sample |= 0xFF000000;
-
-          m_csvStream << sample;
-          break;
-        }
-        case ma_format_s32: {
-          const qint32 sample = qFromLittleEndian<qint32>(
-              reinterpret_cast<const quint8 *>(ptr));
-          m_csvStream << sample;
-          break;
-        }
-        case ma_format_f32: {
-          float sample;
-          std::memcpy(&sample, ptr, sizeof(float));
-          m_csvStream << sample;
-          break;
-        }
-        default:
-          return;
+        ptr += bytesPerSample;
+        if (ch < channels - 1)
+          m_csvStream << ',';
       }
 
-      ptr += bytesPerSample;
-      if (ch < channels - 1)
-        m_csvStream << ',';
+      m_csvStream << '\n';
     }
-
-    m_csvStream << '\n';
   }
 
   // Force any data in the stream to be written in the CSV buffer
@@ -1423,6 +1594,55 @@ void IO::Drivers::Audio::processInputBuffer()
   Q_EMIT dataReceived(m_csvData.left(length));
 }
 
+/**
+ * @brief Converts every queued capture block into a single block of numeric
+ *        samples and hands it over to the consumer.
+ *
+ * The output block is taken from the recycled pool when possible, so its
+ * memory is reused once capture reaches a steady state. If the consumer
+ * falls behind and the queue is full, the block is discarded.
+ *
+ * The samplesReady() signal is coalesced: it is only emitted if the consumer
+ * has already picked up the previous notification.
+ *
+ * @param format   Sample format of the capture device.
+ * @param channels Number of capture channels.
+ */
+void IO::Drivers::Audio::publishSamples(const ma_format format,
+                                        const int channels)
+{
+  // Obtain a block to write into
+  AudioSamples samples;
+  (void)m_recycledSamples.try_dequeue(samples);
+  samples.channels = channels;
+  samples.values.clear();
+
+  // Convert the queued blocks, which always contain whole frames
+  auto &block = m_inputBlock;
+  const int bytesPerSample = ma_get_bytes_per_sample(format);
+  while (m_inputRing->try_dequeue(block))
+  {
+    const qsizetype count = block.size / bytesPerSample;
+    const auto pos = samples.values.size();
+    samples.values.resize(pos + count);
+    decodeSamples(block.bytes.data(), samples.values.data() + pos, count,
+                  format);
+  }
+
+  // Nothing to hand over
+  if (samples.values.empty())
+    return;
+
+  // Queue is full, drop the block
+  const auto rows = samples.rows();
+  if (!m_sampleQueue.try_enqueue(std::move(samples)))
+    qWarning() << "Audio sample queue full, dropped" << rows << "frames";
+
+  // Wake up the consumer if it is not already scheduled to run
+  if (!m_samplesNotifyPending.exchange(true, std::memory_order_acq_rel))
+    Q_EMIT samplesReady();
+}
+
 //------------------------------------------------------------------------------
 // Device discovery functions
 //------------------------------------------------------------------------------
@@ -1597,9 +1817,14 @@ void IO::Drivers::Audio::syncOutputParameters()
 /**
  * @brief Audio callback handler for processing input and output streams.
  *
- * This method is invoked from the MiniAudio real-time thread. It processes
- * audio input by pushing raw bytes into a buffer and handles audio output
- * by streaming queued frames or zero-filling if empty.
+ * This method is invoked from the MiniAudio real-time thread, so it never
+ * locks or allocates memory:
+ * - Captured audio is copied into preallocated blocks of whole frames and
+ *   pushed to the single-producer/single-consumer capture ring. If the
+ *   input worker falls behind, blocks are dropped and counted instead of
+ *   blocking the audio thread.
+ * - Playback frames are popped from the playback ring; missing frames are
+ *   zero-filled.
  *
  * @param output Pointer to the output buffer (nullable).
  * @param input Pointer to the input buffer (nullable).
@@ -1612,49 +1837,54 @@ void IO::Drivers::Audio::handleCallback(void *output, const void *input,
   const ma_format format = m_config.capture.format;
   const ma_uint32 channels = m_config.capture.channels;
 
-  // Get number of bytes per sample & number of bytes per frame
-  const ma_uint32 bytesPerSample = ma_get_bytes_per_sample(format);
-  const ma_uint32 bytesPerFrame = bytesPerSample * channels;
+  // Get number of bytes per frame
+  const ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(format, channels);
 
-  // Push raw input data to buffer, no formatting here
-  if (input && channels > 0 && format != ma_format_unknown)
+  // Push raw input data to the capture ring, no formatting here
+  if (input && bytesPerFrame > 0 && m_inputRing)
   {
-    QMutexLocker locker(&m_inputBufferLock);
-    const char *inputPtr = reinterpret_cast<const char *>(input);
-    m_rawInput.append(inputPtr, frameCount * bytesPerFrame);
+    // Only store whole frames in each block
+    InputBlock block;
+    const auto *src = static_cast<const char *>(input);
+    const auto capacity = block.bytes.size() / bytesPerFrame * bytesPerFrame;
+    auto remaining = static_cast<std::size_t>(frameCount) * bytesPerFrame;
+
+    // Split the callback buffer in blocks, drop them if the ring is full
+    while (remaining > 0 && capacity > 0)
+    {
+      const auto length = qMin(remaining, capacity);
+      std::memcpy(block.bytes.data(), src, length);
+      block.size = static_cast<quint32>(length);
+      if (!m_inputRing->try_enqueue(block))
+        m_inputOverruns.fetch_add(1, std::memory_order_relaxed);
+
+      src += length;
+      remaining -= length;
+    }
   }
 
   // Output → fast write, fallback to zero-fill
-  if (output && m_config.playback.channels > 0
+  if (output && m_outputRing && m_config.playback.channels > 0
       && m_config.playback.format != ma_format_unknown)
   {
-    QMutexLocker locker(&m_outputBufferLock);
-
     // Get number of bytes per frame for output
-    // clang-format off
-    char *out = reinterpret_cast<char *>(output);
-    const ma_uint32 outBytesPerFrame = ma_get_bytes_per_sample(m_config.playback.format) * m_config.playback.channels;
-    // clang-format on
+    char *out = static_cast<char *>(output);
+    const ma_uint32 outBytesPerFrame = ma_get_bytes_per_frame(
+        m_config.playback.format, m_config.playback.channels);
 
     // Write output frames
+    OutputFrame frame;
     for (ma_uint32 i = 0; i < frameCount; ++i)
     {
-      if (!m_outputQueue.isEmpty())
+      ma_uint32 bytes = 0;
+      if (m_outputRing->try_dequeue(frame))
       {
-        // clang-format off
-        const QVector<quint8> &frame = m_outputQueue.front();
-        const int bytesToCopy = qMin(outBytesPerFrame, static_cast<ma_uint32>(frame.size()));
-        std::memcpy(out, frame.constData(), bytesToCopy);
-        out += outBytesPerFrame;
-        m_outputQueue.pop_front();
-        // clang-format on
+        bytes = qMin(outBytesPerFrame, frame.size);
+        std::memcpy(out, frame.bytes.data(), bytes);
       }
 
-      else
-      {
-        std::memset(out, 0, outBytesPerFrame);
-        out += outBytesPerFrame;
-      }
+      std::memset(out + bytes, 0, outBytesPerFrame - bytes);
+      out += outBytesPerFrame;
     }
   }
 }
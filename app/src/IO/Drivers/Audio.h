@@ -26,8 +26,12 @@
 // Class declaration & Qt Libs
 //------------------------------------------------------------------------------
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include <QMap>
-#include <QMutex>
 #include <QTimer>
 #include <QThread>
 #include <QVector>
@@ -38,11 +42,32 @@
 
 #include "IO/HAL_Driver.h"
 #include "ThirdParty/miniaudio.h"
+#include "ThirdParty/readerwriterqueue.h"
+#include "ThirdParty/readerwritercircularbuffer.h"
 
 namespace IO
 {
 namespace Drivers
 {
+/**
+ * @struct IO::Drivers::AudioSamples
+ * @brief Block of captured audio, converted to numbers.
+ *
+ * Samples are interleaved (one row per audio frame) and keep the range of
+ * the capture format, e.g. -32768 to 32767 for 16-bit audio. Blocks are
+ * recycled by the driver, so steady-state capture does not allocate memory.
+ */
+struct AudioSamples
+{
+  int channels = 0;
+  std::vector<double> values;
+
+  [[nodiscard]] inline qsizetype rows() const
+  {
+    return channels > 0 ? static_cast<qsizetype>(values.size()) / channels : 0;
+  }
+};
+
 class Audio : public HAL_Driver
 {
   // clang-format off
@@ -99,6 +124,7 @@ class Audio : public HAL_Driver
   // clang-format on
 
 signals:
+  void samplesReady();
   void inputSettingsChanged();
   void outputSettingsChanged();
 
@@ -155,7 +181,12 @@ public:
   [[nodiscard]] QStringList outputSampleFormats() const;
   [[nodiscard]] QStringList outputChannelConfigurations() const;
 
+  [[nodiscard]] bool numericOutput() const;
+  [[nodiscard]] bool takeSamples(AudioSamples &samples);
+  void recycleSamples(AudioSamples &&samples);
+
 public slots:
+  void setNumericOutput(const bool enabled);
   void setSelectedSampleRate(int index);
 
   void setSelectedInputDevice(int index);
@@ -190,10 +221,33 @@ private:
            && m_selectedOutputDevice < m_outputCapabilities.size();
   }
 
+  void publishSamples(const ma_format format, const int channels);
   void handleCallback(void *output, const void *input, ma_uint32 frameCount);
   static void callback(ma_device *device, void *output, const void *input,
                        ma_uint32 frameCount);
 
+private:
+  /**
+   * @brief Block of captured audio, always made of whole frames.
+   */
+  struct InputBlock
+  {
+    quint32 size = 0;
+    std::array<char, 16 * 1024> bytes;
+  };
+
+  /**
+   * @brief Single playback frame, already encoded in the output format.
+   */
+  struct OutputFrame
+  {
+    quint32 size = 0;
+    std::array<quint8, 64 * sizeof(float)> bytes;
+  };
+
+  template<typename T>
+  using Ring = moodycamel::BlockingReaderWriterCircularBuffer<T>;
+
 private:
   bool m_init;
   bool m_isOpen;
@@ -217,15 +271,20 @@ private:
   QVector<ma_device_info> m_inputDevices;
   QVector<ma_device_info> m_outputDevices;
 
-  QMutex m_inputBufferLock;
-  QByteArray m_rawInput;
+  InputBlock m_inputBlock;
+  std::unique_ptr<Ring<InputBlock>> m_inputRing;
+  std::atomic<quint32> m_inputOverruns;
+
+  std::atomic<bool> m_numericOutput;
+  std::atomic<bool> m_samplesNotifyPending;
+  moodycamel::ReaderWriterQueue<AudioSamples> m_sampleQueue{64};
+  moodycamel::ReaderWriterQueue<AudioSamples> m_recycledSamples{64};
 
   mutable QBuffer m_csvBuffer;
   mutable QByteArray m_csvData;
   mutable QTextStream m_csvStream;
 
-  QMutex m_outputBufferLock;
-  QVector<QVector<quint8>> m_outputQueue;
+  std::unique_ptr<Ring<OutputFrame>> m_outputRing;
 
   QTimer *m_inputWorkerTimer;
   QThread m_inputWorkerThread;
@@ -42,19 +42,39 @@
 IO::FrameReader::FrameReader(QObject *parent)
   : QObject(parent)
   , m_checksumLength(0)
+  , m_resyncBytes(0)
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
+  , m_fixedFrameLength(0)
+  , m_lengthFieldSize(1)
+  , m_lengthFieldOffset(0)
+  , m_lengthFieldBigEndian(true)
+  , m_lengthIncludesHeader(false)
+  , m_startCursor(0)
+  , m_finishCursor(0)
+  , m_nextStartCursor(0)
   , m_circularBuffer(1024 * 1024 * 10)
+  , m_notifyPending(false)
+  , m_droppedFrames(0)
 {
   m_quickPlotEndSequences.append(QByteArray("\n"));
   m_quickPlotEndSequences.append(QByteArray("\r"));
   m_quickPlotEndSequences.append(QByteArray("\r\n"));
+  m_quickPlotCursors.fill(0, m_quickPlotEndSequences.count());
+  for (const auto &sequence : std::as_const(m_quickPlotEndSequences))
+    m_quickPlotMatchers.append(PatternMatcher(sequence));
 
   setChecksum(IO::Manager::instance().checksumAlgorithm());
   setStartSequence(IO::Manager::instance().startSequence());
   setFinishSequence(IO::Manager::instance().finishSequence());
   setOperationMode(JSON::FrameBuilder::instance().operationMode());
   setFrameDetectionMode(JSON::ProjectModel::instance().frameDetection());
+
+  const auto &project = JSON::ProjectModel::instance();
+  setFixedFrameLength(project.fixedFrameLength());
+  setLengthField(project.lengthFieldSize(), project.lengthFieldOffset(),
+                 project.lengthFieldBigEndian(),
+                 project.lengthIncludesHeader());
 }
 
 //------------------------------------------------------------------------------
@@ -71,24 +91,37 @@ IO::FrameReader::FrameReader(QObject *parent)
  * - In all other modes, a circular buffer is used to extract complete frames
  *   according to the configured delimiters.
  *
- * Parsed frames are enqueued for later processing. No signals are emitted
- * per frame to avoid UI flooding. Instead, a single `readyRead()` signal
- * notifies the consumer that new frames are available for reading.
+ * Parsed frames are collected into a single batch that is enqueued once all
+ * the data has been processed. No signals are emitted per frame to avoid UI
+ * flooding. Instead, a coalesced `readyRead()` signal notifies the consumer
+ * that new frames are available for reading (see publishBatch()).
+ *
+ * Delimiter searches resume from where the previous call stopped, so a large
+ * frame that arrives in many small chunks is only scanned once. If the
+ * circular buffer had to overwrite unread bytes to fit the new data, the
+ * logical indexes shift and the scan state is discarded.
  *
  * @param data Incoming byte stream from the device.
  */
 void IO::FrameReader::processData(const QByteArray &data)
 {
+  // Reuse a batch already drained by the consumer to avoid allocations
+  if (m_batch.isEmpty())
+    (void)m_recycled.try_dequeue(m_batch);
+
   // Parse frames immediately
   if (m_operationMode == SerialStudio::ProjectFile
       && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    m_queue.try_enqueue(data);
+    m_batch.append(data.constData(), data.size());
 
   // Parse frames using a circular buffer
   else
   {
-    // Append to circular buffer
+    // Append to circular buffer, invalidate scan state if data was dropped
+    const auto expectedSize = m_circularBuffer.size() + data.size();
     m_circularBuffer.append(data);
+    if (m_circularBuffer.size() != expectedSize) [[unlikely]]
+      resetScanState();
 
     // Extract frames based on current mode
     switch (m_operationMode)
@@ -111,6 +144,12 @@ void IO::FrameReader::processData(const QByteArray &data)
           case SerialStudio::StartAndEndDelimiter:
             readStartEndDelimitedFrames();
             break;
+          case SerialStudio::StartAndLengthField:
+            readLengthPrefixedFrames();
+            break;
+          case SerialStudio::FixedLength:
+            readFixedLengthFrames();
+            break;
           default:
             break;
         }
@@ -120,8 +159,84 @@ void IO::FrameReader::processData(const QByteArray &data)
     }
   }
 
-  // Update user interface
-  Q_EMIT readyRead();
+  // Hand over extracted frames to the consumer
+  publishBatch();
+}
+
+//------------------------------------------------------------------------------
+// Frame hand-off functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of frames discarded because the consumer could
+ *        not keep up with the incoming data.
+ *
+ * This function is thread-safe.
+ */
+quint64 IO::FrameReader::droppedFrames() const
+{
+  return m_droppedFrames.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Retrieves the next batch of frames, if any.
+ *
+ * Must only be called from the consumer thread. Calling this function also
+ * re-arms the readyRead() notification, so a consumer should keep calling it
+ * until it returns @c false.
+ *
+ * @param batch Receives the batch; pass it back through recycleBatch() once
+ *              its frames have been processed.
+ * @return @c true if a batch was retrieved.
+ */
+bool IO::FrameReader::takeBatch(FrameBatch &batch)
+{
+  m_notifyPending.store(false, std::memory_order_release);
+  return m_queue.try_dequeue(batch);
+}
+
+/**
+ * @brief Returns a processed batch to the reader so that its buffers can be
+ *        reused for upcoming frames.
+ *
+ * Must only be called from the consumer thread.
+ *
+ * @param batch The batch previously obtained through takeBatch().
+ */
+void IO::FrameReader::recycleBatch(FrameBatch &&batch)
+{
+  batch.clear();
+  (void)m_recycled.try_enqueue(std::move(batch));
+}
+
+/**
+ * @brief Enqueues the frames extracted so far and notifies the consumer.
+ *
+ * All frames found during a processData() call are handed over as a single
+ * batch. If the queue is full, the batch is discarded and accounted for in
+ * droppedFrames() instead of growing memory usage without limit.
+ *
+ * The readyRead() signal is coalesced: it is only emitted if the consumer has
+ * already picked up the previous notification, so a slow consumer receives a
+ * single wakeup for any number of pending batches.
+ */
+void IO::FrameReader::publishBatch()
+{
+  // Nothing to hand over
+  if (m_batch.isEmpty())
+    return;
+
+  // Queue is full, account for the dropped frames and reuse the batch
+  const auto frames = m_batch.count();
+  if (!m_queue.try_enqueue(std::move(m_batch)))
+  {
+    m_droppedFrames.fetch_add(frames, std::memory_order_relaxed);
+    m_batch.clear();
+  }
+
+  // Wake up the consumer if it is not already scheduled to run
+  if (!m_notifyPending.exchange(true, std::memory_order_acq_rel))
+    Q_EMIT readyRead();
 }
 
 //------------------------------------------------------------------------------
@@ -131,46 +246,47 @@ void IO::FrameReader::processData(const QByteArray &data)
 /**
  * @brief Sets the checksum algorithm used for validating incoming frames.
  *
- * If the algorithm changes, the internal buffer is cleared to prevent
- * inconsistencies during frame parsing.
+ * The algorithm is resolved into a checksum engine once, so that validating a
+ * frame does not require any string lookups or allocations.
  *
  * @param checksum The name of the new checksum algorithm.
  */
 void IO::FrameReader::setChecksum(const QString &checksum)
 {
   m_checksum = checksum;
-  const auto &map = IO::checksumFunctionMap();
-  const auto it = map.find(m_checksum);
-  if (it != map.end())
-    m_checksumLength = it.value()("", 0).size();
-  else
-    m_checksumLength = 0;
+  m_checksumEngine = ChecksumEngine(m_checksum);
+  m_checksumLength = m_checksumEngine.length();
 }
 
 /**
  * @brief Sets the start sequence used for frame detection.
  *
- * Updates the sequence that marks the beginning of a frame. Resets the
- * FrameReader state if the start sequence changes.
+ * Updates the sequence that marks the beginning of a frame and precompiles
+ * its search table. Resets the FrameReader state if the start sequence
+ * changes.
  *
  * @param start The new start sequence as a QByteArray.
  */
 void IO::FrameReader::setStartSequence(const QByteArray &start)
 {
   m_startSequence = start;
+  m_startMatcher = PatternMatcher(m_startSequence);
+  resetScanState();
 }
 
 /**
  * @brief Sets the finish sequence used for frame detection.
  *
- * Updates the sequence that marks the end of a frame. Resets the FrameReader
- * state if the finish sequence changes.
+ * Updates the sequence that marks the end of a frame and precompiles its
+ * search table. Resets the FrameReader state if the finish sequence changes.
  *
  * @param finish The new finish sequence as a QByteArray.
  */
 void IO::FrameReader::setFinishSequence(const QByteArray &finish)
 {
   m_finishSequence = finish;
+  m_finishMatcher = PatternMatcher(m_finishSequence);
+  resetScanState();
 }
 
 /**
@@ -188,7 +304,10 @@ void IO::FrameReader::setOperationMode(const SerialStudio::OperationMode mode)
   {
     m_checksumLength = 0;
     m_checksum = QLatin1String("");
+    m_checksumEngine = ChecksumEngine();
   }
+
+  resetScanState();
 }
 
 /**
@@ -205,6 +324,51 @@ void IO::FrameReader::setFrameDetectionMode(
     const SerialStudio::FrameDetection mode)
 {
   m_frameDetectionMode = mode;
+  m_resyncBytes = 0;
+  resetScanState();
+}
+
+/**
+ * @brief Sets the size of each frame when using fixed-length frame detection.
+ *
+ * The length excludes the checksum bytes, which are expected immediately after
+ * each frame.
+ *
+ * @param length Number of payload bytes in every frame.
+ */
+void IO::FrameReader::setFixedFrameLength(const int length)
+{
+  m_fixedFrameLength = qMax(0, length);
+  m_resyncBytes = 0;
+  resetScanState();
+}
+
+/**
+ * @brief Configures the length field used by length-prefixed frames.
+ *
+ * A length-prefixed frame has the following layout:
+ *
+ * @code
+ * [start sequence][offset bytes][length field][payload][checksum]
+ * @endcode
+ *
+ * @param size Width of the length field in bytes (1, 2 or 4).
+ * @param offset Number of bytes between the start sequence and the length
+ *               field.
+ * @param bigEndian @c true if the length field is stored MSB-first.
+ * @param includesHeader @c true if the length value counts the start sequence,
+ *                       the offset bytes and the length field itself in
+ *                       addition to the payload.
+ */
+void IO::FrameReader::setLengthField(const int size, const int offset,
+                                     const bool bigEndian,
+                                     const bool includesHeader)
+{
+  m_lengthFieldSize = qBound(1, size, 4);
+  m_lengthFieldOffset = qMax(0, offset);
+  m_lengthFieldBigEndian = bigEndian;
+  m_lengthIncludesHeader = includesHeader;
+  resetScanState();
 }
 
 //------------------------------------------------------------------------------
@@ -235,9 +399,11 @@ void IO::FrameReader::readEndDelimitedFrames()
     // Look for the earliest finish sequence (QuickPlot mode)
     if (m_operationMode == SerialStudio::QuickPlot)
     {
-      for (const QByteArray &d : std::as_const(m_quickPlotEndSequences))
+      for (int i = 0; i < m_quickPlotEndSequences.count(); ++i)
       {
-        int index = m_circularBuffer.findPatternKMP(d);
+        const auto &d = m_quickPlotEndSequences[i];
+        const auto &matcher = m_quickPlotMatchers[i];
+        int index = findDelimiter(matcher, m_quickPlotCursors[i]);
         if (index != -1 && (endIndex == -1 || index < endIndex))
         {
           endIndex = index;
@@ -251,15 +417,15 @@ void IO::FrameReader::readEndDelimitedFrames()
     else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
     {
       delimiter = m_finishSequence;
-      endIndex = m_circularBuffer.findPatternKMP(delimiter);
+      endIndex = findDelimiter(m_finishMatcher, m_finishCursor);
     }
 
     // No frame found
     if (endIndex == -1)
       break;
 
-    // Extract frame data
-    const auto frame = m_circularBuffer.peek(endIndex);
+    // Obtain a view of the frame data
+    const auto frame = m_circularBuffer.view(0, endIndex);
     const auto crcPosition = endIndex + delimiter.size();
     const auto frameEndPos = crcPosition + m_checksumLength;
 
@@ -270,8 +436,8 @@ void IO::FrameReader::readEndDelimitedFrames()
       auto result = checksum(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        m_batch.append(frame);
+        consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -280,12 +446,12 @@ void IO::FrameReader::readEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
   }
 }
 
@@ -304,13 +470,13 @@ void IO::FrameReader::readStartDelimitedFrames()
   while (true)
   {
     // Find the first start delimiter in the buffer
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence);
+    int startIndex = findDelimiter(m_startMatcher, m_startCursor);
     if (startIndex == -1)
       break;
 
     // Try to find the next start delimiter after this one
-    int nextStartIndex = m_circularBuffer.findPatternKMP(
-        m_startSequence, startIndex + m_startSequence.size());
+    int nextStartIndex = findDelimiter(m_startMatcher, m_nextStartCursor,
+                                       startIndex + m_startSequence.size());
 
     // Calculate start and end positions of the current frame
     qsizetype frameEndPos;
@@ -332,7 +498,7 @@ void IO::FrameReader::readStartDelimitedFrames()
     qsizetype frameLength = frameEndPos - frameStart;
     if (frameLength <= 0)
     {
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
       continue;
     }
 
@@ -340,13 +506,13 @@ void IO::FrameReader::readStartDelimitedFrames()
     const auto crcPosition = frameEndPos - m_checksumLength;
     if (crcPosition < frameStart)
     {
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
       continue;
     }
 
-    // Build the frame byte array
-    const auto frame = m_circularBuffer.peek(frameEndPos)
-                           .mid(frameStart, frameLength - m_checksumLength);
+    // Obtain a view of the frame data
+    const auto frame
+        = m_circularBuffer.view(frameStart, frameLength - m_checksumLength);
 
     // Validate the frame
     if (!frame.isEmpty())
@@ -355,8 +521,8 @@ void IO::FrameReader::readStartDelimitedFrames()
       const auto result = checksum(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        m_batch.append(frame);
+        consume(frameEndPos);
       }
 
       // Not enough bytes yet to compute checksum, wait for more
@@ -365,12 +531,12 @@ void IO::FrameReader::readStartDelimitedFrames()
 
       // Invalid checksum...discard and move on
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Empty frame or invalid data, discard...
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
   }
 }
 
@@ -390,15 +556,15 @@ void IO::FrameReader::readStartEndDelimitedFrames()
   while (true)
   {
     // Locate end delimiter
-    int finishIndex = m_circularBuffer.findPatternKMP(m_finishSequence);
+    int finishIndex = findDelimiter(m_finishMatcher, m_finishCursor);
     if (finishIndex == -1)
       break;
 
     // Locate start delimiter and ensure it's before the end
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence);
+    int startIndex = findDelimiter(m_startMatcher, m_startCursor);
     if (startIndex == -1 || startIndex >= finishIndex)
     {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
@@ -407,15 +573,14 @@ void IO::FrameReader::readStartEndDelimitedFrames()
     qsizetype frameLength = finishIndex - frameStart;
     if (frameLength <= 0)
     {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
-    // Extract frame data
+    // Obtain a view of the frame data
     const auto crcPosition = finishIndex + m_finishSequence.size();
     const auto frameEndPos = crcPosition + m_checksumLength;
-    const auto frame = m_circularBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    const auto frame = m_circularBuffer.view(frameStart, frameLength);
 
     // Read frame
     if (!frame.isEmpty())
@@ -424,8 +589,8 @@ void IO::FrameReader::readStartEndDelimitedFrames()
       auto result = checksum(frame, crcPosition);
       if (result == ValidationStatus::FrameOk)
       {
-        m_queue.try_enqueue(std::move(frame));
-        (void)m_circularBuffer.read(frameEndPos);
+        m_batch.append(frame);
+        consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -434,15 +599,202 @@ void IO::FrameReader::readStartEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
+  }
+}
+
+/**
+ * @brief Parses frames that begin with a start sequence and a length field.
+ *
+ * Only the start sequence needs to be searched for, the end of the frame is
+ * computed directly from the decoded length field. Bytes preceding the start
+ * sequence are discarded.
+ *
+ * If the length field holds an impossible value, or the checksum does not
+ * match, only the start sequence is discarded so that the reader can
+ * resynchronize with the next header in the stream.
+ */
+void IO::FrameReader::readLengthPrefixedFrames()
+{
+  // Obtain header size & maximum frame size that the buffer can hold
+  const auto resync = qMax<qsizetype>(1, m_startSequence.size());
+  const auto headerSize
+      = m_startSequence.size() + m_lengthFieldOffset + m_lengthFieldSize;
+  const auto maxFrameSize
+      = m_circularBuffer.size() + m_circularBuffer.freeSpace();
+
+  while (true)
+  {
+    // Locate the start sequence and drop any bytes before it
+    int startIndex = findDelimiter(m_startMatcher, m_startCursor);
+    if (startIndex == -1)
+      break;
+    else if (startIndex > 0)
+      consume(startIndex);
+
+    // Wait until the length field has been received
+    if (m_circularBuffer.size() < headerSize)
+      break;
+
+    // Decode the length field
+    quint64 length = 0;
+    const auto field = m_circularBuffer.view(
+        m_startSequence.size() + m_lengthFieldOffset, m_lengthFieldSize);
+    for (qsizetype i = 0; i < m_lengthFieldSize; ++i)
+    {
+      const auto j = m_lengthFieldBigEndian ? i : m_lengthFieldSize - 1 - i;
+      length = (length << 8) | static_cast<quint8>(field[j]);
+    }
+
+    // Obtain payload length
+    auto payloadLength = static_cast<qsizetype>(length);
+    if (m_lengthIncludesHeader)
+      payloadLength -= headerSize;
+
+    // Reject lengths that cannot possibly be satisfied
+    const auto crcPosition = headerSize + payloadLength;
+    const auto frameEndPos = crcPosition + m_checksumLength;
+    if (payloadLength <= 0 || frameEndPos > maxFrameSize)
+    {
+      consume(resync);
+      continue;
+    }
+
+    // Wait for the rest of the frame
+    if (m_circularBuffer.size() < frameEndPos)
+      break;
+
+    // Validate checksum and register the frame
+    const auto frame = m_circularBuffer.view(headerSize, payloadLength);
+    if (checksum(frame, crcPosition) == ValidationStatus::FrameOk)
+    {
+      m_batch.append(frame);
+      consume(frameEndPos);
+    }
+
+    // Corrupted frame, look for the next header
+    else
+      consume(resync);
   }
 }
 
+/**
+ * @brief Splits the stream into frames of a fixed number of bytes.
+ *
+ * Each frame is followed by its checksum (if any). When a checksum does not
+ * match, a single byte is discarded so that the reader slides along the stream
+ * until it locks onto the frame boundaries again. Only the first mismatch is
+ * logged, together with the number of skipped bytes once sync is regained.
+ */
+void IO::FrameReader::readFixedLengthFrames()
+{
+  // Nothing to do if no frame size is set
+  if (m_fixedFrameLength <= 0)
+    return;
+
+  // Split data into frames
+  const auto frameEndPos = m_fixedFrameLength + m_checksumLength;
+  while (m_circularBuffer.size() >= frameEndPos)
+  {
+    const auto frame = m_circularBuffer.view(0, m_fixedFrameLength);
+    if (checksum(frame, m_fixedFrameLength) == ValidationStatus::FrameOk)
+    {
+      if (m_resyncBytes > 0)
+      {
+        qWarning() << "Frame sync regained after skipping" << m_resyncBytes
+                   << "bytes";
+        m_resyncBytes = 0;
+      }
+
+      m_batch.append(frame);
+      consume(frameEndPos);
+    }
+
+    else
+    {
+      consume(1);
+      ++m_resyncBytes;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Incremental delimiter scanning
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Discards all delimiter scan cursors.
+ *
+ * Called whenever the logical indexes of the circular buffer can no longer be
+ * trusted (e.g. the buffer overwrote unread data) or when the delimiters or
+ * frame detection settings change.
+ */
+void IO::FrameReader::resetScanState()
+{
+  m_startCursor = 0;
+  m_finishCursor = 0;
+  m_nextStartCursor = 0;
+  m_quickPlotCursors.fill(0, m_quickPlotEndSequences.count());
+}
+
+/**
+ * @brief Removes @p bytes from the front of the circular buffer.
+ *
+ * Scan cursors are shifted back by the same amount so that regions that were
+ * already searched are not searched again. The secondary start cursor is only
+ * valid relative to the current frame, so it is simply discarded.
+ *
+ * @param bytes Number of bytes to remove from the buffer.
+ */
+void IO::FrameReader::consume(const qsizetype bytes)
+{
+  m_circularBuffer.discard(bytes);
+
+  m_nextStartCursor = 0;
+  m_startCursor = qMax<qsizetype>(0, m_startCursor - bytes);
+  m_finishCursor = qMax<qsizetype>(0, m_finishCursor - bytes);
+  for (auto &cursor : m_quickPlotCursors)
+    cursor = qMax<qsizetype>(0, cursor - bytes);
+}
+
+/**
+ * @brief Searches for a delimiter, resuming from the last scanned position.
+ *
+ * @p cursor stores how far into the buffer a previous search progressed
+ * without finding a match. The new search starts at that point, backed off by
+ * `delimiter.size() - 1` bytes so that delimiters split across two chunks are
+ * still detected.
+ *
+ * - If the delimiter is found, the cursor is placed at the match, so that
+ *   retrying an incomplete frame does not rescan the preceding bytes.
+ * - If no match is found, the cursor is moved to the end of the buffer.
+ *
+ * @param delimiter The precompiled byte sequence to look for.
+ * @param cursor Per-delimiter scan position, updated by this function.
+ * @param from Minimum logical index at which a match may start.
+ *
+ * @return The logical index of the delimiter, or -1 if not found.
+ */
+int IO::FrameReader::findDelimiter(const PatternMatcher &delimiter,
+                                   qsizetype &cursor, const qsizetype from)
+{
+  const auto overlap = qMax<qsizetype>(0, delimiter.size() - 1);
+  const auto pos = qMax(from, cursor - overlap);
+
+  const int index = m_circularBuffer.findPattern(delimiter, pos);
+  if (index == -1)
+    cursor = m_circularBuffer.size();
+  else
+    cursor = index;
+
+  return index;
+}
+
 //------------------------------------------------------------------------------
 // Checksum validation function
 //------------------------------------------------------------------------------
@@ -454,14 +806,19 @@ void IO::FrameReader::readStartEndDelimitedFrames()
  * algorithm and compares it against the raw bytes found at the specified
  * `crcPosition` in the input buffer.
  *
- * @param frame The extracted frame payload (excluding checksum bytes).
+ * The checksum engine is fed directly with the (up to two) contiguous segments
+ * of the payload, and the received checksum is compared in place, so no data
+ * is copied unless the checksum fails. Mismatches are not logged while the
+ * reader is resynchronizing, see readFixedLengthFrames().
+ *
+ * @param frame View of the frame payload (excluding checksum bytes).
  * @param crcPosition The byte offset in the buffer where the checksum begins.
  *
  * @return ValidationStatus::FrameOk if the checksum is correct,
  *         ValidationStatus::ChecksumIncomplete if there isn’t enough data to
  *         validate, or ValidationStatus::ChecksumError on mismatch.
  */
-IO::ValidationStatus IO::FrameReader::checksum(const QByteArray &frame,
+IO::ValidationStatus IO::FrameReader::checksum(const FrameView &frame,
                                                qsizetype crcPosition)
 {
   // Early stop if checksum is null
@@ -469,23 +826,31 @@ IO::ValidationStatus IO::FrameReader::checksum(const QByteArray &frame,
     return ValidationStatus::FrameOk;
 
   // Validate that we can read the checksum
-  const auto buffer = m_circularBuffer.peek(m_circularBuffer.size());
-  if (buffer.size() < crcPosition + m_checksumLength)
+  if (m_circularBuffer.size() < crcPosition + m_checksumLength)
     return ValidationStatus::ChecksumIncomplete;
 
+  // Calculate checksum of the payload
+  char calculated[ChecksumEngine::MaxLength];
+  m_checksumEngine.reset();
+  m_checksumEngine.update(frame.first(), frame.firstSize());
+  m_checksumEngine.update(frame.second(), frame.secondSize());
+  const auto length = m_checksumEngine.finalize(calculated);
+
   // Compare actual vs received checksum
-  const auto calculated = IO::checksum(m_checksum, frame);
-  const QByteArray received = buffer.mid(crcPosition, m_checksumLength);
-  if (calculated == received)
+  const auto received = m_circularBuffer.view(crcPosition, m_checksumLength);
+  if (received.equals(calculated, length))
     return ValidationStatus::FrameOk;
 
-  // Log checksum mismatch
+  // Log checksum mismatch, unless the reader is sliding along the stream
+  if (m_resyncBytes > 0)
+    return ValidationStatus::ChecksumError;
+
   qWarning() << "\n"
              << m_checksum.toStdString().c_str() << "failed:\n"
-             << "\t- Received:" << received.toHex(' ') << "\n"
-             << "\t- Calculated:" << calculated.toHex(' ') << "\n"
-             << "\t- Frame:" << frame.toHex(' ') << "\n"
-             << "\t- Buffer:" << buffer.toHex(' ');
+             << "\t- Received:" << received.copy().toHex(' ') << "\n"
+             << "\t- Calculated:"
+             << QByteArray(calculated, length).toHex(' ') << "\n"
+             << "\t- Frame:" << frame.copy().toHex(' ');
 
   // Return error
   return ValidationStatus::ChecksumError;
@@ -21,15 +21,21 @@
 
 #pragma once
 
+#include <atomic>
+#include <vector>
+
 #include <QObject>
 #include <QByteArray>
 
 #include "SerialStudio.h"
 #include "ThirdParty/readerwriterqueue.h"
+#include "IO/Checksum.h"
 #include "IO/CircularBuffer.h"
 
 namespace IO
 {
+typedef CircularBuffer<QByteArray, char>::View FrameView;
+
 enum class ValidationStatus
 {
   FrameOk,
@@ -37,6 +43,55 @@ enum class ValidationStatus
   ChecksumIncomplete
 };
 
+/**
+ * @struct IO::FrameBatch
+ * @brief A group of frames stored back-to-back in a single buffer.
+ *
+ * Frames extracted during one FrameReader::processData() call are appended to
+ * a shared arena, and only the end offset of each frame is recorded. This
+ * allows handing over any number of frames with a single queue operation,
+ * and the buffers are recycled so that steady-state operation does not
+ * allocate memory.
+ */
+struct FrameBatch
+{
+  QByteArray data;
+  std::vector<qsizetype> ends;
+
+  [[nodiscard]] inline bool isEmpty() const { return ends.empty(); }
+  [[nodiscard]] inline qsizetype count() const { return ends.size(); }
+
+  [[nodiscard]] inline const char *frameData(const qsizetype i) const
+  {
+    return data.constData() + (i > 0 ? ends[i - 1] : 0);
+  }
+
+  [[nodiscard]] inline qsizetype frameSize(const qsizetype i) const
+  {
+    return ends[i] - (i > 0 ? ends[i - 1] : 0);
+  }
+
+  inline void clear()
+  {
+    data.resize(0);
+    ends.clear();
+  }
+
+  inline void append(const char *frame, const qsizetype size)
+  {
+    data.append(frame, size);
+    ends.push_back(data.size());
+  }
+
+  inline void append(const FrameView &frame)
+  {
+    const auto pos = data.size();
+    data.resize(pos + frame.size());
+    frame.copyTo(data.data() + pos);
+    ends.push_back(data.size());
+  }
+};
+
 /**
  * @class IO::FrameReader
  * @brief Multithreaded frame reader for detecting and processing streamed data.
@@ -56,7 +111,9 @@ signals:
 public:
   explicit FrameReader(QObject *parent = nullptr);
 
-  inline moodycamel::ReaderWriterQueue<QByteArray> &queue() { return m_queue; }
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] bool takeBatch(FrameBatch &batch);
+  void recycleBatch(FrameBatch &&batch);
 
 public slots:
   void processData(const QByteArray &data);
@@ -66,25 +123,59 @@ public slots:
   void setFinishSequence(const QByteArray &finish);
   void setOperationMode(const SerialStudio::OperationMode mode);
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
+  void setFixedFrameLength(const int length);
+  void setLengthField(const int size, const int offset, const bool bigEndian,
+                      const bool includesHeader);
 
 private:
+  void readFixedLengthFrames();
   void readEndDelimitedFrames();
   void readStartDelimitedFrames();
   void readStartEndDelimitedFrames();
+  void readLengthPrefixedFrames();
+
+  void resetScanState();
+  void consume(const qsizetype bytes);
+  int findDelimiter(const PatternMatcher &delimiter, qsizetype &cursor,
+                    const qsizetype from = 0);
 
-  ValidationStatus checksum(const QByteArray &frame, qsizetype crcPosition);
+  ValidationStatus checksum(const FrameView &frame, qsizetype crcPosition);
+
+  void publishBatch();
 
 private:
   qsizetype m_checksumLength;
+  qsizetype m_resyncBytes;
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
 
+  qsizetype m_fixedFrameLength;
+  qsizetype m_lengthFieldSize;
+  qsizetype m_lengthFieldOffset;
+  bool m_lengthFieldBigEndian;
+  bool m_lengthIncludesHeader;
+
   QString m_checksum;
+  ChecksumEngine m_checksumEngine;
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
   QVector<QByteArray> m_quickPlotEndSequences;
 
+  PatternMatcher m_startMatcher;
+  PatternMatcher m_finishMatcher;
+  QVector<PatternMatcher> m_quickPlotMatchers;
+
+  qsizetype m_startCursor;
+  qsizetype m_finishCursor;
+  qsizetype m_nextStartCursor;
+  QVector<qsizetype> m_quickPlotCursors;
+
   CircularBuffer<QByteArray, char> m_circularBuffer;
-  moodycamel::ReaderWriterQueue<QByteArray> m_queue{4096};
+
+  FrameBatch m_batch;
+  std::atomic<bool> m_notifyPending;
+  std::atomic<quint64> m_droppedFrames;
+  moodycamel::ReaderWriterQueue<FrameBatch> m_queue{256};
+  moodycamel::ReaderWriterQueue<FrameBatch> m_recycled{256};
 };
 } // namespace IO
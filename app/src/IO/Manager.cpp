@@ -29,6 +29,8 @@
 #include "Misc/Translator.h"
 #include "JSON/FrameBuilder.h"
 
+#include <cmath>
+
 #include <QApplication>
 
 #ifdef BUILD_COMMERCIAL
@@ -50,6 +52,9 @@
  * signals for data and configuration management.
  *
  * By default, the manager is configured for serial communication.
+ *
+ * The frame processing thread is started right away, since it also handles
+ * payloads that do not come from a device (e.g. CSV playback).
  */
 IO::Manager::Manager()
   : m_paused(false)
@@ -58,12 +63,18 @@ IO::Manager::Manager()
   , m_driver(nullptr)
   , m_workerThread(nullptr)
   , m_frameReader(nullptr)
+  , m_processingThread(nullptr)
+  , m_droppedFrames(0)
   , m_startSequence(QByteArray("/*"))
   , m_finishSequence(QByteArray("*/"))
 {
-  m_frame.reserve(4096);
   m_thrFrameExtr = m_settings.value("thrFrameExtr", false).toBool();
 
+  // Start the frame processing thread
+  m_processingContext.moveToThread(&m_processingThread);
+  m_processingThread.setObjectName(QStringLiteral("Frame Processing"));
+  m_processingThread.start();
+
   setBusType(SerialStudio::BusType::UART);
   connect(this, &IO::Manager::busTypeChanged, this,
           &IO::Manager::configurationChanged);
@@ -71,15 +82,20 @@ IO::Manager::Manager()
           &IO::Manager::connectedChanged);
   connect(qApp, &QApplication::aboutToQuit, this,
           &IO::Manager::killFrameReader);
+  connect(qApp, &QApplication::aboutToQuit, this,
+          &IO::Manager::stopProcessingThread);
 }
 
 /**
  * @brief Destructor for the IO::Manager.
  *
- * Shuts down any device connection before destruction.
+ * Stops the frame processing thread and shuts down any device connection
+ * before destruction.
  */
 IO::Manager::~Manager()
 {
+  stopProcessingThread();
+
   if (m_frameReader)
   {
     m_frameReader->disconnect();
@@ -199,6 +215,19 @@ bool IO::Manager::threadedFrameExtraction()
   return m_thrFrameExtr;
 }
 
+/**
+ * @brief Returns the number of frames discarded since the device connected.
+ *
+ * Frames are dropped when the frame reader produces data faster than it can
+ * be consumed by the dashboard and other hotpath consumers.
+ *
+ * @return The number of frames dropped by the frame reader.
+ */
+quint64 IO::Manager::droppedFrames() const
+{
+  return m_droppedFrames;
+}
+
 /**
  * @brief Retrieves the current hardware abstraction layer (HAL) driver.
  *
@@ -440,6 +469,23 @@ void IO::Manager::setupExternalConnections()
 {
   connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
           this, &IO::Manager::busListChanged);
+
+#ifdef BUILD_COMMERCIAL
+  // Process numeric audio samples in the frame processing thread
+  connect(&Drivers::Audio::instance(), &Drivers::Audio::samplesReady,
+          &m_processingContext, [this] { onSamplesReady(); });
+
+  // Skip the CSV text round trip for audio data in Quick Plot mode
+  auto syncAudioOutput = [] {
+    const auto mode = JSON::FrameBuilder::instance().operationMode();
+    const bool quickPlot = mode == SerialStudio::QuickPlot;
+    Drivers::Audio::instance().setNumericOutput(quickPlot);
+  };
+
+  syncAudioOutput();
+  connect(&JSON::FrameBuilder::instance(),
+          &JSON::FrameBuilder::operationModeChanged, this, syncAudioOutput);
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -454,6 +500,11 @@ void IO::Manager::setPaused(const bool paused)
 {
   m_paused = paused && isConnected();
   Q_EMIT pausedChanged();
+
+  // Process frames that were received while paused
+  if (!m_paused)
+    QMetaObject::invokeMethod(
+        &m_processingContext, [this] { onReadyRead(); }, Qt::QueuedConnection);
 }
 
 /**
@@ -476,6 +527,9 @@ void IO::Manager::setWriteEnabled(const bool enabled)
  * Invokes signals to notify about the received raw data and parsed frame in a
  * thread-safe manner.
  *
+ * The payload is handed to the frame builder through the processing thread,
+ * so that it is parsed in order with the frames extracted from a device.
+ *
  * @param payload The data payload to process.
  */
 void IO::Manager::processPayload(const QByteArray &payload)
@@ -488,7 +542,10 @@ void IO::Manager::processPayload(const QByteArray &payload)
 
     server.hotpathTxData(payload);
     console.hotpathRxData(payload);
-    frameBuilder.hotpathRxFrame(payload);
+    QMetaObject::invokeMethod(
+        &m_processingContext,
+        [payload] { frameBuilder.hotpathRxFrame(payload); },
+        Qt::QueuedConnection);
 
 #ifdef BUILD_COMMERCIAL
     static auto &mqtt = MQTT::Client::instance();
@@ -497,6 +554,21 @@ void IO::Manager::processPayload(const QByteArray &payload)
   }
 }
 
+/**
+ * @brief Runs @p task in the processing thread.
+ *
+ * The task runs after every payload queued by processPayload() before it,
+ * and before every payload queued after it. The CSV player uses it to deliver
+ * blocks of rows in order with the rows that it replays one by one.
+ *
+ * @param task The function to run.
+ */
+void IO::Manager::processTask(std::function<void()> task)
+{
+  QMetaObject::invokeMethod(&m_processingContext, std::move(task),
+                            Qt::QueuedConnection);
+}
+
 /**
  * @brief Sets the start sequence for frame detection.
  *
@@ -699,6 +771,8 @@ void IO::Manager::killFrameReader()
     QObject::disconnect(driver(), &IO::HAL_Driver::dataReceived, m_frameReader,
                         &IO::FrameReader::processData);
 
+    // Wait for the processing thread to stop using the frame reader
+    QMutexLocker locker(&m_readerLock);
     QMetaObject::invokeMethod(m_frameReader, &QObject::deleteLater,
                               Qt::QueuedConnection);
     m_frameReader.clear();
@@ -712,6 +786,21 @@ void IO::Manager::killFrameReader()
   }
 }
 
+/**
+ * @brief Stops the frame processing thread.
+ *
+ * Pending frames that have not been processed yet are discarded. This method
+ * is called automatically during shutdown.
+ */
+void IO::Manager::stopProcessingThread()
+{
+  if (m_processingThread.isRunning())
+  {
+    m_processingThread.quit();
+    m_processingThread.wait();
+  }
+}
+
 /**
  * @brief Starts the frame reader in a dedicated worker thread.
  *
@@ -723,7 +812,7 @@ void IO::Manager::killFrameReader()
  * starting a new one.
  *
  * @note The FrameReader is connected to the driver via queued signals to ensure
- * thread safety.
+ * thread safety. Its frames are consumed by the frame processing thread.
  */
 void IO::Manager::startFrameReader()
 {
@@ -733,14 +822,24 @@ void IO::Manager::startFrameReader()
   // Stop the frame reader thread if needed
   killFrameReader();
 
+  // Reset dropped frame counter
+  if (m_droppedFrames.exchange(0) != 0)
+    Q_EMIT droppedFramesChanged();
+
   // Create new thread and frame reader instance
-  m_frameReader = new FrameReader();
-  if (!m_frameReader)
+  auto *reader = new FrameReader();
+  if (!reader)
   {
     qCritical() << "Failed to allocate memory for frame reader";
     return;
   }
 
+  // Publish the frame reader to the processing thread
+  {
+    QMutexLocker locker(&m_readerLock);
+    m_frameReader = reader;
+  }
+
   // Move to the worker thread
   if (m_thrFrameExtr)
     m_frameReader->moveToThread(&m_workerThread);
@@ -749,9 +848,9 @@ void IO::Manager::startFrameReader()
   QObject::connect(driver(), &IO::HAL_Driver::dataReceived, m_frameReader,
                    &IO::FrameReader::processData);
 
-  // Connect frame reader events to IO::Manager
-  connect(m_frameReader, &IO::FrameReader::readyRead, this,
-          &IO::Manager::onReadyRead);
+  // Process extracted frames in the processing thread
+  connect(m_frameReader, &IO::FrameReader::readyRead, &m_processingContext,
+          [this] { onReadyRead(); });
 
   // Start the worker thread
   if (m_thrFrameExtr)
@@ -768,12 +867,19 @@ void IO::Manager::startFrameReader()
 /**
  * @brief Processes dequeued frames and routes them to consumers.
  *
- * Called when new frames are available in the frame reader's queue.
- * Pulls frames in a loop and dispatches them to the appropriate handlers:
+ * Called in the frame processing thread when new frames are available in the
+ * frame reader's queue. Pulls frame batches in a loop and dispatches each frame
+ * to the appropriate handlers:
  * - The JSON FrameBuilder for internal parsing.
  * - The MQTT client (if enabled) for external transmission.
  *
- * Frame dispatch occurs only when the system is not paused.
+ * Frames are passed as non-owning byte arrays that point into the batch
+ * buffer, which is handed back to the reader for reuse afterwards. Consumers
+ * that need to keep a frame must therefore copy it.
+ *
+ * Frame dispatch occurs only when the system is not paused. The frame reader
+ * lock is held while dispatching, so that killFrameReader() cannot delete the
+ * reader while its batches are in use.
  */
 void IO::Manager::onReadyRead()
 {
@@ -782,18 +888,130 @@ void IO::Manager::onReadyRead()
   static auto &mqtt = MQTT::Client::instance();
 #endif
 
+  QMutexLocker locker(&m_readerLock);
   auto reader = m_frameReader;
   if (!m_paused && reader) [[likely]]
   {
-    auto &queue = reader->queue();
-    while (queue.try_dequeue(m_frame))
+    // Dispatch every frame of every pending batch
+    while (reader->takeBatch(m_batch))
+    {
+      const auto count = m_batch.count();
+      for (qsizetype i = 0; i < count; ++i)
+      {
+        const auto frame = QByteArray::fromRawData(m_batch.frameData(i),
+                                                   m_batch.frameSize(i));
+        frameBuilder.hotpathRxFrame(frame);
+#ifdef BUILD_COMMERCIAL
+        mqtt.hotpathTxFrame(frame);
+#endif
+      }
+
+      reader->recycleBatch(std::move(m_batch));
+    }
+
+    // Report frames dropped by the reader
+    const auto dropped = reader->droppedFrames();
+    if (dropped != m_droppedFrames) [[unlikely]]
     {
-      frameBuilder.hotpathRxFrame(m_frame);
+      m_droppedFrames = dropped;
+      Q_EMIT droppedFramesChanged();
+    }
+  }
+}
+
+/**
+ * @brief Processes numeric sample blocks published by the audio driver.
+ *
+ * Called in the frame processing thread. Each block holds every audio frame
+ * captured since the previous one and is handed to the frame builder as a
+ * whole, so that no text is parsed for audio data. The raw data consumers
+ * (console, plugins & MQTT) still receive the samples as CSV text, see
+ * publishSampleText().
+ *
+ * Blocks received while the manager is paused are discarded, since audio
+ * keeps streaming and a backlog would only add latency once resumed.
+ */
+void IO::Manager::onSamplesReady()
+{
 #ifdef BUILD_COMMERCIAL
-      mqtt.hotpathTxFrame(m_frame);
+  static auto &audio = Drivers::Audio::instance();
+  static auto &frameBuilder = JSON::FrameBuilder::instance();
+
+  Drivers::AudioSamples samples;
+  while (audio.takeSamples(samples))
+  {
+    if (!m_paused) [[likely]]
+    {
+      frameBuilder.hotpathRxSamples(samples.values.data(), samples.rows(),
+                                    samples.channels);
+      publishSampleText(samples.values.data(), samples.rows(),
+                        samples.channels);
+    }
+
+    audio.recycleSamples(std::move(samples));
+  }
 #endif
+}
+
+/**
+ * @brief Formats a block of numeric samples as CSV text for the raw data
+ *        consumers.
+ *
+ * Each row is written as a line of comma-separated values, just like the text
+ * stream of the audio driver. The console & plugin server receive the whole
+ * block through onDataReceived() in the GUI thread, while MQTT receives each
+ * line as a frame, and only while it is publishing.
+ *
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows in the block.
+ * @param channels Number of values per row.
+ */
+void IO::Manager::publishSampleText(const double *samples,
+                                    const qsizetype rows, const int channels)
+{
+  if (rows <= 0 || channels <= 0)
+    return;
+
+  // Print integers without exponent, like the text stream does
+  QByteArray text;
+  text.reserve(rows * channels * 8);
+  for (qsizetype r = 0; r < rows; ++r)
+  {
+    const double *row = samples + r * channels;
+    for (int c = 0; c < channels; ++c)
+    {
+      if (c > 0)
+        text.append(',');
+
+      const double value = row[c];
+      if (value == std::trunc(value) && std::abs(value) < 1e15)
+        text.append(QByteArray::number(static_cast<qint64>(value)));
+      else
+        text.append(QByteArray::number(value, 'g', 6));
+    }
+
+    text.append('\n');
+  }
+
+  // Publish each line as a frame through MQTT
+#ifdef BUILD_COMMERCIAL
+  static auto &mqtt = MQTT::Client::instance();
+  if (mqtt.isConnected() && mqtt.isPublisher())
+  {
+    qsizetype start = 0;
+    qsizetype end = 0;
+    while ((end = text.indexOf('\n', start)) != -1)
+    {
+      mqtt.hotpathTxFrame(
+          QByteArray::fromRawData(text.constData() + start, end - start));
+      start = end + 1;
     }
   }
+#endif
+
+  // Feed the console & plugin server in the GUI thread
+  QMetaObject::invokeMethod(
+      this, [this, text] { onDataReceived(text); }, Qt::QueuedConnection);
 }
 
 /**
@@ -21,6 +21,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+
+#include <QMutex>
 #include <QThread>
 #include <QObject>
 #include <QSettings>
@@ -42,6 +46,10 @@ namespace IO
  *
  * Integrates with `FrameReader` for parsing data streams and ensures
  * thread-safe operation using a dedicated worker thread.
+ *
+ * Extracted frames are handed to a separate processing thread, which runs the
+ * frame builder, dashboard ingestion and data exporters. This way, data
+ * capture never waits for the user interface to finish rendering.
  */
 class Manager : public QObject
 {
@@ -86,6 +94,9 @@ class Manager : public QObject
   Q_PROPERTY(QStringList availableBuses
              READ availableBuses
              NOTIFY busListChanged)
+  Q_PROPERTY(quint64 droppedFrames
+             READ droppedFrames
+             NOTIFY droppedFramesChanged)
   // clang-format on
 
 signals:
@@ -95,6 +106,7 @@ signals:
   void busListChanged();
   void connectedChanged();
   void writeEnabledChanged();
+  void droppedFramesChanged();
   void configurationChanged();
   void maxBufferSizeChanged();
   void startSequenceChanged();
@@ -120,6 +132,7 @@ public:
   [[nodiscard]] bool isConnected();
   [[nodiscard]] bool configurationOk();
   [[nodiscard]] bool threadedFrameExtraction();
+  [[nodiscard]] quint64 droppedFrames() const;
 
   [[nodiscard]] HAL_Driver *driver();
   [[nodiscard]] SerialStudio::BusType busType() const;
@@ -131,6 +144,8 @@ public:
   [[nodiscard]] QStringList availableBuses() const;
   Q_INVOKABLE qint64 writeData(const QByteArray &data);
 
+  void processTask(std::function<void()> task);
+
 public slots:
   void connectDevice();
   void toggleConnection();
@@ -150,12 +165,16 @@ public slots:
 private:
   void killFrameReader();
   void startFrameReader();
+  void stopProcessingThread();
 
   void onReadyRead();
+  void onSamplesReady();
   void onDataReceived(const QByteArray &data);
+  void publishSampleText(const double *samples, const qsizetype rows,
+                         const int channels);
 
 private:
-  bool m_paused;
+  std::atomic<bool> m_paused;
   bool m_writeEnabled;
   bool m_thrFrameExtr;
   SerialStudio::BusType m_busType;
@@ -164,7 +183,12 @@ private:
   QThread m_workerThread;
   QPointer<FrameReader> m_frameReader;
 
-  QByteArray m_frame;
+  QMutex m_readerLock;
+  QObject m_processingContext;
+  QThread m_processingThread;
+
+  FrameBatch m_batch;
+  std::atomic<quint64> m_droppedFrames;
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
 
@@ -0,0 +1,361 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <cstring>
+#include <utility>
+
+#include <QDebug>
+#include <QtEndian>
+#include <QJsonArray>
+
+#include "SerialStudio.h"
+#include "JSON/Frame.h"
+#include "JSON/FieldDecoder.h"
+
+//------------------------------------------------------------------------------
+// Field type helpers
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Maps field type names used in project files to their enum values.
+ */
+// clang-format off
+static const std::pair<const char *, JSON::FieldType> kFieldTypes[] = {
+  {"text",    JSON::FieldType::Text},
+  {"int8",    JSON::FieldType::Int8},
+  {"uint8",   JSON::FieldType::UInt8},
+  {"int16",   JSON::FieldType::Int16},
+  {"uint16",  JSON::FieldType::UInt16},
+  {"int32",   JSON::FieldType::Int32},
+  {"uint32",  JSON::FieldType::UInt32},
+  {"float32", JSON::FieldType::Float32},
+  {"float64", JSON::FieldType::Float64},
+};
+// clang-format on
+
+/**
+ * @brief Returns the number of bytes occupied by a binary field type.
+ */
+static constexpr qsizetype fieldWidth(const JSON::FieldType type)
+{
+  switch (type)
+  {
+    case JSON::FieldType::Int8:
+    case JSON::FieldType::UInt8:
+      return 1;
+    case JSON::FieldType::Int16:
+    case JSON::FieldType::UInt16:
+      return 2;
+    case JSON::FieldType::Int32:
+    case JSON::FieldType::UInt32:
+    case JSON::FieldType::Float32:
+      return 4;
+    case JSON::FieldType::Float64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief Reads an unaligned integer with the given byte order.
+ */
+template<typename T>
+static inline T readInteger(const uchar *src, const bool bigEndian)
+{
+  return bigEndian ? qFromBigEndian<T>(src) : qFromLittleEndian<T>(src);
+}
+
+//------------------------------------------------------------------------------
+// Constructor & configuration
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty (disabled) field decoder.
+ */
+JSON::FieldDecoder::FieldDecoder()
+  : m_lastToken(-1)
+{
+}
+
+/**
+ * @brief Returns @c true if the decoder has at least one field configured.
+ */
+bool JSON::FieldDecoder::isEnabled() const
+{
+  return !m_fields.empty();
+}
+
+/**
+ * @brief Returns the number of channels produced for each frame.
+ */
+qsizetype JSON::FieldDecoder::count() const
+{
+  return static_cast<qsizetype>(m_values.size());
+}
+
+/**
+ * @brief Returns the result of the last decode() call for a given channel.
+ *
+ * @param channel Zero-based channel index (dataset index minus one).
+ */
+const JSON::FieldDecoder::Value &
+JSON::FieldDecoder::value(const qsizetype channel) const
+{
+  return m_values[channel];
+}
+
+/**
+ * @brief Removes all fields, disabling the decoder.
+ */
+void JSON::FieldDecoder::clear()
+{
+  m_lastToken = -1;
+  m_separator.clear();
+  m_values.clear();
+  m_fields.clear();
+  m_tokenEnds.clear();
+  m_tokenStarts.clear();
+}
+
+/**
+ * @brief Loads the field list from the `nativeParser` object of a project.
+ *
+ * If a field has an unknown type, a warning is logged and no field is
+ * loaded, so that frames are handed over to the JavaScript parser instead of
+ * being decoded with the wrong layout.
+ *
+ * @param project Root JSON object of the project file.
+ * @return @c true if at least one field was loaded.
+ */
+bool JSON::FieldDecoder::load(const QJsonObject &project)
+{
+  // Reset decoder & obtain configuration object
+  clear();
+  const auto config = project.value(Keys::NativeParser).toObject();
+  const auto fields = config.value(Keys::Fields).toArray();
+  if (fields.isEmpty())
+    return false;
+
+  // Read token separator
+  const auto sep = ss_jsr(config, Keys::Separator, ",").toString();
+  m_separator = SerialStudio::resolveEscapeSequences(sep).toUtf8();
+
+  // Read field list
+  m_fields.reserve(fields.count());
+  for (qsizetype i = 0; i < fields.count(); ++i)
+  {
+    const auto obj = fields.at(i).toObject();
+
+    // Reject the whole field list if a type name is not valid
+    FrameField field;
+    const auto type = ss_jsr(obj, Keys::Type, "text").toString();
+    if (!typeFromName(type, field.type))
+    {
+      qWarning() << "Native parser field" << i + 1 << "has an unknown type"
+                 << type << "- using the JavaScript parser instead";
+      clear();
+      return false;
+    }
+
+    field.offset = qMax(0, ss_jsr(obj, Keys::Offset, 0).toInt());
+    field.bigEndian = ss_jsr(obj, Keys::BigEndian, false).toBool();
+    field.scale = ss_jsr(obj, Keys::Scale, 1).toDouble();
+    field.bias = ss_jsr(obj, Keys::Bias, 0).toDouble();
+    m_fields.push_back(field);
+
+    if (field.type == FieldType::Text)
+      m_lastToken = qMax(m_lastToken, field.offset);
+  }
+
+  // Allocate output values
+  m_values.resize(m_fields.size());
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Frame decoding
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes all fields from a raw frame.
+ *
+ * Fields that do not fit in the frame are marked as invalid so that the
+ * datasets that use them keep their previous value. Text fields that cannot
+ * be converted to a number keep a pointer to their token, which remains
+ * valid for as long as @p frame is alive and unmodified.
+ *
+ * @param frame Raw frame bytes, as received from the frame reader.
+ * @return The number of decoded channels.
+ */
+qsizetype JSON::FieldDecoder::decode(const QByteArray &frame)
+{
+  // Split text frames only as far as needed
+  if (m_lastToken >= 0)
+    tokenize(frame);
+
+  // Decode each field
+  const auto size = frame.size();
+  const auto tokens = static_cast<qsizetype>(m_tokenStarts.size());
+  const auto *data = reinterpret_cast<const uchar *>(frame.constData());
+  for (size_t i = 0; i < m_fields.size(); ++i)
+  {
+    const auto &field = m_fields[i];
+    auto &result = m_values[i];
+    result = Value();
+
+    // Text token, convert to number without copying it
+    if (field.type == FieldType::Text)
+    {
+      if (field.offset >= tokens)
+        continue;
+
+      double number = 0;
+      const auto start = m_tokenStarts[field.offset];
+      const auto length = m_tokenEnds[field.offset] - start;
+      const auto *token = frame.constData() + start;
+      const bool ok = parse_number(token, length, number);
+
+      result.valid = true;
+      result.numeric = ok;
+      if (ok)
+        result.number = number * field.scale + field.bias;
+      else
+      {
+        result.text = token;
+        result.textSize = length;
+      }
+
+      continue;
+    }
+
+    // Binary value, ensure that it fits in the frame
+    if (field.offset + fieldWidth(field.type) > size)
+      continue;
+
+    // Read raw value
+    double raw = 0;
+    const auto *src = data + field.offset;
+    switch (field.type)
+    {
+      case FieldType::Int8:
+        raw = static_cast<qint8>(src[0]);
+        break;
+      case FieldType::UInt8:
+        raw = src[0];
+        break;
+      case FieldType::Int16:
+        raw = readInteger<qint16>(src, field.bigEndian);
+        break;
+      case FieldType::UInt16:
+        raw = readInteger<quint16>(src, field.bigEndian);
+        break;
+      case FieldType::Int32:
+        raw = readInteger<qint32>(src, field.bigEndian);
+        break;
+      case FieldType::UInt32:
+        raw = readInteger<quint32>(src, field.bigEndian);
+        break;
+      case FieldType::Float32: {
+        float value;
+        const auto bits = readInteger<quint32>(src, field.bigEndian);
+        std::memcpy(&value, &bits, sizeof(value));
+        raw = value;
+      }
+      break;
+      case FieldType::Float64: {
+        double value;
+        const auto bits = readInteger<quint64>(src, field.bigEndian);
+        std::memcpy(&value, &bits, sizeof(value));
+        raw = value;
+      }
+      break;
+      default:
+        break;
+    }
+
+    // Apply scaling
+    result.valid = true;
+    result.numeric = true;
+    result.number = raw * field.scale + field.bias;
+  }
+
+  return count();
+}
+
+/**
+ * @brief Locates the tokens of a text frame, up to the last token that is
+ *        referenced by a field.
+ *
+ * @param frame Raw frame bytes.
+ */
+void JSON::FieldDecoder::tokenize(const QByteArray &frame)
+{
+  m_tokenEnds.clear();
+  m_tokenStarts.clear();
+
+  // Without a separator, the whole frame is a single token
+  if (m_separator.isEmpty())
+  {
+    m_tokenStarts.push_back(0);
+    m_tokenEnds.push_back(frame.size());
+    return;
+  }
+
+  // Register token boundaries
+  qsizetype pos = 0;
+  while (static_cast<int>(m_tokenStarts.size()) <= m_lastToken)
+  {
+    const auto index = frame.indexOf(m_separator, pos);
+    m_tokenStarts.push_back(pos);
+    m_tokenEnds.push_back(index == -1 ? frame.size() : index);
+    if (index == -1)
+      break;
+
+    pos = index + m_separator.size();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Type name parsing
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Parses a field type name.
+ *
+ * @param name Type name, as written in the project file (case-insensitive).
+ * @param type Receives the parsed type.
+ * @return @c false if @p name is not a known type, @p type is left unchanged.
+ */
+bool JSON::FieldDecoder::typeFromName(const QString &name, FieldType &type)
+{
+  const auto key = name.trimmed().toLower();
+  for (const auto &entry : kFieldTypes)
+  {
+    if (key == QLatin1String(entry.first))
+    {
+      type = entry.second;
+      return true;
+    }
+  }
+
+  return false;
+}
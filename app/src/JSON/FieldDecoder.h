@@ -0,0 +1,129 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <QByteArray>
+#include <QJsonObject>
+
+namespace JSON
+{
+/**
+ * @brief Data type of a field decoded by the native frame decoder.
+ */
+enum class FieldType
+{
+  Text,    ///< Separator-delimited token, converted to a number if possible
+  Int8,    ///< Signed 8-bit integer
+  UInt8,   ///< Unsigned 8-bit integer
+  Int16,   ///< Signed 16-bit integer
+  UInt16,  ///< Unsigned 16-bit integer
+  Int32,   ///< Signed 32-bit integer
+  UInt32,  ///< Unsigned 32-bit integer
+  Float32, ///< IEEE-754 single precision float
+  Float64  ///< IEEE-754 double precision float
+};
+
+/**
+ * @brief Describes how to obtain one channel value from a raw frame.
+ *
+ * For binary types, @c offset is the position of the first byte of the field
+ * within the frame. For text fields, @c offset is the index of the token
+ * after splitting the frame with the decoder separator.
+ *
+ * Numeric results are computed as `raw * scale + bias`.
+ */
+struct alignas(8) FrameField
+{
+  int offset = 0;                   ///< Byte offset or token index
+  bool bigEndian = false;           ///< Byte order for multi-byte fields
+  FieldType type = FieldType::Text; ///< Field data type
+  double scale = 1;                 ///< Multiplier applied to the raw value
+  double bias = 0;                  ///< Offset added after scaling
+};
+static_assert(sizeof(FrameField) % alignof(FrameField) == 0,
+              "Unaligned FrameField struct");
+
+/**
+ * @class JSON::FieldDecoder
+ * @brief Declarative, non-scripted frame decoder.
+ *
+ * Converts raw frames into channel values using a list of fields defined in
+ * the project file, as an alternative to calling the JavaScript @c parse()
+ * function for every frame. The decoder is configured with the
+ * `nativeParser` object of a project:
+ *
+ * @code
+ * "nativeParser": {
+ *   "separator": ",",
+ *   "fields": [
+ *     { "type": "uint16", "offset": 0, "bigEndian": true, "scale": 0.1 },
+ *     { "type": "float32", "offset": 2 },
+ *     { "type": "text", "offset": 3, "bias": -273.15 }
+ *   ]
+ * }
+ * @endcode
+ *
+ * Field @c N of the list is published as channel @c N+1, which is the index
+ * that datasets refer to. The decoder works on the raw frame bytes, so the
+ * project's data format (hexadecimal, Base64...) does not apply to it.
+ */
+class FieldDecoder
+{
+public:
+  /**
+   * @brief Result of decoding a single field.
+   */
+  struct Value
+  {
+    bool valid = false;         ///< @c false if the field is not in the frame
+    bool numeric = false;       ///< @c true if @c number holds the value
+    double number = 0;          ///< Scaled numeric value
+    const char *text = nullptr; ///< Raw token (non-numeric text only)
+    qsizetype textSize = 0;     ///< Length of @c text
+  };
+
+  FieldDecoder();
+
+  [[nodiscard]] bool isEnabled() const;
+  [[nodiscard]] qsizetype count() const;
+  [[nodiscard]] const Value &value(const qsizetype channel) const;
+
+  void clear();
+  bool load(const QJsonObject &project);
+  qsizetype decode(const QByteArray &frame);
+
+  static bool typeFromName(const QString &name, FieldType &type);
+
+private:
+  void tokenize(const QByteArray &frame);
+
+private:
+  int m_lastToken;
+  QByteArray m_separator;
+  std::vector<Value> m_values;
+  std::vector<FrameField> m_fields;
+  std::vector<qsizetype> m_tokenEnds;
+  std::vector<qsizetype> m_tokenStarts;
+};
+} // namespace JSON
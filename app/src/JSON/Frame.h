@@ -23,8 +23,12 @@
 
 #include <cmath>
 #include <vector>
+#include <charconv>
+#include <system_error>
 
+#include <QLocale>
 #include <QString>
+#include <QByteArray>
 #include <QJsonArray>
 #include <QJsonObject>
 
@@ -64,11 +68,23 @@ inline constexpr auto WgtMin = "widgetMin";
 inline constexpr auto WgtMax = "widgetMax";
 inline constexpr auto AlarmLow = "alarmLow";
 inline constexpr auto AlarmHigh = "alarmHigh";
+inline constexpr auto Waterfall = "waterfall";
 inline constexpr auto FFTSamples = "fftSamples";
+inline constexpr auto FFTOverlap = "fftOverlap";
+inline constexpr auto FFTAverages = "fftAverages";
 inline constexpr auto Overview = "overviewDisplay";
 inline constexpr auto AlarmEnabled = "alarmEnabled";
 inline constexpr auto FFTSamplingRate = "fftSamplingRate";
 
+inline constexpr auto Bias = "bias";
+inline constexpr auto Type = "type";
+inline constexpr auto Scale = "scale";
+inline constexpr auto Fields = "fields";
+inline constexpr auto Offset = "offset";
+inline constexpr auto BigEndian = "bigEndian";
+inline constexpr auto Separator = "separator";
+inline constexpr auto NativeParser = "nativeParser";
+
 inline constexpr auto Groups = "groups";
 inline constexpr auto Actions = "actions";
 inline constexpr auto Datasets = "datasets";
@@ -140,8 +156,11 @@ struct alignas(8) Dataset
   int datasetId = 0;            ///< Unique ID within group
   int fftSamples = 256;         ///< Number of samples for FFT
   int fftSamplingRate = 100;    ///< Sampling rate for FFT
+  int fftOverlap = 50;          ///< Overlap between FFT windows (percent)
+  int fftAverages = 1;          ///< Number of FFT windows averaged (Welch)
   bool fft = false;             ///< Enables FFT processing
   bool led = false;             ///< Enables LED widget
+  bool waterfall = false;       ///< Enables FFT waterfall widget
   bool log = false;             ///< Enables logging
   bool plt = false;             ///< Enables plotting
   bool alarmEnabled = false;    ///< Enable/disable alarm values
@@ -157,7 +176,7 @@ struct alignas(8) Dataset
   double alarmLow = 20;         ///< Low alarm threshold
   double alarmHigh = 80;        ///< High alarm threshold
   double numericValue = 0;      ///< Parsed numeric value
-  QString value;                ///< Raw string value
+  QString value;                ///< Text value (only set if non-numeric)
   QString title;                ///< Human-readable title
   QString units;                ///< Measurement units (e.g., °C)
   QString widget;               ///< Widget type (bar, gauge, etc.)
@@ -226,6 +245,161 @@ inline void clear_frame(Frame &frame)
   frame.containsCommercialFeatures = false;
 }
 
+//------------------------------------------------------------------------------
+// Dataset value utilities
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Parses a decimal number from a range of bytes without allocating.
+ *
+ * Leading and trailing whitespace is ignored, and the remaining characters
+ * must form a complete number. Uses `std::from_chars()` when the standard
+ * library provides floating-point support for it, and Qt's locale-independent
+ * parser otherwise.
+ *
+ * @param str Pointer to the first character.
+ * @param length Number of characters to parse.
+ * @param value Receives the parsed number, left untouched on failure.
+ * @return @c true if the range contains a valid number.
+ */
+[[nodiscard]] inline bool parse_number(const char *str, qsizetype length,
+                                       double &value)
+{
+  // Trim whitespace
+  while (length > 0 && (*str == ' ' || (*str >= '\t' && *str <= '\r')))
+  {
+    ++str;
+    --length;
+  }
+
+  while (length > 0
+         && (str[length - 1] == ' '
+             || (str[length - 1] >= '\t' && str[length - 1] <= '\r')))
+    --length;
+
+  // std::from_chars() does not accept an explicit positive sign
+  if (length > 1 && *str == '+' && str[1] != '-' && str[1] != '+')
+  {
+    ++str;
+    --length;
+  }
+
+  // Empty string
+  if (length <= 0)
+    return false;
+
+#if defined(__cpp_lib_to_chars)
+  double number;
+  const auto result = std::from_chars(str, str + length, number);
+  if (result.ec != std::errc() || result.ptr != str + length)
+    return false;
+#else
+  bool ok;
+  const auto number = QByteArray::fromRawData(str, length).toDouble(&ok);
+  if (!ok)
+    return false;
+#endif
+
+  value = number;
+  return true;
+}
+
+/**
+ * @brief Parses a decimal number from a UTF-16 string without allocating.
+ *
+ * @param str String to parse.
+ * @param value Receives the parsed number, left untouched on failure.
+ * @return @c true if the string contains a valid number.
+ */
+[[nodiscard]] inline bool parse_number(QStringView str, double &value)
+{
+  // Narrow to a stack buffer, numbers only contain ASCII characters
+  char buffer[64];
+  const auto length = str.size();
+  if (length > static_cast<qsizetype>(sizeof(buffer)))
+    return false;
+
+  const auto *data = str.utf16();
+  for (qsizetype i = 0; i < length; ++i)
+  {
+    if (data[i] > 0x7f)
+      return false;
+
+    buffer[i] = static_cast<char>(data[i]);
+  }
+
+  return parse_number(buffer, length, value);
+}
+
+/**
+ * @brief Assigns a numeric value to a dataset.
+ *
+ * Numeric values are stored without any string representation; use
+ * format_value() to obtain the text when it is needed for display.
+ */
+inline void assign_value(Dataset &d, const double value)
+{
+  d.isNumeric = true;
+  d.numericValue = value;
+  if (!d.value.isNull())
+    d.value = QString();
+}
+
+/**
+ * @brief Assigns a value received as text to a dataset.
+ *
+ * Numeric strings are converted and stored as numbers. Any other text is
+ * shared with the dataset (no deep copy is made).
+ */
+inline void assign_value(Dataset &d, const QString &text)
+{
+  double number;
+  if (parse_number(text, number))
+    assign_value(d, number);
+
+  else
+  {
+    d.value = text;
+    d.isNumeric = false;
+    d.numericValue = 0;
+  }
+}
+
+/**
+ * @brief Assigns a value received as UTF-8 bytes to a dataset.
+ *
+ * A QString is only created if the bytes do not represent a number.
+ */
+inline void assign_value(Dataset &d, const char *text, const qsizetype length)
+{
+  double number;
+  if (parse_number(text, length, number))
+    assign_value(d, number);
+
+  else
+  {
+    d.value = QString::fromUtf8(text, length);
+    d.isNumeric = false;
+    d.numericValue = 0;
+  }
+}
+
+/**
+ * @brief Returns the text representation of a dataset value.
+ *
+ * Numeric values are formatted on demand, using the shortest representation
+ * that preserves the value, so that only consumers that actually display or
+ * export text pay for the conversion.
+ */
+[[nodiscard]] inline QString format_value(const Dataset &d)
+{
+  if (d.isNumeric)
+    return QString::number(d.numericValue, 'g',
+                           QLocale::FloatingPointShortest);
+
+  return d.value;
+}
+
 /**
  * @brief Compares two frames for structural equivalence.
  *
@@ -342,12 +516,13 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
  * @brief Serializes a Dataset to a QJsonObject.
  *
  * Converts a Dataset object into a JSON structure including:
- * - Flags: `fft`, `led`, `log`, `graph`, `overviewDisplay`
+ * - Flags: `fft`, `led`, `log`, `graph`, `waterfall`, `overviewDisplay`
  * - Indices: `index`, `xAxis`
  * - Thresholds: `ledHigh`, `alarmLow`, `alarmHigh`
  * - Limits: `min`, `max` (automatically ordered via qMin/qMax)
  * - Metadata: `title`, `value`, `units`, `widget`, `fftWindow`
- * - FFT settings: `fftSamples`, `fftSamplingRate`
+ * - FFT settings: `fftSamples`, `fftSamplingRate`, `fftOverlap`,
+ *   `fftAverages`
  *
  * All QString fields are simplified (trimmed and collapsed whitespace).
  *
@@ -359,15 +534,18 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
   QJsonObject obj;
   obj.insert(Keys::FFT, d.fft);
   obj.insert(Keys::LED, d.led);
+  obj.insert(Keys::Waterfall, d.waterfall);
   obj.insert(Keys::Log, d.log);
   obj.insert(Keys::Graph, d.plt);
   obj.insert(Keys::Index, d.index);
   obj.insert(Keys::XAxis, d.xAxisId);
   obj.insert(Keys::LedHigh, d.ledHigh);
   obj.insert(Keys::FFTSamples, d.fftSamples);
+  obj.insert(Keys::FFTOverlap, d.fftOverlap);
+  obj.insert(Keys::FFTAverages, d.fftAverages);
   obj.insert(Keys::Overview, d.overviewDisplay);
   obj.insert(Keys::Title, d.title.simplified());
-  obj.insert(Keys::Value, d.value.simplified());
+  obj.insert(Keys::Value, format_value(d).simplified());
   obj.insert(Keys::Units, d.units.simplified());
   obj.insert(Keys::AlarmEnabled, d.alarmEnabled);
   obj.insert(Keys::Widget, d.widget.simplified());
@@ -514,13 +692,15 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
  *
  * Parses all dataset configuration fields, including:
  * - Structural fields: `index`, `groupId`, `datasetId`, `xAxis`
- * - Visualization flags: `fft`, `led`, `log`, `plt`, `overviewDisplay`
+ * - Visualization flags: `fft`, `led`, `log`, `plt`, `waterfall`,
+ *   `overviewDisplay`
  * - Thresholds and limits: `min`, `max`, `ledHigh`, `alarmLow`, `alarmHigh`
- * - FFT settings: `fftSamples`, `fftSamplingRate`, `fftWindow`
+ * - FFT settings: `fftSamples`, `fftSamplingRate`, `fftOverlap`,
+ *   `fftAverages`, `fftWindow`
  * - Display info: `title`, `value`, `units`, `widget`
  *
  * If a numeric value is detected in `value`, it's parsed and stored in
- * `numericValue` with the `isNumeric` flag set.
+ * `numericValue` with the `isNumeric` flag set (see assign_value()).
  *
  * Handles legacy single `alarm` field if both high/low are unset.
  * Applies auto-normalization for min/max order.
@@ -537,6 +717,7 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
   d.index = ss_jsr(obj, Keys::Index, -1).toInt();
   d.fft = ss_jsr(obj, Keys::FFT, false).toBool();
   d.led = ss_jsr(obj, Keys::LED, false).toBool();
+  d.waterfall = ss_jsr(obj, Keys::Waterfall, false).toBool();
   d.log = ss_jsr(obj, Keys::Log, false).toBool();
   d.plt = ss_jsr(obj, Keys::Graph, false).toBool();
   d.xAxisId = ss_jsr(obj, Keys::XAxis, -1).toInt();
@@ -547,8 +728,9 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
   d.wgtMin = ss_jsr(obj, Keys::WgtMin, 0).toDouble();
   d.wgtMax = ss_jsr(obj, Keys::WgtMax, 0).toDouble();
   d.fftSamples = ss_jsr(obj, Keys::FFTSamples, -1).toInt();
+  d.fftOverlap = ss_jsr(obj, Keys::FFTOverlap, 50).toInt();
+  d.fftAverages = ss_jsr(obj, Keys::FFTAverages, 1).toInt();
   d.title = ss_jsr(obj, Keys::Title, "").toString().simplified();
-  d.value = ss_jsr(obj, Keys::Value, "").toString().simplified();
   d.units = ss_jsr(obj, Keys::Units, "").toString().simplified();
   d.overviewDisplay = ss_jsr(obj, Keys::Overview, false).toBool();
   d.alarmEnabled = ss_jsr(obj, Keys::AlarmEnabled, false).toBool();
@@ -557,10 +739,12 @@ void read_io_settings(QByteArray &frameStart, QByteArray &frameEnd,
   d.alarmLow = ss_jsr(obj, Keys::AlarmLow, 0).toDouble();
   d.fftSamplingRate = ss_jsr(obj, Keys::FFTSamplingRate, -1).toInt();
   d.alarmHigh = ss_jsr(obj, Keys::AlarmHigh, 0).toDouble();
-  if (d.value.isEmpty())
+
+  const auto value = ss_jsr(obj, Keys::Value, "").toString().simplified();
+  if (value.isEmpty())
     d.value = QStringLiteral("--.--");
   else
-    d.numericValue = d.value.toDouble(&d.isNumeric);
+    assign_value(d, value);
 
   if (!obj.contains(Keys::FFTMin) || !obj.contains(Keys::FFTMax))
   {
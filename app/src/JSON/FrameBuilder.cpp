@@ -19,10 +19,12 @@
  * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
  */
 
+#include <QThread>
 #include <QFileInfo>
 
 #include "IO/Manager.h"
 #include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
 
 #include "CSV/Player.h"
 #include "JSON/ProjectModel.h"
@@ -41,7 +43,10 @@
  * Initializes the JSON Parser class and connects appropiate SIGNALS/SLOTS
  */
 JSON::FrameBuilder::FrameBuilder()
-  : m_quickPlotChannels(-1)
+  : m_parserCodeChanged(false)
+  , m_scriptEngine(nullptr)
+  , m_decoderMethod(SerialStudio::PlainText)
+  , m_quickPlotChannels(-1)
   , m_frameParser(nullptr)
   , m_opMode(SerialStudio::ProjectFile)
 {
@@ -60,6 +65,8 @@ JSON::FrameBuilder::FrameBuilder()
           &Licensing::LemonSqueezy::activatedChanged, this, [=, this] {
             if (!jsonMapFilepath().isEmpty())
               loadJsonMap(jsonMapFilepath());
+
+            syncFrameParser();
           });
 #endif
 }
@@ -139,6 +146,14 @@ void JSON::FrameBuilder::setupExternalConnections()
 {
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
           &JSON::FrameBuilder::onConnectedChanged);
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::frameParserCodeChanged, this,
+          &JSON::FrameBuilder::syncFrameParser);
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::decoderMethodChanged, this,
+          &JSON::FrameBuilder::syncFrameParser);
+
+  syncFrameParser();
 }
 
 /**
@@ -153,8 +168,7 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
   // Close previous file (if open)
   if (m_jsonMap.isOpen())
   {
-    clear_frame(m_frame);
-
+    clearProjectFrame();
     m_jsonMap.close();
     Q_EMIT jsonFileMapChanged();
   }
@@ -169,8 +183,7 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
     auto document = QJsonDocument::fromJson(data, &error);
     if (error.error != QJsonParseError::NoError)
     {
-      clear_frame(m_frame);
-
+      clearProjectFrame();
       m_jsonMap.close();
       setJsonPathSetting("");
       Misc::Utilities::showMessageBox(
@@ -183,9 +196,14 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
       // Save settings
       setJsonPathSetting(path);
 
-      // Load frame from data
-      clear_frame(m_frame);
-      const bool ok = read(m_frame, document.object());
+      // Load frame & native field decoder (if any) from data
+      bool ok = false;
+      {
+        QMutexLocker locker(&m_frameLock);
+        clear_frame(m_frame);
+        ok = read(m_frame, document.object());
+        m_fieldDecoder.load(document.object());
+      }
 
       // Update I/O manager settings
       if (ok)
@@ -205,7 +223,7 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
       // Invalid frame data
       else
       {
-        clear_frame(m_frame);
+        clearProjectFrame();
         m_jsonMap.close();
         setJsonPathSetting("");
         Misc::Utilities::showMessageBox(
@@ -258,7 +276,10 @@ void JSON::FrameBuilder::setFrameParser(JSON::FrameParser *parser)
 void JSON::FrameBuilder::setOperationMode(
     const SerialStudio::OperationMode mode)
 {
-  m_opMode = mode;
+  {
+    QMutexLocker locker(&m_frameLock);
+    m_opMode = mode;
+  }
 
   switch (mode)
   {
@@ -301,11 +322,15 @@ void JSON::FrameBuilder::setOperationMode(
  * - If using a project file, delegates parsing to the configured frame parser.
  * - If in Quick Plot mode, parses CSV-like data for plotting.
  *
+ * Called from the frame processing thread of the I/O manager, with the frame
+ * lock held so that the project cannot change while a frame is parsed.
+ *
  * @param data Raw binary input data to be processed.
  */
 void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
 {
-  switch (operationMode())
+  QMutexLocker locker(&m_frameLock);
+  switch (m_opMode)
   {
     case SerialStudio::QuickPlot:
       parseQuickPlotFrame(data);
@@ -320,6 +345,55 @@ void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
   }
 }
 
+/**
+ * @brief Publishes a block of numeric samples in Quick Plot mode.
+ *
+ * This is a hotpath function executed at high frequency.
+ *
+ * Used by data sources that already deliver numbers (i.e. the audio driver),
+ * so that no text has to be generated and parsed again for every sample.
+ * Each row of @p samples is equivalent to a Quick Plot frame with
+ * @p channels comma-separated values.
+ *
+ * The datasets of the Quick Plot frame are set to the last row of the block,
+ * while the whole block is handed to the consumers that keep a history.
+ *
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows (frames) in the block.
+ * @param channels Number of values per row.
+ */
+void JSON::FrameBuilder::hotpathRxSamples(const double *samples,
+                                          const qsizetype rows,
+                                          const int channels)
+{
+  QMutexLocker locker(&m_frameLock);
+  if (m_opMode != SerialStudio::QuickPlot || rows <= 0 || channels <= 0)
+      [[unlikely]]
+    return;
+
+  // Rebuild frame if channel count changed
+  if (channels != m_quickPlotChannels) [[unlikely]]
+  {
+    buildQuickPlotFrame(channels);
+    m_quickPlotChannels = channels;
+  }
+
+  // Keep the latest row in the frame
+  const double *last = samples + (rows - 1) * channels;
+  for (auto &group : m_quickPlotFrame.groups)
+  {
+    for (auto &dataset : group.datasets)
+    {
+      const int idx = dataset.index;
+      if (idx > 0 && idx <= channels) [[likely]]
+        assign_value(dataset, last[idx - 1]);
+    }
+  }
+
+  // Process the block
+  hotpathTxSamples(m_quickPlotFrame, samples, rows, channels);
+}
+
 //------------------------------------------------------------------------------
 // Private slots
 //------------------------------------------------------------------------------
@@ -342,7 +416,10 @@ void JSON::FrameBuilder::hotpathRxFrame(const QByteArray &data)
 void JSON::FrameBuilder::onConnectedChanged()
 {
   // Reset quick plot field count
-  m_quickPlotChannels = -1;
+  {
+    QMutexLocker locker(&m_frameLock);
+    m_quickPlotChannels = -1;
+  }
 
   // Validate that the device is connected
   if (!IO::Manager::instance().isConnected())
@@ -361,6 +438,52 @@ void JSON::FrameBuilder::onConnectedChanged()
   }
 }
 
+/**
+ * @brief Obtains the frame parser code & decoder method from the project
+ *        model.
+ *
+ * Called when a project is loaded or saved, and when the frame decoder is
+ * changed in the project editor. The JavaScript engine of the processing
+ * thread is rebuilt with the new code the next time that a project frame is
+ * parsed.
+ */
+void JSON::FrameBuilder::syncFrameParser()
+{
+  const auto &model = JSON::ProjectModel::instance();
+
+  QMutexLocker locker(&m_frameLock);
+  m_decoderMethod = model.decoderMethod();
+  if (m_parserCode != model.frameParserCode())
+  {
+    m_parserCode = model.frameParserCode();
+    m_parserCodeChanged = true;
+  }
+}
+
+/**
+ * @brief Deletes the JavaScript engine used to run the frame parser.
+ *
+ * Must be called from the thread that created the engine, this happens
+ * automatically when the frame processing thread finishes.
+ */
+void JSON::FrameBuilder::releaseParserScript()
+{
+  m_parseFunction = QJSValue();
+
+  delete m_scriptEngine;
+  m_scriptEngine = nullptr;
+}
+
+/**
+ * @brief Clears the project frame and the native field decoder.
+ */
+void JSON::FrameBuilder::clearProjectFrame()
+{
+  QMutexLocker locker(&m_frameLock);
+  clear_frame(m_frame);
+  m_fieldDecoder.clear();
+}
+
 /**
  * Saves the location of the last valid JSON map file that was opened (if any)
  */
@@ -373,6 +496,49 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
 // Frame parsing
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Parses a project frame using the native field decoder.
+ *
+ * Each field of the project's `nativeParser` list is read directly from the
+ * raw frame bytes, so numeric values are assigned to the datasets without
+ * going through the JavaScript engine or intermediate string lists. Datasets
+ * whose field is not present in the frame keep their previous value.
+ *
+ * @param data Raw frame bytes.
+ *
+ * @note This function is part of the high-frequency data path.
+ */
+void JSON::FrameBuilder::parseFieldFrame(const QByteArray &data)
+{
+  // Decode frame
+  const auto channelCount = m_fieldDecoder.decode(data);
+  if (channelCount <= 0)
+    return;
+
+  // Replace data in frame
+  for (auto &group : m_frame.groups)
+  {
+    for (auto &dataset : group.datasets)
+    {
+      const int idx = dataset.index;
+      if (idx <= 0 || idx > channelCount) [[unlikely]]
+        continue;
+
+      const auto &value = m_fieldDecoder.value(idx - 1);
+      if (!value.valid)
+        continue;
+
+      if (value.numeric)
+        assign_value(dataset, value.number);
+      else
+        assign_value(dataset, value.text, value.textSize);
+    }
+  }
+
+  // Update user interface
+  hotpathTxFrame(m_frame);
+}
+
 /**
  * @brief Parses a project frame using the configured decoding method.
  *
@@ -382,44 +548,60 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
  * string directly. Updates all frame datasets with the parsed values and
  * triggers a UI update.
  *
+ * During CSV playback, cells are matched to datasets by position and empty
+ * cells leave the value of their dataset unchanged, just like
+ * CSV::Player::loadFrames() does when it fills the dashboard history.
+ *
+ * If the project defines a native field list, frames are handed over to
+ * parseFieldFrame() and the JavaScript frame parser is not called.
+ *
  * @param data Raw binary input to be decoded and assigned to frame datasets.
  *
  * @note This function is part of the high-frequency data path. Optimize later.
  */
 void JSON::FrameBuilder::parseProjectFrame(const QByteArray &data)
 {
+  // Use the native field decoder instead of the JavaScript parser
+  const bool playerOpen = CSV::Player::instance().isOpen();
+  if (!playerOpen && m_fieldDecoder.isEnabled())
+  {
+    parseFieldFrame(data);
+    return;
+  }
+
   // Real-time data, parse data & perform conversion
   QStringList channels;
   channels.reserve(64);
-  if (!CSV::Player::instance().isOpen() && m_frameParser) [[likely]]
+  if (!playerOpen && loadParserScript()) [[likely]]
   {
-    switch (JSON::ProjectModel::instance().decoderMethod())
+    switch (m_decoderMethod)
     {
       case SerialStudio::Hexadecimal:
-        channels = m_frameParser->parse(QString::fromUtf8(data.toHex()));
+        channels = runParserScript(QString::fromUtf8(data.toHex()));
         break;
       case SerialStudio::Base64:
-        channels = m_frameParser->parse(QString::fromUtf8(data.toBase64()));
+        channels = runParserScript(QString::fromUtf8(data.toBase64()));
         break;
       case SerialStudio::Binary:
-        channels = m_frameParser->parse(data);
+        channels = runParserScript(data);
         break;
       case SerialStudio::PlainText:
       default:
-        channels = m_frameParser->parse(QString::fromUtf8(data));
+        channels = runParserScript(QString::fromUtf8(data));
         break;
     }
   }
 
-  // CSV data, no need to perform conversions or use frame parser
+  // CSV data, no need to perform conversions or use frame parser. Empty cells
+  // are kept, so that cell N always feeds the dataset with index N+1
   else
-    channels = QString::fromUtf8(data).split(',', Qt::SkipEmptyParts);
+    channels = QString::fromUtf8(data).split(',');
 
   // Process data
   if (!channels.isEmpty())
   {
     // Replace data in frame
-    auto *channelData = channels.data();
+    const auto *channelData = channels.constData();
     const int channelCount = channels.size();
     for (size_t g = 0; g < m_frame.groups.size(); ++g)
     {
@@ -428,12 +610,14 @@ void JSON::FrameBuilder::parseProjectFrame(const QByteArray &data)
       {
         auto &dataset = group.datasets[d];
         const int idx = dataset.index;
-        if (idx > 0 && idx <= channelCount) [[likely]]
-        {
-          QString &value = channelData[idx - 1];
-          dataset.value = std::move(value);
-          dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
-        }
+        if (idx <= 0 || idx > channelCount) [[unlikely]]
+          continue;
+
+        // Empty CSV cells keep the previous value of the dataset
+        if (playerOpen && channelData[idx - 1].trimmed().isEmpty()) [[unlikely]]
+          continue;
+
+        assign_value(dataset, channelData[idx - 1]);
       }
     }
 
@@ -457,40 +641,43 @@ void JSON::FrameBuilder::parseProjectFrame(const QByteArray &data)
  */
 void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
 {
-  // Create a vector of channels
-  QStringList channels;
-  if (m_quickPlotChannels > 0) [[likely]]
-    channels.reserve(m_quickPlotChannels);
-  else
-    channels.reserve(64);
-
-  // Split the string into commas
-  int start = 0;
-  const auto str = QString::fromUtf8(data);
-  const int dataLength = str.size();
-  for (int i = 0; i <= str.size(); ++i)
+  // Whitespace check that never splits multi-byte UTF-8 characters
+  const auto isSpace = [](const char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+  };
+
+  // Locate the (trimmed) bounds of each comma-separated channel
+  m_quickPlotTokens.clear();
+  const auto *str = data.constData();
+  const qsizetype dataLength = data.size();
+  qsizetype start = 0;
+  for (qsizetype i = 0; i <= dataLength; ++i)
   {
     if (i == dataLength || str[i] == ',')
     {
-      channels.append(str.mid(start, i - start).trimmed());
+      qsizetype end = i;
+      while (start < end && isSpace(str[start]))
+        ++start;
+      while (end > start && isSpace(str[end - 1]))
+        --end;
+
+      m_quickPlotTokens.emplace_back(start, end - start);
       start = i + 1;
     }
   }
 
   // Process data
-  const int channelCount = channels.size();
+  const int channelCount = static_cast<int>(m_quickPlotTokens.size());
   if (channelCount > 0)
   {
     // Rebuild frame if channel count changed
     if (channelCount != m_quickPlotChannels) [[unlikely]]
     {
-      buildQuickPlotFrame(channels);
+      buildQuickPlotFrame(channelCount);
       m_quickPlotChannels = channelCount;
     }
 
-    // Replace data in frame
-    auto *channelData = channels.data();
-    const int channelCount = channels.size();
+    // Replace data in frame, only non-numeric channels allocate a string
     for (size_t g = 0; g < m_quickPlotFrame.groups.size(); ++g)
     {
       auto &group = m_quickPlotFrame.groups[g];
@@ -500,9 +687,8 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
         const int idx = dataset.index;
         if (idx > 0 && idx <= channelCount) [[likely]]
         {
-          QString &value = channelData[idx - 1];
-          dataset.value = std::move(value);
-          dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
+          const auto &token = m_quickPlotTokens[idx - 1];
+          assign_value(dataset, str + token.first, token.second);
         }
       }
     }
@@ -512,6 +698,90 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
   }
 }
 
+//------------------------------------------------------------------------------
+// JavaScript frame parser
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Ensures that the JavaScript frame parser can be called from the
+ *        current thread.
+ *
+ * The engine is created in the frame processing thread and rebuilt whenever
+ * the project's frame parser code changes. Script errors are only logged
+ * here, since the code editor already reports them to the user.
+ *
+ * @return @c true if the script declares a callable @c parse function.
+ */
+bool JSON::FrameBuilder::loadParserScript()
+{
+  // No code available
+  if (m_parserCode.isEmpty()) [[unlikely]]
+    return false;
+
+  // Engine is up to date
+  if (m_scriptEngine && !m_parserCodeChanged) [[likely]]
+    return m_parseFunction.isCallable();
+
+  // Create a new engine in this thread & release it when the thread finishes
+  releaseParserScript();
+  m_parserCodeChanged = false;
+  m_scriptEngine = new QJSEngine();
+  m_scriptEngine->installExtensions(QJSEngine::AllExtensions);
+  connect(QThread::currentThread(), &QThread::finished, this,
+          &JSON::FrameBuilder::releaseParserScript,
+          static_cast<Qt::ConnectionType>(Qt::DirectConnection
+                                          | Qt::UniqueConnection));
+
+  // Collect JS garbage at 1 Hz
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
+          m_scriptEngine, &QJSEngine::collectGarbage);
+
+  // Evaluate the code & obtain the parse function
+  const auto result = m_scriptEngine->evaluate(m_parserCode);
+  if (result.isError())
+    qWarning() << "Frame parser error:" << result.toString();
+
+  m_parseFunction = m_scriptEngine->globalObject().property("parse");
+  if (!m_parseFunction.isCallable())
+    qWarning() << "Frame parser error: 'parse' function is not callable";
+
+  return m_parseFunction.isCallable();
+}
+
+/**
+ * @brief Calls the JavaScript @c parse function with a decoded text frame.
+ *
+ * @param frame Decoded frame (UTF-8, hexadecimal or Base64 text).
+ * @return An array of strings returned by the JS parser.
+ */
+QStringList JSON::FrameBuilder::runParserScript(const QString &frame)
+{
+  QJSValueList args;
+  args << frame;
+
+  return m_parseFunction.call(args).toVariant().toStringList();
+}
+
+/**
+ * @brief Calls the JavaScript @c parse function with a binary frame, passed
+ *        to the script as an array of bytes.
+ *
+ * @param frame Binary frame data.
+ * @return An array of strings returned by the JS parser.
+ */
+QStringList JSON::FrameBuilder::runParserScript(const QByteArray &frame)
+{
+  QJSValue jsArray = m_scriptEngine->newArray(frame.size());
+  const auto *data = reinterpret_cast<const quint8 *>(frame.constData());
+  for (int i = 0; i < frame.size(); ++i)
+    jsArray.setProperty(i, data[i]);
+
+  QJSValueList args;
+  args << jsArray;
+
+  return m_parseFunction.call(args).toVariant().toStringList();
+}
+
 //------------------------------------------------------------------------------
 // Quick-plot project generation functions
 //------------------------------------------------------------------------------
@@ -521,7 +791,7 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
  *        current channel count.
  *
  * Constructs a new `JSON::Frame` and associated `JSON::Group`/`Dataset` layout
- * using the provided channel values. If the build is configured for commercial
+ * for the given number of channels. If the build is configured for commercial
  * use and the audio bus is active, the function includes additional metadata
  * required for FFT plotting (e.g., sample rate, min/max). Otherwise, it builds
  * a generic datagrid and multiplot view for standard Quick Plot channels.
@@ -529,15 +799,14 @@ void JSON::FrameBuilder::parseQuickPlotFrame(const QByteArray &data)
  * This function is only called when the number of input channels changes, not
  * on every data frame.
  *
- * @param channels List of channel values received in the most recent data
- *                 frame.
+ * @param channels Number of channels received in the most recent data frame.
  *
  * @note This function allocates and initializes all datasets and groups from
  *       scratch, which is expensive. It should be called only when the number
  *       of channels changes. Avoid calling this in the real-time path unless
  *       necessary.
  */
-void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
+void JSON::FrameBuilder::buildQuickPlotFrame(const int channels)
 {
   // Parse audio data
 #ifdef BUILD_COMMERCIAL
@@ -581,15 +850,14 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
     // Obtain microphone values for each channel
     int index = 1;
     std::vector<JSON::Dataset> datasets;
-    datasets.reserve(channels.count());
-    for (const auto &channel : std::as_const(channels))
+    datasets.reserve(channels);
+    for (int i = 0; i < channels; ++i)
     {
       JSON::Dataset dataset;
       dataset.fft = true;
       dataset.plt = true;
       dataset.groupId = 0;
       dataset.index = index;
-      dataset.value = channel;
       dataset.pltMax = maxValue;
       dataset.pltMin = minValue;
       dataset.fftMax = maxValue;
@@ -597,7 +865,6 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
       dataset.fftSamples = 2048;
       dataset.fftSamplingRate = sampleRate;
       dataset.title = tr("Channel %1").arg(index);
-      dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
       datasets.push_back(dataset);
 
       ++index;
@@ -625,16 +892,14 @@ void JSON::FrameBuilder::buildQuickPlotFrame(const QStringList &channels)
   // Create datasets from the data
   int idx = 1;
   std::vector<JSON::Dataset> datasets;
-  datasets.reserve(channels.count());
-  for (const auto &channel : std::as_const(channels))
+  datasets.reserve(channels);
+  for (int i = 0; i < channels; ++i)
   {
     JSON::Dataset dataset;
     dataset.groupId = 0;
     dataset.index = idx;
     dataset.plt = false;
-    dataset.value = channel;
     dataset.title = tr("Channel %1").arg(idx);
-    dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
     datasets.push_back(dataset);
 
     ++idx;
@@ -703,3 +968,30 @@ void JSON::FrameBuilder::hotpathTxFrame(const JSON::Frame &frame)
   csvExport.hotpathTxFrame(frame);
   pluginsServer.hotpathTxFrame(frame);
 }
+
+/**
+ * @brief Publishes a block of numeric samples to all registered output
+ *        modules.
+ *
+ * - The dashboard appends every row to its plots & FFT engines.
+ * - The CSV export queues the block once and writes one line per row.
+ * - The plugin server queues the block once and sends all of its rows.
+ *
+ * @param frame    Frame structure, with the values of the last row.
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows (frames) in the block.
+ * @param channels Number of values per row.
+ */
+void JSON::FrameBuilder::hotpathTxSamples(const JSON::Frame &frame,
+                                          const double *samples,
+                                          const qsizetype rows,
+                                          const int channels)
+{
+  static auto &csvExport = CSV::Export::instance();
+  static auto &dashboard = UI::Dashboard::instance();
+  static auto &pluginsServer = Plugins::Server::instance();
+
+  dashboard.hotpathRxSamples(frame, samples, rows, channels);
+  csvExport.hotpathTxSamples(frame, samples, rows, channels);
+  pluginsServer.hotpathTxSamples(frame, samples, rows, channels);
+}
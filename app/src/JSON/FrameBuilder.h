@@ -22,7 +22,10 @@
 #pragma once
 
 #include <QFile>
+#include <QMutex>
 #include <QObject>
+#include <QJSValue>
+#include <QJSEngine>
 #include <QSettings>
 #include <QJsonArray>
 #include <QJsonValue>
@@ -33,6 +36,7 @@
 
 #include "JSON/Frame.h"
 #include "JSON/FrameParser.h"
+#include "JSON/FieldDecoder.h"
 
 namespace JSON
 {
@@ -46,6 +50,11 @@ namespace JSON
  *
  * This frame is later shared with the rest of the modules, and is updated
  * automatically with new incoming raw data.
+ *
+ * Raw frames are received in the frame processing thread of the I/O manager.
+ * The frame lock serializes parsing with project changes made from the user
+ * interface, and the JavaScript frame parser is evaluated by an engine that
+ * lives in the processing thread, independently of the code editor.
  */
 class FrameBuilder : public QObject
 {
@@ -91,18 +100,30 @@ public slots:
   void setOperationMode(const SerialStudio::OperationMode mode);
 
   void hotpathRxFrame(const QByteArray &data);
+  void hotpathRxSamples(const double *samples, const qsizetype rows,
+                        const int channels);
 
 private slots:
+  void syncFrameParser();
   void onConnectedChanged();
+  void releaseParserScript();
 
 private:
+  void clearProjectFrame();
   void setJsonPathSetting(const QString &path);
 
+  bool loadParserScript();
+  QStringList runParserScript(const QString &frame);
+  QStringList runParserScript(const QByteArray &frame);
+
+  void parseFieldFrame(const QByteArray &data);
   void parseProjectFrame(const QByteArray &data);
   void parseQuickPlotFrame(const QByteArray &data);
-  void buildQuickPlotFrame(const QStringList &channels);
+  void buildQuickPlotFrame(const int channels);
 
   void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxSamples(const JSON::Frame &frame, const double *samples,
+                        const qsizetype rows, const int channels);
 
 private:
   QFile m_jsonMap;
@@ -115,8 +136,17 @@ private:
   QByteArray m_frameStart;
   QByteArray m_frameFinish;
 
+  QMutex m_frameLock;
+  QString m_parserCode;
+  bool m_parserCodeChanged;
+  QJSValue m_parseFunction;
+  QJSEngine *m_scriptEngine;
+  SerialStudio::DecoderMethod m_decoderMethod;
+
   QSettings m_settings;
   int m_quickPlotChannels;
+  std::vector<std::pair<qsizetype, qsizetype>> m_quickPlotTokens;
+  JSON::FieldDecoder m_fieldDecoder;
   JSON::FrameParser *m_frameParser;
   SerialStudio::OperationMode m_opMode;
 };
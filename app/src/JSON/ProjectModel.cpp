@@ -81,7 +81,12 @@ typedef enum
   kProjectView_FrameDecoder,        /**< Represents the frame decoder item */
   kProjectView_HexadecimalSequence, /**< Represents the frame sequence format */
   kProjectView_FrameDetection,      /**< Represents the frame detection item */
-  kProjectView_ChecksumFunction     /**< Represents the frame checksum item */
+  kProjectView_ChecksumFunction,    /**< Represents the frame checksum item */
+  kProjectView_FixedFrameLength,    /**< Represents the fixed frame size */
+  kProjectView_LengthFieldSize,     /**< Represents the length field width */
+  kProjectView_LengthFieldOffset,   /**< Represents the length field offset */
+  kProjectView_LengthFieldEndian,   /**< Represents the length byte order */
+  kProjectView_LengthIncludesHeader /**< Represents the length field coverage */
 } ProjectItem;
 // clang-format on
 
@@ -110,6 +115,9 @@ typedef enum
   kDatasetView_FFT_Samples,      /**< FFT window size item. */
   kDatasetView_AlarmEnabled,     /**< Alarm enabled status item. */
   kDatasetView_FFT_SamplingRate, /**< FFT sampling rate item. */
+  kDatasetView_FFT_Overlap,      /**< FFT window overlap item. */
+  kDatasetView_FFT_Averages,     /**< FFT averaged windows item. */
+  kDatasetView_Waterfall,        /**< FFT waterfall checkbox item. */
   kDatasetView_xAxis,            /**< Plot X axis item. */
   kDatasetView_Overview          /**< Display in Overview workspace. */
 } DatasetItem;
@@ -166,6 +174,11 @@ JSON::ProjectModel::ProjectModel()
   , m_currentView(ProjectView)
   , m_frameDecoder(SerialStudio::PlainText)
   , m_frameDetection(SerialStudio::EndDelimiterOnly)
+  , m_fixedFrameLength(0)
+  , m_lengthFieldSize(1)
+  , m_lengthFieldOffset(0)
+  , m_lengthFieldBigEndian(true)
+  , m_lengthIncludesHeader(false)
   , m_modified(false)
   , m_filePath("")
   , m_treeModel(nullptr)
@@ -280,6 +293,50 @@ SerialStudio::FrameDetection JSON::ProjectModel::frameDetection() const
   return m_frameDetection;
 }
 
+/**
+ * @brief Returns the number of payload bytes in each frame when using the
+ *        fixed-length frame detection method.
+ */
+int JSON::ProjectModel::fixedFrameLength() const
+{
+  return m_fixedFrameLength;
+}
+
+/**
+ * @brief Returns the width (in bytes) of the length field used by
+ *        length-prefixed frames.
+ */
+int JSON::ProjectModel::lengthFieldSize() const
+{
+  return m_lengthFieldSize;
+}
+
+/**
+ * @brief Returns the number of bytes between the end of the start sequence
+ *        and the length field of length-prefixed frames.
+ */
+int JSON::ProjectModel::lengthFieldOffset() const
+{
+  return m_lengthFieldOffset;
+}
+
+/**
+ * @brief Returns @c true if the length field is stored in big-endian order.
+ */
+bool JSON::ProjectModel::lengthFieldBigEndian() const
+{
+  return m_lengthFieldBigEndian;
+}
+
+/**
+ * @brief Returns @c true if the length field value counts the frame header
+ *        (start sequence, offset bytes & length field) besides the payload.
+ */
+bool JSON::ProjectModel::lengthIncludesHeader() const
+{
+  return m_lengthIncludesHeader;
+}
+
 //------------------------------------------------------------------------------
 // Document information functions
 //------------------------------------------------------------------------------
@@ -856,6 +913,12 @@ void JSON::ProjectModel::newJsonFile()
   // Reset project properties
   m_frameDecoder = SerialStudio::PlainText;
   m_frameDetection = SerialStudio::EndDelimiterOnly;
+  m_fixedFrameLength = 0;
+  m_lengthFieldSize = 1;
+  m_lengthFieldOffset = 0;
+  m_lengthFieldBigEndian = true;
+  m_lengthIncludesHeader = false;
+  m_nativeParser = QJsonObject();
   m_frameEndSequence = "\\n";
   m_checksumAlgorithm = "";
   m_frameStartSequence = "$";
@@ -969,6 +1032,13 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   m_frameDetection = static_cast<SerialStudio::FrameDetection>(
       json.value("frameDetection").toInt());
 
+  m_fixedFrameLength = json.value("fixedFrameLength").toInt(0);
+  m_lengthFieldSize = json.value("lengthFieldSize").toInt(1);
+  m_lengthFieldOffset = json.value("lengthFieldOffset").toInt(0);
+  m_lengthFieldBigEndian = json.value("lengthFieldBigEndian").toBool(true);
+  m_lengthIncludesHeader = json.value("lengthIncludesHeader").toBool(false);
+  m_nativeParser = json.value("nativeParser").toObject();
+
   // Preserve compatibility with previous projects
   if (!json.contains("frameDetection"))
     m_frameDetection = SerialStudio::StartAndEndDelimiter;
@@ -2281,7 +2351,8 @@ void JSON::ProjectModel::buildProjectModel()
 
   // Add hexadecimal frame sequence
   auto *sequence = new QStandardItem();
-  sequence->setEditable(m_frameDetection != SerialStudio::NoDelimiters);
+  sequence->setEditable(m_frameDetection != SerialStudio::NoDelimiters
+                        && m_frameDetection != SerialStudio::FixedLength);
   sequence->setData(sequence->isEditable(), Active);
   sequence->setData(CheckBox, WidgetType);
   sequence->setData(m_hexadecimalDelimiters, EditableValue);
@@ -2296,9 +2367,10 @@ void JSON::ProjectModel::buildProjectModel()
 
   // Add frame start sequence
   auto *frameStart = new QStandardItem();
-  frameStart->setEditable(m_frameDetection == SerialStudio::StartAndEndDelimiter
-                          || m_frameDetection
-                                 == SerialStudio::StartDelimiterOnly);
+  frameStart->setEditable(
+      m_frameDetection == SerialStudio::StartAndEndDelimiter
+      || m_frameDetection == SerialStudio::StartDelimiterOnly
+      || m_frameDetection == SerialStudio::StartAndLengthField);
   frameStart->setData(frameStart->isEditable(), Active);
   frameStart->setData(delimWidget, WidgetType);
   frameStart->setData(m_frameStartSequence, EditableValue);
@@ -2323,6 +2395,76 @@ void JSON::ProjectModel::buildProjectModel()
                     ParameterDescription);
   m_projectModel->appendRow(frameEnd);
 
+  // Add length field layout
+  if (m_frameDetection == SerialStudio::StartAndLengthField)
+  {
+    auto *lengthSize = new QStandardItem();
+    lengthSize->setEditable(true);
+    lengthSize->setData(true, Active);
+    lengthSize->setData(ComboBox, WidgetType);
+    lengthSize->setData(m_lengthFieldSizes, ComboBoxData);
+    lengthSize->setData(m_lengthFieldSize == 4 ? 2 : m_lengthFieldSize - 1,
+                        EditableValue);
+    lengthSize->setData(tr("Length Field Size"), ParameterName);
+    lengthSize->setData(kProjectView_LengthFieldSize, ParameterType);
+    lengthSize->setData(tr("Number of bytes used to encode the frame length"),
+                        ParameterDescription);
+    m_projectModel->appendRow(lengthSize);
+
+    auto *lengthOffset = new QStandardItem();
+    lengthOffset->setEditable(true);
+    lengthOffset->setData(true, Active);
+    lengthOffset->setData(IntField, WidgetType);
+    lengthOffset->setData(m_lengthFieldOffset, EditableValue);
+    lengthOffset->setData(tr("Length Field Offset"), ParameterName);
+    lengthOffset->setData(kProjectView_LengthFieldOffset, ParameterType);
+    lengthOffset->setData(QStringLiteral("0"), PlaceholderValue);
+    lengthOffset->setData(
+        tr("Bytes between the start sequence and the length field"),
+        ParameterDescription);
+    m_projectModel->appendRow(lengthOffset);
+
+    auto *lengthEndian = new QStandardItem();
+    lengthEndian->setEditable(true);
+    lengthEndian->setData(true, Active);
+    lengthEndian->setData(ComboBox, WidgetType);
+    lengthEndian->setData(m_byteOrderOptions, ComboBoxData);
+    lengthEndian->setData(m_lengthFieldBigEndian ? 0 : 1, EditableValue);
+    lengthEndian->setData(tr("Length Byte Order"), ParameterName);
+    lengthEndian->setData(kProjectView_LengthFieldEndian, ParameterType);
+    lengthEndian->setData(tr("Byte order of the length field"),
+                          ParameterDescription);
+    m_projectModel->appendRow(lengthEndian);
+
+    auto *lengthHeader = new QStandardItem();
+    lengthHeader->setEditable(true);
+    lengthHeader->setData(true, Active);
+    lengthHeader->setData(CheckBox, WidgetType);
+    lengthHeader->setData(m_lengthIncludesHeader, EditableValue);
+    lengthHeader->setData(tr("Length Includes Header"), ParameterName);
+    lengthHeader->setData(kProjectView_LengthIncludesHeader, ParameterType);
+    lengthHeader->setData(
+        tr("Length counts the header bytes in addition to the payload"),
+        ParameterDescription);
+    m_projectModel->appendRow(lengthHeader);
+  }
+
+  // Add fixed frame length
+  else if (m_frameDetection == SerialStudio::FixedLength)
+  {
+    auto *frameLength = new QStandardItem();
+    frameLength->setEditable(true);
+    frameLength->setData(true, Active);
+    frameLength->setData(IntField, WidgetType);
+    frameLength->setData(m_fixedFrameLength, EditableValue);
+    frameLength->setData(tr("Frame Length"), ParameterName);
+    frameLength->setData(kProjectView_FixedFrameLength, ParameterType);
+    frameLength->setData(QStringLiteral("16"), PlaceholderValue);
+    frameLength->setData(tr("Number of bytes in each frame (excl. checksum)"),
+                         ParameterDescription);
+    m_projectModel->appendRow(frameLength);
+  }
+
   //----------------------------------------------------------------------------
   // Data conversion & integrity checks
   //----------------------------------------------------------------------------
@@ -2903,6 +3045,22 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
                ParameterDescription);
   m_datasetModel->appendRow(fft);
 
+  // Add waterfall checkbox
+  auto waterfall = new QStandardItem();
+  waterfall->setEditable(true);
+  waterfall->setData(0, PlaceholderValue);
+  waterfall->setData(CheckBox, WidgetType);
+  waterfall->setData(waterfall->isEditable(), Active);
+  waterfall->setData(dataset.waterfall, EditableValue);
+  waterfall->setData(kDatasetView_Waterfall, ParameterType);
+  waterfall->setData(tr("Show Waterfall"), ParameterName);
+  waterfall->setData(tr("Display the spectrum history as a spectrogram"),
+                     ParameterDescription);
+  m_datasetModel->appendRow(waterfall);
+
+  // FFT settings are shared by the FFT plot & the waterfall
+  const bool spectral = dataset.fft || dataset.waterfall;
+
   // Get FFT window size index
   const auto windowSize = QString::number(dataset.fftSamples);
   int windowIndex = m_fftSamples.indexOf(windowSize);
@@ -2911,7 +3069,7 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 
   // Add FFT window size
   auto fftWindow = new QStandardItem();
-  fftWindow->setEditable(dataset.fft);
+  fftWindow->setEditable(spectral);
   fftWindow->setData(ComboBox, WidgetType);
   fftWindow->setData(m_fftSamples, ComboBoxData);
   fftWindow->setData(windowIndex, EditableValue);
@@ -2925,7 +3083,7 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 
   // Add FFT sampling rate
   auto fftSamplingRate = new QStandardItem();
-  fftSamplingRate->setEditable(dataset.fft);
+  fftSamplingRate->setEditable(spectral);
   fftSamplingRate->setData(IntField, WidgetType);
   fftSamplingRate->setData(100, PlaceholderValue);
   fftSamplingRate->setData(fftSamplingRate->isEditable(), Active);
@@ -2937,9 +3095,37 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
                            ParameterDescription);
   m_datasetModel->appendRow(fftSamplingRate);
 
+  // Add FFT window overlap
+  auto fftOverlap = new QStandardItem();
+  fftOverlap->setEditable(spectral);
+  fftOverlap->setData(IntField, WidgetType);
+  fftOverlap->setData(50, PlaceholderValue);
+  fftOverlap->setData(fftOverlap->isEditable(), Active);
+  fftOverlap->setData(dataset.fftOverlap, EditableValue);
+  fftOverlap->setData(kDatasetView_FFT_Overlap, ParameterType);
+  fftOverlap->setData(tr("FFT Window Overlap (%)"), ParameterName);
+  fftOverlap->setData(
+      tr("Percentage of samples shared by consecutive FFT windows"),
+      ParameterDescription);
+  m_datasetModel->appendRow(fftOverlap);
+
+  // Add FFT averaged windows
+  auto fftAverages = new QStandardItem();
+  fftAverages->setEditable(spectral);
+  fftAverages->setData(IntField, WidgetType);
+  fftAverages->setData(1, PlaceholderValue);
+  fftAverages->setData(fftAverages->isEditable(), Active);
+  fftAverages->setData(dataset.fftAverages, EditableValue);
+  fftAverages->setData(kDatasetView_FFT_Averages, ParameterType);
+  fftAverages->setData(tr("FFT Averaging"), ParameterName);
+  fftAverages->setData(
+      tr("Number of FFT windows averaged to reduce noise (Welch method)"),
+      ParameterDescription);
+  m_datasetModel->appendRow(fftAverages);
+
   // Add minimum value
   auto fftMin = new QStandardItem();
-  fftMin->setEditable(dataset.fft);
+  fftMin->setEditable(spectral);
   fftMin->setData(0, PlaceholderValue);
   fftMin->setData(FloatField, WidgetType);
   fftMin->setData(fftMin->isEditable(), Active);
@@ -2952,7 +3138,7 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
 
   // Add maximum value
   auto fftMax = new QStandardItem();
-  fftMax->setEditable(dataset.fft);
+  fftMax->setEditable(spectral);
   fftMax->setData(0, PlaceholderValue);
   fftMax->setData(FloatField, WidgetType);
   fftMax->setData(fftMax->isEditable(), Active);
@@ -3228,10 +3414,23 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_frameDetectionMethods.append(tr("Start Delimiter Only"));
   m_frameDetectionMethods.append(tr("Start + End Delimiter"));
   m_frameDetectionMethods.append(tr("No Delimiters"));
+  m_frameDetectionMethods.append(tr("Start Delimiter + Length Field"));
+  m_frameDetectionMethods.append(tr("Fixed Frame Length"));
   m_frameDetectionMethodsValues.append(SerialStudio::EndDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartAndEndDelimiter);
   m_frameDetectionMethodsValues.append(SerialStudio::NoDelimiters);
+  m_frameDetectionMethodsValues.append(SerialStudio::StartAndLengthField);
+  m_frameDetectionMethodsValues.append(SerialStudio::FixedLength);
+
+  // Initialize length field options
+  m_lengthFieldSizes.clear();
+  m_lengthFieldSizes.append(tr("1 Byte"));
+  m_lengthFieldSizes.append(tr("2 Bytes"));
+  m_lengthFieldSizes.append(tr("4 Bytes"));
+  m_byteOrderOptions.clear();
+  m_byteOrderOptions.append(tr("Big Endian (MSB First)"));
+  m_byteOrderOptions.append(tr("Little Endian (LSB First)"));
 
   // Initialize group-level widgets
   m_groupWidgets.clear();
@@ -3535,6 +3734,7 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
       break;
     case kProjectView_FrameDecoder:
       m_frameDecoder = static_cast<SerialStudio::DecoderMethod>(value.toInt());
+      Q_EMIT decoderMethodChanged();
       break;
     case kProjectView_ChecksumFunction:
       m_checksumAlgorithm = IO::availableChecksums()[value.toInt()];
@@ -3562,6 +3762,21 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
       Q_EMIT frameDetectionChanged();
       buildProjectModel();
       break;
+    case kProjectView_FixedFrameLength:
+      m_fixedFrameLength = qMax(0, value.toInt());
+      break;
+    case kProjectView_LengthFieldSize:
+      m_lengthFieldSize = value.toInt() == 2 ? 4 : value.toInt() + 1;
+      break;
+    case kProjectView_LengthFieldOffset:
+      m_lengthFieldOffset = qMax(0, value.toInt());
+      break;
+    case kProjectView_LengthFieldEndian:
+      m_lengthFieldBigEndian = value.toInt() == 0;
+      break;
+    case kProjectView_LengthIncludesHeader:
+      m_lengthIncludesHeader = value.toBool();
+      break;
     default:
       break;
   }
@@ -3635,6 +3850,10 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
       m_selectedDataset.fft = value.toBool();
       buildDatasetModel(m_selectedDataset);
       break;
+    case kDatasetView_Waterfall:
+      m_selectedDataset.waterfall = value.toBool();
+      buildDatasetModel(m_selectedDataset);
+      break;
     case kDatasetView_LED:
       m_selectedDataset.led = value.toBool();
       buildDatasetModel(m_selectedDataset);
@@ -3687,6 +3906,12 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
     case kDatasetView_FFT_SamplingRate:
       m_selectedDataset.fftSamplingRate = value.toInt();
       break;
+    case kDatasetView_FFT_Overlap:
+      m_selectedDataset.fftOverlap = qBound(0, value.toInt(), 95);
+      break;
+    case kDatasetView_FFT_Averages:
+      m_selectedDataset.fftAverages = qBound(1, value.toInt(), 64);
+      break;
     default:
       break;
   }
@@ -3846,6 +4071,21 @@ bool JSON::ProjectModel::finalizeProjectSave()
   json.insert("frameStart", m_frameStartSequence);
   json.insert("hexadecimalDelimiters", m_hexadecimalDelimiters);
 
+  // Add binary frame layout (only relevant for their detection methods)
+  if (m_frameDetection == SerialStudio::FixedLength)
+    json.insert("fixedFrameLength", m_fixedFrameLength);
+  else if (m_frameDetection == SerialStudio::StartAndLengthField)
+  {
+    json.insert("lengthFieldSize", m_lengthFieldSize);
+    json.insert("lengthFieldOffset", m_lengthFieldOffset);
+    json.insert("lengthFieldBigEndian", m_lengthFieldBigEndian);
+    json.insert("lengthIncludesHeader", m_lengthIncludesHeader);
+  }
+
+  // Add native field decoder definition (edited directly in the project file)
+  if (!m_nativeParser.isEmpty())
+    json.insert("nativeParser", m_nativeParser);
+
   // Create group array
   QJsonArray groupArray;
   for (const auto &group : std::as_const(m_groups))
@@ -132,6 +132,7 @@ class ProjectModel : public QObject
 signals:
   void titleChanged();
   void jsonFileChanged();
+  void decoderMethodChanged();
   void modifiedChanged();
   void treeModelChanged();
   void groupModelChanged();
@@ -215,6 +216,12 @@ public:
   [[nodiscard]] SerialStudio::DecoderMethod decoderMethod() const;
   [[nodiscard]] SerialStudio::FrameDetection frameDetection() const;
 
+  [[nodiscard]] int fixedFrameLength() const;
+  [[nodiscard]] int lengthFieldSize() const;
+  [[nodiscard]] int lengthFieldOffset() const;
+  [[nodiscard]] bool lengthFieldBigEndian() const;
+  [[nodiscard]] bool lengthIncludesHeader() const;
+
   [[nodiscard]] QString jsonFileName() const;
   [[nodiscard]] QString jsonProjectsPath() const;
 
@@ -319,6 +326,14 @@ private:
   SerialStudio::DecoderMethod m_frameDecoder;
   SerialStudio::FrameDetection m_frameDetection;
 
+  int m_fixedFrameLength;
+  int m_lengthFieldSize;
+  int m_lengthFieldOffset;
+  bool m_lengthFieldBigEndian;
+  bool m_lengthIncludesHeader;
+
+  QJsonObject m_nativeParser;
+
   bool m_modified;
   QString m_filePath;
 
@@ -342,6 +357,8 @@ private:
   QStringList m_timerModes;
   QStringList m_decoderOptions;
   QStringList m_checksumMethods;
+  QStringList m_byteOrderOptions;
+  QStringList m_lengthFieldSizes;
   QStringList m_frameDetectionMethods;
   QList<SerialStudio::FrameDetection> m_frameDetectionMethodsValues;
 
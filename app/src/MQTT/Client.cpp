@@ -20,6 +20,7 @@
  */
 
 #include <QFile>
+#include <QThread>
 #include <QFileDialog>
 #include <QInputDialog>
 
@@ -754,9 +755,25 @@ void MQTT::Client::setPeerVerifyMode(const quint8 verifyMode)
 
 /**
  * @brief Publishes a message to the broker if connected and in publisher mode.
+ *
+ * Frames received from the frame processing thread are copied and published
+ * from the thread that owns the MQTT client.
  */
 void MQTT::Client::hotpathTxFrame(const QByteArray &data)
 {
+  if (thread() != QThread::currentThread())
+  {
+    if (isConnected() && isPublisher())
+    {
+      const QByteArray frame(data.constData(), data.size());
+      QMetaObject::invokeMethod(
+          this, [this, frame] { hotpathTxFrame(frame); },
+          Qt::QueuedConnection);
+    }
+
+    return;
+  }
+
   if (isConnected() && isPublisher() && m_topicName.isValid()
       && SerialStudio::activated())
     m_client.publish(m_topicName, data);
@@ -70,6 +70,7 @@
 #include "UI/Widgets/Terminal.h"
 #include "UI/Widgets/Gyroscope.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Waterfall.h"
 #include "UI/Widgets/Accelerometer.h"
 
 #ifdef BUILD_COMMERCIAL
@@ -261,6 +262,7 @@ void Misc::ModuleManager::registerQmlTypes()
   qmlRegisterType<Widgets::Terminal>("SerialStudio", 1, 0, "TerminalWidget");
   qmlRegisterType<Widgets::MultiPlot>("SerialStudio", 1, 0, "MultiPlotModel");
   qmlRegisterType<Widgets::Gyroscope>("SerialStudio", 1, 0, "GyroscopeModel");
+  qmlRegisterType<Widgets::Waterfall>("SerialStudio", 1, 0, "WaterfallWidget");
   qmlRegisterType<Widgets::Accelerometer>("SerialStudio", 1, 0,
                                           "AccelerometerModel");
 
@@ -147,6 +147,11 @@ void Plugins::Server::setEnabled(const bool enabled)
     while (m_pendingFrames.try_dequeue(frame))
     {
     }
+
+    SampleBlock block;
+    while (m_pendingSamples.try_dequeue(block))
+    {
+    }
   }
 }
 
@@ -201,6 +206,27 @@ void Plugins::Server::hotpathTxFrame(const JSON::Frame &frame)
     m_pendingFrames.enqueue(frame);
 }
 
+/**
+ * @brief Registers a block of numeric samples.
+ *
+ * The whole block is queued, so that plugins receive every row and not only
+ * the latest one. Blocks are dropped if the queue is full (i.e. while no
+ * plugin is connected).
+ *
+ * @param frame    Frame structure, with the values of the last row.
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows in the block.
+ * @param channels Number of values per row.
+ */
+void Plugins::Server::hotpathTxSamples(const JSON::Frame &frame,
+                                       const double *samples,
+                                       const qsizetype rows, const int channels)
+{
+  if (enabled() && rows > 0 && channels > 0)
+    (void)m_pendingSamples.try_enqueue(
+        SampleBlock(frame, samples, rows, channels));
+}
+
 /**
  * @brief Handles incoming data from a client socket.
  *
@@ -271,6 +297,11 @@ void Plugins::Server::acceptConnection()
  *
  * Frames are serialized into a compact JSON array and sent to each
  * writable socket. Called periodically (1 Hz) via timer events.
+ *
+ * Only the latest frame is sent, while sample blocks are sent as a whole:
+ * each block is an entry with the frame structure in @c data and all its
+ * rows in @c rows, where value @c N of a row belongs to the dataset with
+ * index @c N+1.
  */
 void Plugins::Server::sendProcessedData()
 {
@@ -294,6 +325,28 @@ void Plugins::Server::sendProcessedData()
     array.append(object);
   }
 
+  // Add every row of the pending sample blocks
+  SampleBlock block;
+  while (m_pendingSamples.try_dequeue(block))
+  {
+    QJsonArray rows;
+    const auto count = block.samples.size() / block.channels;
+    for (std::size_t r = 0; r < count; ++r)
+    {
+      QJsonArray row;
+      const double *values = block.samples.data() + r * block.channels;
+      for (int c = 0; c < block.channels; ++c)
+        row.append(values[c]);
+
+      rows.append(row);
+    }
+
+    QJsonObject object;
+    object.insert(QStringLiteral("data"), serialize(block.frame));
+    object.insert(QStringLiteral("rows"), rows);
+    array.append(object);
+  }
+
   // Create JSON document with frame arrays
   if (array.count() > 0)
   {
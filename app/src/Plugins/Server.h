@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QObject>
 #include <QTcpSocket>
 #include <QTcpServer>
@@ -38,6 +40,33 @@
 
 namespace Plugins
 {
+/**
+ * @brief Block of numeric samples pending to be sent to plugins.
+ *
+ * Move-only, so that blocks can be handed over through concurrent queues
+ * without copying the samples.
+ */
+struct SampleBlock
+{
+  JSON::Frame frame;           ///< Frame structure, with the last row.
+  int channels = 0;            ///< Values per row of @c samples.
+  std::vector<double> samples; ///< Interleaved sample rows.
+
+  SampleBlock() {}
+  SampleBlock(const JSON::Frame &f, const double *s, const qsizetype rows,
+              const int c)
+    : frame(f)
+    , channels(c)
+    , samples(s, s + rows * c)
+  {
+  }
+
+  SampleBlock(SampleBlock &&) = default;
+  SampleBlock(const SampleBlock &) = delete;
+  SampleBlock &operator=(SampleBlock &&) = default;
+  SampleBlock &operator=(const SampleBlock &) = delete;
+};
+
 /**
  * @class Plugins::Server
  * @brief TCP server interface for plugin communication in Serial Studio.
@@ -48,6 +77,8 @@ namespace Plugins
  *
  * Connected plugins can:
  * - Receive real-time JSON data frames processed by Serial Studio.
+ * - Receive every row of numeric sample blocks (e.g. audio in Quick Plot
+ *   mode) as a @c rows array next to the frame.
  * - Transmit raw data directly to the underlying I/O device via the TCP socket.
  *
  * This design enables companion applications to be written in any language or
@@ -89,6 +120,8 @@ public slots:
   void setEnabled(const bool enabled);
   void hotpathTxData(const QByteArray &data);
   void hotpathTxFrame(const JSON::Frame &frame);
+  void hotpathTxSamples(const JSON::Frame &frame, const double *samples,
+                        const qsizetype rows, const int channels);
 
 private slots:
   void onDataReceived();
@@ -101,5 +134,6 @@ private:
   QTcpServer m_server;
   QVector<QTcpSocket *> m_sockets;
   moodycamel::ReaderWriterQueue<JSON::Frame> m_pendingFrames{2048};
+  moodycamel::ReaderWriterQueue<SampleBlock> m_pendingSamples{1024};
 };
 } // namespace Plugins
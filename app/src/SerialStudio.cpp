@@ -144,6 +144,7 @@ bool SerialStudio::isDatasetWidget(const DashboardWidget widget)
   switch (widget)
   {
     case DashboardFFT:
+    case DashboardWaterfall:
     case DashboardPlot:
     case DashboardBar:
     case DashboardGauge:
@@ -187,6 +188,9 @@ QString SerialStudio::dashboardWidgetIcon(const DashboardWidget w,
     case DashboardFFT:
       return iconPath + "fft.svg";
       break;
+    case DashboardWaterfall:
+      return iconPath + "fft.svg";
+      break;
     case DashboardLED:
       return iconPath + "led.svg";
       break;
@@ -244,6 +248,9 @@ QString SerialStudio::dashboardWidgetTitle(const DashboardWidget w)
     case DashboardFFT:
       return tr("FFT Plots");
       break;
+    case DashboardWaterfall:
+      return tr("Waterfalls");
+      break;
     case DashboardLED:
       return tr("LED Panels");
       break;
@@ -337,6 +344,9 @@ SerialStudio::getDashboardWidgets(const JSON::Dataset &dataset)
   if (dataset.fft)
     list.append(DashboardFFT);
 
+  if (dataset.waterfall)
+    list.append(DashboardWaterfall);
+
   if (dataset.led)
     list.append(DashboardLED);
 
@@ -103,7 +103,9 @@ public:
     EndDelimiterOnly     = 0x00, /**< Detects frames based only on an end delimiter. */
     StartAndEndDelimiter = 0x01, /**< Detects frames based on both start and end delimiters. */
     NoDelimiters         = 0x02, /**< Disables frame detection and processes incoming data directly */
-    StartDelimiterOnly   = 0x03  /**< Detects frames with only a header */
+    StartDelimiterOnly   = 0x03, /**< Detects frames with only a header */
+    StartAndLengthField  = 0x04, /**< Detects frames using a header followed by a length field */
+    FixedLength          = 0x05  /**< Splits the stream into frames of a fixed size */
     /* IMPORTANT: When adding other modes, please don't modify the order of the
      *            enums to ensure backward compatiblity with previous project
      *            files!! */
@@ -194,6 +196,7 @@ public:
     DashboardGPS,
     DashboardPlot3D,
     DashboardFFT,
+    DashboardWaterfall,
     DashboardLED,
     DashboardPlot,
     DashboardBar,
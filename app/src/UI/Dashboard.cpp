@@ -44,12 +44,14 @@
 UI::Dashboard::Dashboard()
   : m_points(100)
   , m_widgetCount(0)
-  , m_updateRequired(false)
   , m_showActionPanel(true)
   , m_terminalEnabled(false)
   , m_showTaskbarButtons(false)
-  , m_pltXAxis(100)
-  , m_multipltXAxis(100)
+  , m_streamActive(false)
+  , m_rebuildPending(false)
+  , m_updateRequired(false)
+  , m_samplesAxis(100)
+  , m_generation(1)
 {
   // clang-format off
   connect(&CSV::Player::instance(), &CSV::Player::openChanged, this, [=, this] { resetData(true); });
@@ -71,12 +73,12 @@ UI::Dashboard::Dashboard()
           });
 #endif
 
-  // Update the dashboard widgets at 24 Hz
+  // Publish a consistent snapshot to the dashboard widgets at 24 Hz
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::uiTimeout, this,
           [=, this] {
-            if (m_updateRequired)
+            if (m_updateRequired.exchange(false))
             {
-              m_updateRequired = false;
+              QMutexLocker locker(&m_dataLock);
               Q_EMIT updated();
             }
           });
@@ -312,6 +314,44 @@ int UI::Dashboard::totalWidgetCount() const
   return m_widgetCount;
 }
 
+/**
+ * @brief Returns the generation in which the data displayed by a widget last
+ *        changed.
+ *
+ * Widgets store the value returned by this function after processing their
+ * data, and skip their update while it stays the same. If the widget is not
+ * registered, the current generation is returned, so that callers always
+ * refresh.
+ *
+ * @param widget The type of the widget.
+ * @param index The index of the widget within its type.
+ */
+quint64
+UI::Dashboard::widgetGeneration(const SerialStudio::DashboardWidget widget,
+                                const int index) const
+{
+  QMutexLocker locker(&m_dataLock);
+  const auto it = m_generationOffsets.constFind(widget);
+  if (it == m_generationOffsets.cend() || index < 0
+      || index >= widgetCount(widget))
+    return m_generation;
+
+  return m_widgetGenerations[*it + index];
+}
+
+/**
+ * @brief Returns the lock that guards the dataset values & series data.
+ *
+ * The processing thread updates the series while holding this lock. Widgets
+ * must hold it while reading the references returned by gpsSeries(),
+ * plotData(), multiplotData() and plotData3D(), unless they are called from
+ * a slot connected to updated(), which is emitted with the lock held.
+ */
+QRecursiveMutex &UI::Dashboard::dataLock() const
+{
+  return m_dataLock;
+}
+
 //------------------------------------------------------------------------------
 // QML-callable status functions
 //------------------------------------------------------------------------------
@@ -607,19 +647,45 @@ const JSON::Frame &UI::Dashboard::processedFrame()
 //------------------------------------------------------------------------------
 
 /**
- * @brief Returns the FFT plot data currently displayed on the dashboard.
+ * @brief Returns the spectrum analyzer of an FFT plot.
+ *
+ * The engine is shared, so it stays valid for the caller even if the
+ * dashboard is reconfigured by the frame processing thread.
  *
  * @param index The widget index for the FFT plot.
- * @return Reference to the corresponding AxisData buffer.
+ * @return The FFT engine, or @c nullptr if it has not been created yet.
  */
-const DSP::AxisData &UI::Dashboard::fftData(const int index) const
+std::shared_ptr<const DSP::FFTEngine>
+UI::Dashboard::fftEngine(const int index) const
 {
-  return m_fftValues[index];
+  QMutexLocker locker(&m_dataLock);
+  if (index < 0 || index >= m_fftEngines.size())
+    return nullptr;
+
+  return m_fftEngines[index];
+}
+
+/**
+ * @brief Returns the spectrum analyzer of a waterfall widget.
+ *
+ * @param index The widget index for the waterfall.
+ * @return The FFT engine, or @c nullptr if it has not been created yet.
+ */
+std::shared_ptr<const DSP::FFTEngine>
+UI::Dashboard::waterfallEngine(const int index) const
+{
+  QMutexLocker locker(&m_dataLock);
+  if (index < 0 || index >= m_waterfallEngines.size())
+    return nullptr;
+
+  return m_waterfallEngines[index];
 }
 
 /**
  * @brief Returns the GPS trajectory data currently tracked by the dashboard.
  *
+ * The caller must hold dataLock() while using the returned reference.
+ *
  * @param index The widget index for the GPS display.
  * @return Reference to the corresponding GpsSeries structure.
  */
@@ -631,6 +697,8 @@ const DSP::GpsSeries &UI::Dashboard::gpsSeries(const int index) const
 /**
  * @brief Returns the Y-axis values for a linear plot widget.
  *
+ * The caller must hold dataLock() while using the returned reference.
+ *
  * @param index The widget index for the linear plot.
  * @return Reference to the corresponding LineSeries buffer.
  */
@@ -642,6 +710,8 @@ const DSP::LineSeries &UI::Dashboard::plotData(const int index) const
 /**
  * @brief Returns the series data used by a multiplot widget.
  *
+ * The caller must hold dataLock() while using the returned reference.
+ *
  * @param index The widget index for the multiplot.
  * @return Reference to the corresponding MultiLineSeries container.
  */
@@ -654,6 +724,8 @@ const DSP::MultiLineSeries &UI::Dashboard::multiplotData(const int index) const
 /**
  * @brief Returns the 3D trajectory data for a 3D plot widget.
  *
+ * The caller must hold dataLock() while using the returned reference.
+ *
  * @param index The widget index for the 3D plot.
  * @return Reference to the corresponding LineSeries3D buffer.
  */
@@ -674,12 +746,10 @@ const DSP::LineSeries3D &UI::Dashboard::plotData3D(const int index) const
  * @return @c true if the plot is running, otherwise @c false.
  *         Returns @c false if the index is not registered.
  */
-bool UI::Dashboard::plotRunning(const int index)
+bool UI::Dashboard::plotRunning(const int index) const
 {
-  if (m_activePlots.contains(index))
-    return m_activePlots[index];
-
-  return false;
+  QMutexLocker locker(&m_dataLock);
+  return m_activePlots.value(index, false);
 }
 
 /**
@@ -689,12 +759,10 @@ bool UI::Dashboard::plotRunning(const int index)
  * @return @c true if the FFT plot is running, otherwise @c false.
  *         Returns @c false if the index is not registered.
  */
-bool UI::Dashboard::fftPlotRunning(const int index)
+bool UI::Dashboard::fftPlotRunning(const int index) const
 {
-  if (m_activeFFTPlots.contains(index))
-    return m_activeFFTPlots[index];
-
-  return false;
+  QMutexLocker locker(&m_dataLock);
+  return m_activeFFTPlots.value(index, false);
 }
 
 /**
@@ -704,12 +772,10 @@ bool UI::Dashboard::fftPlotRunning(const int index)
  * @return @c true if the multiplot is running, otherwise @c false.
  *         Returns @c false if the index is not registered.
  */
-bool UI::Dashboard::multiplotRunning(const int index)
+bool UI::Dashboard::multiplotRunning(const int index) const
 {
-  if (m_activeMultiplots.contains(index))
-    return m_activeMultiplots[index];
-
-  return false;
+  QMutexLocker locker(&m_dataLock);
+  return m_activeMultiplots.value(index, false);
 }
 
 //------------------------------------------------------------------------------
@@ -729,12 +795,17 @@ void UI::Dashboard::setPoints(const int points)
 {
   if (m_points != points)
   {
-    // Update number of points
-    m_points = points;
-
-    // Update plot data structures
-    configureLineSeries();
-    configureMultiLineSeries();
+    // Update number of points & plot data structures
+    {
+      QMutexLocker locker(&m_dataLock);
+      m_points = points;
+      configureLineSeries();
+      configureMultiLineSeries();
+#ifdef BUILD_COMMERCIAL
+      configurePlot3DSeries();
+#endif
+      invalidateWidgets();
+    }
 
     // Update the UI
     Q_EMIT pointsChanged();
@@ -748,15 +819,23 @@ void UI::Dashboard::setPoints(const int points)
  */
 void UI::Dashboard::resetData(const bool notify)
 {
+  // Block the processing thread until the reset is complete
+  QMutexLocker locker(&m_dataLock);
+  m_streamActive = streamAvailable();
+
   // Clear plotting data
-  m_fftValues.clear();
+  m_fftEngines.clear();
   m_pltValues.clear();
   m_multipltValues.clear();
+  m_waterfallEngines.clear();
+  m_waterfallFftIndex.clear();
+  m_fftFeedsWaterfall.clear();
 
   // Free memory associated with the containers of the plotting data
-  m_fftValues.squeeze();
+  m_fftEngines.squeeze();
   m_pltValues.squeeze();
   m_multipltValues.squeeze();
+  m_waterfallEngines.squeeze();
 
   // Clear data for 3D plots
 #ifdef BUILD_COMMERCIAL
@@ -769,8 +848,10 @@ void UI::Dashboard::resetData(const bool notify)
   m_gpsValues.squeeze();
 
   // Clear X/Y axis arrays
-  m_xAxisData.clear();
-  m_yAxisData.clear();
+  m_plotSeries.clear();
+  m_xAxisColumns.clear();
+  m_yAxisColumns.clear();
+  m_movedColumns.clear();
 
   // Clear widget & action structures
   m_widgetCount = 0;
@@ -779,6 +860,12 @@ void UI::Dashboard::resetData(const bool notify)
   m_widgetDatasets.clear();
   m_datasetReferences.clear();
 
+  // Force all widgets to refresh
+  ++m_generation;
+  m_datasetWidgets.clear();
+  m_widgetGenerations.clear();
+  m_generationOffsets.clear();
+
   // Clear activity status flags for plot widgets
   m_activePlots.clear();
   m_activeFFTPlots.clear();
@@ -787,7 +874,6 @@ void UI::Dashboard::resetData(const bool notify)
   // Reset frame data
   m_rawFrame = JSON::Frame();
   m_lastFrame = JSON::Frame();
-  m_updateRetryInProgress = false;
 
   // Configure actions
   auto *frameBuilder = &JSON::FrameBuilder::instance();
@@ -795,6 +881,7 @@ void UI::Dashboard::resetData(const bool notify)
     configureActions(frameBuilder->frame());
 
   // Notify user interface
+  locker.unlock();
   if (notify)
   {
     m_updateRequired = true;
@@ -828,7 +915,7 @@ void UI::Dashboard::setTerminalEnabled(const bool enabled)
     m_terminalEnabled = enabled;
     const auto frame = m_rawFrame;
     resetData(false);
-    hotpathRxFrame(frame);
+    rebuildDashboard(frame);
   }
 
   Q_EMIT terminalEnabledChanged();
@@ -941,6 +1028,7 @@ void UI::Dashboard::activateAction(const int index, const bool guiTrigger)
  */
 void UI::Dashboard::setPlotRunning(const int index, const bool enabled)
 {
+  QMutexLocker locker(&m_dataLock);
   if (m_activePlots.contains(index))
     m_activePlots[index] = enabled;
 }
@@ -955,6 +1043,7 @@ void UI::Dashboard::setPlotRunning(const int index, const bool enabled)
  */
 void UI::Dashboard::setFFTPlotRunning(const int index, const bool enabled)
 {
+  QMutexLocker locker(&m_dataLock);
   if (m_activeFFTPlots.contains(index))
     m_activeFFTPlots[index] = enabled;
 }
@@ -969,6 +1058,7 @@ void UI::Dashboard::setFFTPlotRunning(const int index, const bool enabled)
  */
 void UI::Dashboard::setMultiplotRunning(const int index, const bool enabled)
 {
+  QMutexLocker locker(&m_dataLock);
   if (m_activeMultiplots.contains(index))
     m_activeMultiplots[index] = enabled;
 }
@@ -981,49 +1071,254 @@ void UI::Dashboard::setMultiplotRunning(const int index, const bool enabled)
  * @brief Processes an incoming data frame and updates the dashboard
  *        accordingly.
  *
- * Validates the frame, checks for commercial feature flags, and compares the
- * frame structure with the current configuration. If the structure has changed,
- * the dashboard is reconfigured. Finally, updates dataset values and plots.
+ * Validates the frame and compares its structure with the current
+ * configuration. If the structure has changed, the frame is handed to the GUI
+ * thread to regenerate the dashboard model, and frames are dropped until the
+ * new model is ready. Otherwise, updates dataset values and plots under the
+ * data lock.
+ *
+ * This function is called from the frame processing thread.
  *
  * @param frame The new JSON data frame to process.
  */
 void UI::Dashboard::hotpathRxFrame(const JSON::Frame &frame)
 {
   // Validate frame
-  if (frame.groups.size() <= 0 || !streamAvailable()) [[unlikely]]
+  if (frame.groups.size() <= 0 || !m_streamActive) [[unlikely]]
+    return;
+
+  // Wait for the GUI thread to apply the new frame structure
+  if (m_rebuildPending) [[unlikely]]
     return;
 
   // Regenerate dashboard model if frame structure changed
+  QMutexLocker locker(&m_dataLock);
   if (!JSON::compare_frames(frame, m_rawFrame) || m_datasetReferences.isEmpty())
       [[unlikely]]
   {
-    const bool hadProFeatures = m_rawFrame.containsCommercialFeatures;
-    reconfigureDashboard(frame);
-    if (hadProFeatures != frame.containsCommercialFeatures)
-      Q_EMIT containsCommercialFeaturesChanged();
+    requestRebuild(frame);
+    return;
+  }
+
+  // Update dashboard data & set dashboard update flag
+  if (updateDashboardData(frame)) [[likely]]
+    m_updateRequired = true;
+  else
+    requestRebuild(frame);
+}
+
+/**
+ * @brief Processes a block of numeric samples that share a frame structure.
+ *
+ * Each row of @p samples holds the values of the datasets of @p frame, where
+ * the dataset with index @c N is read from column @c N-1. Rows are appended
+ * to the plots & FFT engines one after another under a single data lock, so
+ * the result is the same as calling hotpathRxFrame() for every row, without
+ * copying or comparing the frame each time.
+ *
+ * This function is called from the frame processing thread.
+ *
+ * @param frame    Frame structure, with the values of the last row.
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows in the block.
+ * @param channels Number of values per row.
+ */
+void UI::Dashboard::hotpathRxSamples(const JSON::Frame &frame,
+                                     const double *samples,
+                                     const qsizetype rows, const int channels)
+{
+  // Validate frame
+  if (frame.groups.size() <= 0 || rows <= 0 || !m_streamActive) [[unlikely]]
+    return;
+
+  // Wait for the GUI thread to apply the new frame structure
+  if (m_rebuildPending) [[unlikely]]
+    return;
+
+  // Regenerate dashboard model if frame structure changed
+  QMutexLocker locker(&m_dataLock);
+  if (!JSON::compare_frames(frame, m_rawFrame) || m_datasetReferences.isEmpty())
+      [[unlikely]]
+  {
+    requestRebuild(frame);
+    return;
   }
 
-  // Update dashboard data
-  updateDashboardData(frame);
+  // Resolve the dashboard datasets fed by each column of the block
+  ++m_generation;
+  m_sampleTargets.clear();
+  for (const auto &group : frame.groups)
+  {
+    for (const auto &dataset : group.datasets)
+    {
+      const auto it = m_datasetReferences.find(dataset.uniqueId);
+      if (it == m_datasetReferences.end()) [[unlikely]]
+      {
+        requestRebuild(frame);
+        return;
+      }
+
+      const int column = dataset.index - 1;
+      if (column >= 0 && column < channels) [[likely]]
+        markDatasetChanged(dataset.uniqueId);
+
+      for (auto *ptr : it.value())
+      {
+        if (column >= 0 && column < channels) [[likely]]
+          m_sampleTargets.emplace_back(ptr, column);
+
+        else
+        {
+          ptr->value = dataset.value;
+          ptr->isNumeric = dataset.isNumeric;
+          ptr->numericValue = dataset.numericValue;
+        }
+      }
+    }
+  }
+
+  // Append every row to the plots & time-series widgets
+  for (qsizetype r = 0; r < rows; ++r)
+  {
+    const double *row = samples + r * channels;
+    for (const auto &[dataset, column] : m_sampleTargets)
+      JSON::assign_value(*dataset, row[column]);
+
+    updateDataSeries();
+  }
 
   // Set dashboard update flag
   m_updateRequired = true;
 }
 
+/**
+ * @brief Appends a block of numeric samples to the history of the
+ *        time-series widgets, or replaces the history with it.
+ *
+ * Used by the CSV player to rebuild the plots after seeking, and to deliver
+ * the rows that are due within a UI tick during playback, without turning
+ * every row into text and parsing it again. The rows of @p samples are
+ * appended in order as with hotpathRxSamples(), using the current frame
+ * structure.
+ *
+ * If @p replace is set, the history of the plots, FFT engines, GPS & 3D plots
+ * is cleared first (keeping the paused/running state of each widget).
+ *
+ * This function is called from the processing thread (see
+ * IO::Manager::processTask()), so that the samples are applied in order with
+ * the frames that are queued by the player.
+ *
+ * @param samples  Interleaved samples, @p rows times @p channels values.
+ * @param rows     Number of rows in the block (may be zero).
+ * @param channels Number of values per row.
+ * @param replace  Whether to clear the history before appending the rows.
+ *
+ * @return @c false if the dashboard model has not been built yet, in which
+ *         case the history is not modified.
+ */
+bool UI::Dashboard::loadSamples(const double *samples, const qsizetype rows,
+                                const int channels, const bool replace)
+{
+  // Wait for the GUI thread to apply the new frame structure
+  if (m_rebuildPending)
+    return false;
+
+  // Obtain a frame structure
+  QMutexLocker locker(&m_dataLock);
+  if (m_rawFrame.groups.size() <= 0 || m_datasetReferences.isEmpty())
+    return false;
+
+  // Clear the history & append the samples
+  if (replace)
+    clearDataSeries();
+
+  if (rows > 0 && channels > 0)
+    hotpathRxSamples(m_rawFrame, samples, rows, channels);
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // Frame processing & dashboard model generation
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Schedules a dashboard rebuild in the GUI thread.
+ *
+ * A copy of @p frame is queued to rebuildDashboard(), and frames received in
+ * the meantime are discarded by hotpathRxFrame().
+ *
+ * @param frame The JSON frame with the new structure.
+ */
+void UI::Dashboard::requestRebuild(const JSON::Frame &frame)
+{
+  m_rebuildPending = true;
+  QMetaObject::invokeMethod(
+      this, [this, frame] { rebuildDashboard(frame); }, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Regenerates the dashboard model for a frame with a new structure.
+ *
+ * Runs in the GUI thread, since reconfiguring the dashboard rebuilds the
+ * widget model. The values of @p frame are applied once the model is ready.
+ * If the model still does not match the frame afterwards, the data source is
+ * disconnected to avoid rebuilding the dashboard for every frame.
+ *
+ * @param frame The JSON frame with the new structure.
+ */
+void UI::Dashboard::rebuildDashboard(const JSON::Frame &frame)
+{
+  // Discard the frame if the data source went away in the meantime
+  bool ok = true;
+  bool proFeaturesChanged = false;
+  if (frame.groups.size() > 0 && streamAvailable())
+  {
+    QMutexLocker locker(&m_dataLock);
+    const bool hadProFeatures = m_rawFrame.containsCommercialFeatures;
+    reconfigureDashboard(frame);
+    ok = updateDashboardData(frame);
+    proFeaturesChanged = hadProFeatures != frame.containsCommercialFeatures;
+    m_updateRequired = true;
+  }
+
+  // Resume frame processing
+  m_rebuildPending = false;
+  if (proFeaturesChanged)
+    Q_EMIT containsCommercialFeaturesChanged();
+
+  // Disconnect from data source if the model cannot be built
+  if (!ok) [[unlikely]]
+  {
+    qWarning() << "Failed to build dashboard widget model";
+
+    if (IO::Manager::instance().isConnected())
+      IO::Manager::instance().disconnectDevice();
+    else if (CSV::Player::instance().isOpen())
+      CSV::Player::instance().closeFile();
+#ifdef BUILD_COMMERCIAL
+    else if (MQTT::Client::instance().isConnected())
+      MQTT::Client::instance().closeConnection();
+#endif
+  }
+}
+
 /**
  * @brief Updates dataset values and plot data based on the given frame.
  *
  * Iterates through groups and datasets in the frame, updating internal
- * data structures with the latest values.
+ * data structures with the latest values, and flags the widgets of the
+ * datasets whose value changed. Must be called with the data lock held.
  *
  * @param frame The JSON frame containing new dataset values.
+ * @return @c false if a dataset of the frame is not registered in the
+ *         dashboard model, in which case the model must be rebuilt.
  */
-void UI::Dashboard::updateDashboardData(const JSON::Frame &frame)
+bool UI::Dashboard::updateDashboardData(const JSON::Frame &frame)
 {
+  // Start a new generation
+  ++m_generation;
+
   // Update all datasets of the frame
   for (const auto &group : frame.groups)
   {
@@ -1035,38 +1330,16 @@ void UI::Dashboard::updateDashboardData(const JSON::Frame &frame)
 
       // Cannot find dataset UID
       if (it == m_datasetReferences.end()) [[unlikely]]
-      {
-        // Break recursion
-        if (m_updateRetryInProgress)
-        {
-          qWarning() << "Failed to build dashboard widget model";
+        return false;
 
-          // Disconnect from data source
-          if (IO::Manager::instance().isConnected())
-            IO::Manager::instance().disconnectDevice();
-          else if (CSV::Player::instance().isOpen())
-            CSV::Player::instance().closeFile();
-#ifdef BUILD_COMMERCIAL
-          else if (MQTT::Client::instance().isConnected())
-            MQTT::Client::instance().closeConnection();
-#endif
-
-          return;
-        }
-
-        // Re-generate dashboard model
-        reconfigureDashboard(frame);
-
-        // Try running the update again
-        m_updateRetryInProgress = true;
-        updateDashboardData(frame);
-        m_updateRetryInProgress = false;
-
-        return;
-      }
+      // Flag the widgets of the dataset if its value changed
+      const auto &datasets = it.value();
+      if (!datasets.isEmpty()
+          && (datasets.first()->numericValue != dataset.numericValue
+              || datasets.first()->value != dataset.value))
+        markDatasetChanged(uid);
 
       // Update all datasets for the given UID
-      const auto &datasets = it.value();
       for (auto *ptr : datasets)
       {
         ptr->value = dataset.value;
@@ -1078,6 +1351,7 @@ void UI::Dashboard::updateDashboardData(const JSON::Frame &frame)
 
   // Update plots & time-series widgets
   updateDataSeries();
+  return true;
 }
 
 /**
@@ -1256,6 +1530,7 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
   }
 
   // Initialize data series & update actions
+  configureGenerations();
   updateDataSeries();
   configureActions(frame);
 
@@ -1273,7 +1548,7 @@ void UI::Dashboard::reconfigureDashboard(const JSON::Frame &frame)
  *
  * This method handles real-time updating of internal data buffers for all
  * widgets that visualize ordered or continuous data over time, including:
- * - FFT plots
+ * - FFT plots & waterfalls
  * - Linear (2D) plots
  * - Multi-series (grouped) plots
  * - GPS trajectory widgets (lat/lon/alt history)
@@ -1297,6 +1572,7 @@ void UI::Dashboard::updateDataSeries()
   const int fftCount = widgetCount(SerialStudio::DashboardFFT);
   const int plotCount = widgetCount(SerialStudio::DashboardPlot);
   const int multiCount = widgetCount(SerialStudio::DashboardMultiPlot);
+  const int waterfallCount = widgetCount(SerialStudio::DashboardWaterfall);
 #ifdef BUILD_COMMERCIAL
   const int plot3DCount = widgetCount(SerialStudio::DashboardPlot3D);
 #endif
@@ -1304,12 +1580,14 @@ void UI::Dashboard::updateDataSeries()
   // Resize data points if needed
   if (m_gpsValues.size() != gpsCount) [[unlikely]]
     configureGpsSeries();
-  if (m_fftValues.size() != fftCount) [[unlikely]]
+  if (m_fftEngines.size() != fftCount) [[unlikely]]
     configureFftSeries();
   if (m_pltValues.size() != plotCount) [[unlikely]]
     configureLineSeries();
   if (m_multipltValues.size() != multiCount) [[unlikely]]
     configureMultiLineSeries();
+  if (m_waterfallEngines.size() != waterfallCount) [[unlikely]]
+    configureWaterfallSeries();
 #ifdef BUILD_COMMERCIAL
   if (m_plotData3D.size() != plot3DCount) [[unlikely]]
     configurePlot3DSeries();
@@ -1341,57 +1619,85 @@ void UI::Dashboard::updateDataSeries()
   // Update FFT plots
   for (int i = 0; i < fftCount; ++i)
   {
-    if (!m_activeFFTPlots[i])
+    if (!m_activeFFTPlots[i] && !m_fftFeedsWaterfall[i])
       continue;
 
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues[i].push(dataset.numericValue);
+    m_fftEngines[i]->append(dataset.numericValue);
+  }
+
+  // Update waterfalls that do not share the engine of an FFT plot
+  for (int i = 0; i < waterfallCount; ++i)
+  {
+    if (m_waterfallFftIndex[i] >= 0)
+      continue;
+
+    const auto &dataset = getDatasetWidget(SerialStudio::DashboardWaterfall, i);
+    m_waterfallEngines[i]->append(dataset.numericValue);
   }
 
-  // Append latest values to linear plots data
-  QSet<int> xAxesMoved;
-  QSet<int> yAxesMoved;
+  // Append latest values to linear plots data, once per column
+  auto *plotGenerations = widgetGenerations(SerialStudio::DashboardPlot);
+  std::fill(m_movedColumns.begin(), m_movedColumns.end(), 0);
   for (int i = 0; i < plotCount; ++i)
   {
     // Stop if plot widget is not enabled
     if (!m_activePlots[i])
       continue;
 
+    // Flag the plot as changed, since its history scrolls
+    if (plotGenerations)
+      plotGenerations[i] = m_generation;
+
     // Shift Y-axis points
     const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-    if (!yAxesMoved.contains(yDataset.index))
+    const auto yColumn = m_yAxisColumns.find(yDataset.index);
+    if (yColumn != m_yAxisColumns.end() && !m_movedColumns[*yColumn])
     {
-      yAxesMoved.insert(yDataset.index);
-      m_yAxisData[yDataset.index].push(yDataset.numericValue);
+      m_movedColumns[*yColumn] = 1;
+      m_plotSeries.push(*yColumn, yDataset.numericValue);
     }
 
     // Shift X-axis points
     auto xAxisId = SerialStudio::activated() ? yDataset.xAxisId : 0;
-    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId))
+    const auto xColumn = m_xAxisColumns.find(xAxisId);
+    if (xColumn != m_xAxisColumns.end() && !m_movedColumns[*xColumn])
     {
-      xAxesMoved.insert(xAxisId);
+      m_movedColumns[*xColumn] = 1;
       const auto &xDataset = m_datasets[xAxisId];
-      m_xAxisData[xAxisId].push(xDataset.numericValue);
+      m_plotSeries.push(*xColumn, xDataset.numericValue);
     }
   }
 
-  // Update Multi-plots
+  // Append the latest row of every multi-plot
+  auto *multiGenerations = widgetGenerations(SerialStudio::DashboardMultiPlot);
   for (int i = 0; i < multiCount; ++i)
   {
     if (!m_activeMultiplots[i])
       continue;
 
+    if (multiGenerations)
+      multiGenerations[i] = m_generation;
+
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
     auto &multiSeries = m_multipltValues[i];
-    for (size_t j = 0; j < group.datasets.size(); ++j)
-      multiSeries.y[j].push(group.datasets[j].numericValue);
+    const auto count = std::min(group.datasets.size(), multiSeries.y.size());
+
+    m_rowBuffer.resize(multiSeries.y.size());
+    for (size_t j = 0; j < count; ++j)
+      m_rowBuffer[j] = group.datasets[j].numericValue;
+
+    multiSeries.y.appendRow(m_rowBuffer.data());
   }
 
   // Update 3D plots
 #ifdef BUILD_COMMERCIAL
+  auto *plot3DGenerations = widgetGenerations(SerialStudio::DashboardPlot3D);
   for (int i = 0; i < plot3DCount; ++i)
   {
     auto &plotData = m_plotData3D[i];
+    if (plot3DGenerations)
+      plot3DGenerations[i] = m_generation;
 
     QVector3D point;
     const auto &group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
@@ -1406,14 +1712,37 @@ void UI::Dashboard::updateDataSeries()
         point.setZ(dataset.numericValue);
     }
 
-    plotData.push_back(point);
-    const size_t maxPoints = static_cast<size_t>(points());
-    if (plotData.size() > maxPoints)
-      plotData.erase(plotData.begin(), plotData.end() - maxPoints);
+    plotData.push(point);
   }
 #endif
 }
 
+/**
+ * @brief Clears the history of all time-series widgets.
+ *
+ * The series are re-created, so the running state of the plots is saved and
+ * restored afterwards.
+ */
+void UI::Dashboard::clearDataSeries()
+{
+  const auto activePlots = m_activePlots;
+  const auto activeFFTPlots = m_activeFFTPlots;
+  const auto activeMultiplots = m_activeMultiplots;
+
+  configureGpsSeries();
+  configureFftSeries();
+  configureLineSeries();
+  configureMultiLineSeries();
+#ifdef BUILD_COMMERCIAL
+  configurePlot3DSeries();
+#endif
+
+  m_activePlots = activePlots;
+  m_activeFFTPlots = activeFFTPlots;
+  m_activeMultiplots = activeMultiplots;
+  invalidateWidgets();
+}
+
 /**
  * @brief Initializes the GPS series structure for all GPS widgets.
  *
@@ -1460,11 +1789,11 @@ void UI::Dashboard::configureGpsSeries()
 }
 
 /**
- * @brief Configures the FFT series data structure for the dashboard.
+ * @brief Configures the FFT engines of the dashboard.
  *
- * This function clears existing FFT values and initializes the data structure
- * for each FFT plot widget with a predefined number of samples, filling it with
- * zeros.
+ * This function releases the existing FFT engines and creates one for each
+ * FFT plot widget, using the window size, overlap, averaging and input range
+ * configured for its dataset.
  *
  * @note Typically called during dashboard setup or reset to prepare FFT plot
  *       widgets for rendering.
@@ -1472,17 +1801,73 @@ void UI::Dashboard::configureGpsSeries()
 void UI::Dashboard::configureFftSeries()
 {
   // Clear memory
-  m_fftValues.clear();
-  m_fftValues.squeeze();
+  m_fftEngines.clear();
+  m_fftEngines.squeeze();
   m_activeFFTPlots.clear();
 
-  // Construct FFT plot data structure
+  // Construct FFT engines
   for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
   {
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    m_fftValues.append(DSP::AxisData(dataset.fftSamples));
+    auto engine = std::make_shared<DSP::FFTEngine>(
+        dataset.fftSamples, dataset.fftOverlap, dataset.fftAverages);
+    engine->setRange(dataset.fftMin, dataset.fftMax);
+
+    m_fftEngines.append(engine);
     m_activeFFTPlots.insert(i, true);
   }
+
+  // Waterfalls may share the engines that were just replaced
+  configureWaterfallSeries();
+}
+
+/**
+ * @brief Configures the FFT engines of the waterfall widgets.
+ *
+ * If the dataset of a waterfall also has an FFT plot, both widgets share the
+ * engine of the FFT plot, so that the spectrum is only computed once. Shared
+ * engines keep running while the FFT plot is paused, and the FFT plot widget
+ * ignores new spectra in that case.
+ *
+ * Called by configureFftSeries(), since the shared engines are replaced.
+ */
+void UI::Dashboard::configureWaterfallSeries()
+{
+  // Clear memory
+  m_waterfallEngines.clear();
+  m_waterfallEngines.squeeze();
+  m_waterfallFftIndex.clear();
+  m_fftFeedsWaterfall.fill(false, m_fftEngines.size());
+
+  // Share or construct FFT engines
+  for (int i = 0; i < widgetCount(SerialStudio::DashboardWaterfall); ++i)
+  {
+    const auto &dataset = getDatasetWidget(SerialStudio::DashboardWaterfall, i);
+
+    // Look for an FFT plot of the same dataset
+    int fft = -1;
+    for (int j = 0; j < m_fftEngines.size() && fft < 0; ++j)
+    {
+      const auto &d = getDatasetWidget(SerialStudio::DashboardFFT, j);
+      if (d.uniqueId == dataset.uniqueId)
+        fft = j;
+    }
+
+    // Share its engine
+    m_waterfallFftIndex.append(fft);
+    if (fft >= 0)
+    {
+      m_fftFeedsWaterfall[fft] = true;
+      m_waterfallEngines.append(m_fftEngines[fft]);
+      continue;
+    }
+
+    // Construct a separate engine
+    auto engine = std::make_shared<DSP::FFTEngine>(
+        dataset.fftSamples, dataset.fftOverlap, dataset.fftAverages);
+    engine->setRange(dataset.fftMin, dataset.fftMax);
+    m_waterfallEngines.append(engine);
+  }
 }
 
 /**
@@ -1496,23 +1881,28 @@ void UI::Dashboard::configureFftSeries()
  * - If a dataset specifies an X-axis source, the corresponding data is used.
  * - Otherwise, the default X-axis (based on sample points) is used.
  *
+ * The X/Y histories of every plotted dataset are allocated as columns of a
+ * single series store, instead of one heap block per dataset.
+ *
  * @note Typically called during dashboard setup or reset to prepare plot
  *       widgets for rendering.
  */
 void UI::Dashboard::configureLineSeries()
 {
   // Clear memory
-  m_xAxisData.clear();
-  m_yAxisData.clear();
+  m_plotSeries.clear();
+  m_xAxisColumns.clear();
+  m_yAxisColumns.clear();
   m_pltValues.clear();
   m_pltValues.squeeze();
   m_activePlots.clear();
 
   // Reset default X-axis data
-  m_pltXAxis = DSP::AxisData(points() + 1);
-  m_pltXAxis.fillRange(0, 1);
+  m_samplesAxis = DSP::AxisData(points() + 1);
+  m_samplesAxis.fillRange(0, 1);
 
-  // Construct X/Y axis data arrays
+  // Assign a column to each X/Y axis data array
+  std::size_t columns = 0;
   for (auto i = m_widgetDatasets.begin(); i != m_widgetDatasets.end(); ++i)
   {
     // Obtain list of datasets for a widget type
@@ -1524,28 +1914,25 @@ void UI::Dashboard::configureLineSeries()
       if (d->plt)
       {
         // Register Y-axis
-        DSP::AxisData yAxis(points() + 1);
-        m_yAxisData.insert(d->index, yAxis);
-        m_yAxisData[d->index].fill(0);
+        if (!m_yAxisColumns.contains(d->index))
+          m_yAxisColumns.insert(d->index, columns++);
 
         // Register X-axis
         if (SerialStudio::activated())
         {
           int xSource = d->xAxisId;
-          if (!m_xAxisData.contains(xSource))
-          {
-            DSP::AxisData xAxis(points() + 1);
-            if (m_datasets.contains(xSource))
-            {
-              m_xAxisData.insert(xSource, xAxis);
-              m_xAxisData[xSource].fill(0);
-            }
-          }
+          if (!m_xAxisColumns.contains(xSource) && m_datasets.contains(xSource))
+            m_xAxisColumns.insert(xSource, columns++);
         }
       }
     }
   }
 
+  // Allocate all the columns at once
+  m_plotSeries.allocate(columns, points() + 1);
+  m_plotSeries.fill(0);
+  m_movedColumns.assign(columns, 0);
+
   // Construct plot values structure
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
   {
@@ -1553,12 +1940,14 @@ void UI::Dashboard::configureLineSeries()
     const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
 
     // Add X-axis data & generate a line series with X/Y data
-    if (m_datasets.contains(yDataset.xAxisId) && SerialStudio::activated())
+    const auto yColumn = m_yAxisColumns.value(yDataset.index);
+    if (m_xAxisColumns.contains(yDataset.xAxisId) && SerialStudio::activated())
     {
-      const auto &xDataset = m_datasets[yDataset.xAxisId];
+      const auto xColumn = m_xAxisColumns.value(yDataset.xAxisId);
       DSP::LineSeries series;
-      series.x = &m_xAxisData[xDataset.index];
-      series.y = &m_yAxisData[yDataset.index];
+      series.x = &m_plotSeries[xColumn];
+      series.y = &m_plotSeries[yColumn];
+      series.yIndex = &m_plotSeries.pyramid(yColumn);
       m_pltValues.append(series);
     }
 
@@ -1566,8 +1955,9 @@ void UI::Dashboard::configureLineSeries()
     else
     {
       DSP::LineSeries series;
-      series.x = &m_pltXAxis;
-      series.y = &m_yAxisData[yDataset.index];
+      series.x = &m_samplesAxis;
+      series.y = &m_plotSeries[yColumn];
+      series.yIndex = &m_plotSeries.pyramid(yColumn);
       m_pltValues.append(series);
     }
 
@@ -1583,8 +1973,7 @@ void UI::Dashboard::configureLineSeries()
  * This method ensures that the internal storage (`m_plotData3D`) is correctly
  * resized and cleared to match the current number of 3D plot widgets in the
  * dashboard. Each entry in the list corresponds to a widget and holds a
- * time-ordered list of 3D points (`QVector3D`) representing the X, Y, and
- * Z axes.
+ * ring of up to points() 3D points representing the X, Y, and Z axes.
  *
  * @note This function is typically called when the number of widgets changes or
  *       during dashboard reinitialization to prevent buffer overflows or stale
@@ -1596,10 +1985,7 @@ void UI::Dashboard::configurePlot3DSeries()
   m_plotData3D.squeeze();
   m_plotData3D.resize(widgetCount(SerialStudio::DashboardPlot3D));
   for (int i = 0; i < m_plotData3D.count(); ++i)
-  {
-    m_plotData3D[i].clear();
-    m_plotData3D[i].shrink_to_fit();
-  }
+    m_plotData3D[i].allocate(points());
 }
 #endif
 
@@ -1607,8 +1993,8 @@ void UI::Dashboard::configurePlot3DSeries()
  * @brief Configures the multi-line series data structure for the dashboard.
  *
  * This function initializes the data structure used for multi-plot widgets.
- * It assigns the default X-axis to all multi-line series and creates a
- * `AxisData` vector for each dataset in the group, initializing it with zeros.
+ * It assigns the default X-axis to all multi-line series and allocates one
+ * column per dataset of the group in a series store, initialized with zeros.
  *
  * @note Typically called during dashboard setup or reset to prepare multi-plot
  *       widgets for rendering.
@@ -1621,8 +2007,8 @@ void UI::Dashboard::configureMultiLineSeries()
   m_activeMultiplots.clear();
 
   // Reset default X-axis data
-  m_multipltXAxis = DSP::AxisData(points() + 1);
-  m_multipltXAxis.fillRange(0, 1);
+  m_samplesAxis = DSP::AxisData(points() + 1);
+  m_samplesAxis.fillRange(0, 1);
 
   // Construct multi-plot values structure
   for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
@@ -1630,18 +2016,97 @@ void UI::Dashboard::configureMultiLineSeries()
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
 
     DSP::MultiLineSeries series;
-    series.x = &m_multipltXAxis;
-    for (size_t j = 0; j < group.datasets.size(); ++j)
-    {
-      series.y.push_back(DSP::AxisData(points() + 1));
-      series.y.back().fill(0);
-    }
+    series.x = &m_samplesAxis;
+    series.y.allocate(group.datasets.size(), points() + 1);
+    series.y.fill(0);
 
     m_multipltValues.append(series);
     m_activeMultiplots.insert(i, true);
   }
 }
 
+//------------------------------------------------------------------------------
+// Widget change tracking
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Assigns a generation slot to every widget and maps each dataset to
+ *        the slots of the widgets that display it.
+ *
+ * Slots are laid out by widget type, in the same order as the widget model.
+ * All widgets start as changed in a new generation.
+ */
+void UI::Dashboard::configureGenerations()
+{
+  m_datasetWidgets.clear();
+  m_generationOffsets.clear();
+
+  // Register group widgets
+  std::size_t slots = 0;
+  for (auto i = m_widgetGroups.cbegin(); i != m_widgetGroups.cend(); ++i)
+  {
+    m_generationOffsets.insert(i.key(), slots);
+    for (const auto &group : i.value())
+    {
+      for (const auto &dataset : group.datasets)
+        m_datasetWidgets[dataset.uniqueId].push_back(slots);
+
+      ++slots;
+    }
+  }
+
+  // Register dataset widgets
+  for (auto i = m_widgetDatasets.cbegin(); i != m_widgetDatasets.cend(); ++i)
+  {
+    m_generationOffsets.insert(i.key(), slots);
+    for (const auto &dataset : i.value())
+      m_datasetWidgets[dataset.uniqueId].push_back(slots++);
+  }
+
+  // Flag every widget as changed
+  m_widgetGenerations.resize(slots);
+  invalidateWidgets();
+}
+
+/**
+ * @brief Starts a new generation and flags every widget as changed, e.g.
+ *        after the time series have been reallocated.
+ */
+void UI::Dashboard::invalidateWidgets()
+{
+  ++m_generation;
+  std::fill(m_widgetGenerations.begin(), m_widgetGenerations.end(),
+            m_generation);
+}
+
+/**
+ * @brief Flags the widgets that display the dataset with the given unique ID
+ *        as changed in the current generation.
+ */
+void UI::Dashboard::markDatasetChanged(const int uniqueId)
+{
+  const auto it = m_datasetWidgets.constFind(uniqueId);
+  if (it == m_datasetWidgets.cend())
+    return;
+
+  for (const auto slot : *it)
+    m_widgetGenerations[slot] = m_generation;
+}
+
+/**
+ * @brief Returns the generation slots of the widgets of the given type, or
+ *        @c nullptr if there are no such widgets.
+ */
+quint64 *
+UI::Dashboard::widgetGenerations(const SerialStudio::DashboardWidget widget)
+{
+  const auto it = m_generationOffsets.constFind(widget);
+  if (it == m_generationOffsets.cend() || m_widgetGenerations.empty())
+    return nullptr;
+
+  return m_widgetGenerations.data() + *it;
+}
+
 //------------------------------------------------------------------------------
 // Action configuration
 //------------------------------------------------------------------------------
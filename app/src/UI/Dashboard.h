@@ -21,10 +21,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <QFont>
+#include <QMutex>
 #include <QObject>
 
 #include "DSP.h"
+#include "FFTEngine.h"
 #include "SerialStudio.h"
 
 namespace UI
@@ -44,6 +49,18 @@ namespace UI
  * Properties notify changes to dynamically adjust UI elements like widget
  * visibility and count.
  *
+ * Frames are ingested from the frame processing thread of the I/O manager,
+ * which updates dataset values and time-series buffers under the data lock.
+ * The `updated()` signal is emitted with the same lock held, so widgets always
+ * read a consistent snapshot of the data. Changes in the frame structure are
+ * applied in the GUI thread, since they regenerate the widget model.
+ *
+ * Every ingested frame increments a generation counter, which is stored for
+ * each widget whose datasets changed value (or whose time series received a
+ * sample). Widgets compare widgetGeneration() with the last generation they
+ * processed to skip downsampling and text formatting when their data did not
+ * change.
+ *
  * @note This class is implemented as a singleton and is non-copyable and
  *       non-movable.
  */
@@ -100,6 +117,9 @@ public:
   [[nodiscard]] int points() const;
   [[nodiscard]] int actionCount() const;
   [[nodiscard]] int totalWidgetCount() const;
+  [[nodiscard]] quint64 widgetGeneration(
+      const SerialStudio::DashboardWidget widget, const int index) const;
+  [[nodiscard]] QRecursiveMutex &dataLock() const;
 
   Q_INVOKABLE bool frameValid() const;
   Q_INVOKABLE int relativeIndex(const int widgetIndex);
@@ -119,19 +139,22 @@ public:
 
   [[nodiscard]] const JSON::Frame &rawFrame();
   [[nodiscard]] const JSON::Frame &processedFrame();
-  [[nodiscard]] const DSP::AxisData &fftData(const int index) const;
   [[nodiscard]] const DSP::GpsSeries &gpsSeries(const int index) const;
   [[nodiscard]] const DSP::LineSeries &plotData(const int index) const;
   [[nodiscard]] const DSP::MultiLineSeries &
   multiplotData(const int index) const;
+  [[nodiscard]] std::shared_ptr<const DSP::FFTEngine>
+  fftEngine(const int index) const;
+  [[nodiscard]] std::shared_ptr<const DSP::FFTEngine>
+  waterfallEngine(const int index) const;
 
 #ifdef BUILD_COMMERCIAL
   [[nodiscard]] const DSP::LineSeries3D &plotData3D(const int index) const;
 #endif
 
-  [[nodiscard]] bool plotRunning(const int index);
-  [[nodiscard]] bool fftPlotRunning(const int index);
-  [[nodiscard]] bool multiplotRunning(const int index);
+  [[nodiscard]] bool plotRunning(const int index) const;
+  [[nodiscard]] bool fftPlotRunning(const int index) const;
+  [[nodiscard]] bool multiplotRunning(const int index) const;
 
 public slots:
   void setPoints(const int points);
@@ -146,43 +169,79 @@ public slots:
   void setMultiplotRunning(const int index, const bool enabled);
 
   void hotpathRxFrame(const JSON::Frame &frame);
+  void hotpathRxSamples(const JSON::Frame &frame, const double *samples,
+                        const qsizetype rows, const int channels);
+
+  bool loadSamples(const double *samples, const qsizetype rows,
+                   const int channels, const bool replace);
 
 private:
-  void updateDashboardData(const JSON::Frame &frame);
+  void rebuildDashboard(const JSON::Frame &frame);
+  bool updateDashboardData(const JSON::Frame &frame);
   void reconfigureDashboard(const JSON::Frame &frame);
+  void requestRebuild(const JSON::Frame &frame);
 
   void updateDataSeries();
+  void clearDataSeries();
   void configureGpsSeries();
   void configureFftSeries();
   void configureLineSeries();
   void configurePlot3DSeries();
   void configureMultiLineSeries();
+  void configureWaterfallSeries();
   void configureActions(const JSON::Frame &frame);
 
+  void configureGenerations();
+  void invalidateWidgets();
+  void markDatasetChanged(const int uniqueId);
+  quint64 *widgetGenerations(const SerialStudio::DashboardWidget widget);
+
 private:
   int m_points;              // Number of plot points to retain
   int m_widgetCount;         // Total number of active widgets
-  bool m_updateRequired;     // Flag to trigger plot/UI update
   bool m_showActionPanel;    // Whenever the UI shall display an action panel
   bool m_terminalEnabled;    // Whether terminal group is enabled
   bool m_showTaskbarButtons; // Always show taskbar buttons, regardless of state
 
-  bool m_updateRetryInProgress; // Used to avoid recursion when frame changes
+  std::atomic<bool> m_streamActive;   // Cached value of streamAvailable()
+  std::atomic<bool> m_rebuildPending; // Structure change queued to GUI thread
+  std::atomic<bool> m_updateRequired; // Flag to trigger plot/UI update
+  mutable QRecursiveMutex m_dataLock; // Guards dataset values & series data
+
+  DSP::AxisData m_samplesAxis;   // Shared sample-index X-axis for all plots
+  DSP::SeriesStore m_plotSeries; // X/Y history of line plots (single arena)
 
-  DSP::AxisData m_pltXAxis;      // Default X-axis data for line plots
-  DSP::AxisData m_multipltXAxis; // Default X-axis data for multi-line plots
+  QMap<int, std::size_t> m_xAxisColumns; // X-axis column per dataset index
+  QMap<int, std::size_t> m_yAxisColumns; // Y-axis column per dataset index
 
-  QMap<int, DSP::AxisData> m_xAxisData; // X-axis data per dataset index
-  QMap<int, DSP::AxisData> m_yAxisData; // Y-axis data per dataset index
+  std::vector<char> m_movedColumns; // Plot columns updated in current frame
+  std::vector<double> m_rowBuffer;  // Scratch row for multiplot appends
+
+  // Dashboard datasets fed by each column of a sample block
+  std::vector<std::pair<JSON::Dataset *, int>> m_sampleTargets;
+
+  quint64 m_generation;                     // Incremented for every frame
+  std::vector<quint64> m_widgetGenerations; // Last change of every widget
+
+  // First generation slot of each widget type
+  QMap<SerialStudio::DashboardWidget, std::size_t> m_generationOffsets;
+
+  // Generation slots of the widgets that display each dataset (by unique ID)
+  QMap<int, std::vector<std::size_t>> m_datasetWidgets;
 
   QMap<int, bool> m_activePlots;      // Active state per plot index
   QMap<int, bool> m_activeFFTPlots;   // Active state per FFT plot index
   QMap<int, bool> m_activeMultiplots; // Active state per multiplot index
 
   QVector<DSP::GpsSeries> m_gpsValues;            // GPS data per GPS widget
-  QVector<DSP::AxisData> m_fftValues;             // FFT data per dataset
   QVector<DSP::LineSeries> m_pltValues;           // Line plot data
   QVector<DSP::MultiLineSeries> m_multipltValues; // Multi-line plot data
+
+  // Spectrum analyzer per FFT & waterfall widget, shared with the widgets
+  QVector<std::shared_ptr<DSP::FFTEngine>> m_fftEngines;
+  QVector<std::shared_ptr<DSP::FFTEngine>> m_waterfallEngines;
+  QVector<int> m_waterfallFftIndex; // FFT plot sharing each waterfall engine
+  QVector<bool> m_fftFeedsWaterfall; // FFT engines also used by a waterfall
 #ifdef BUILD_COMMERCIAL
   QVector<DSP::LineSeries3D> m_plotData3D; // 3D plot data (commercial only)
 #endif
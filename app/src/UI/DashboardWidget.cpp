@@ -32,6 +32,7 @@
 #include "UI/Widgets/DataGrid.h"
 #include "UI/Widgets/Gyroscope.h"
 #include "UI/Widgets/MultiPlot.h"
+#include "UI/Widgets/Waterfall.h"
 #include "UI/Widgets/Accelerometer.h"
 
 #include "Misc/ThemeManager.h"
@@ -185,6 +186,11 @@ void UI::DashboardWidget::setWidgetIndex(const int index)
         m_qmlPath
             = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/FFTPlot.qml";
         break;
+      case SerialStudio::DashboardWaterfall:
+        m_dbWidget = new Widgets::Waterfall(relativeIndex(), this);
+        m_qmlPath
+            = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Waterfall.qml";
+        break;
       case SerialStudio::DashboardPlot:
         m_dbWidget = new Widgets::Plot(relativeIndex(), this);
         m_qmlPath = "qrc:/serial-studio.com/gui/qml/Widgets/Dashboard/Plot.qml";
@@ -32,6 +32,7 @@ Widgets::Accelerometer::Accelerometer(const int index, QQuickItem *parent)
   , m_index(index)
   , m_theta(0)
   , m_magnitude(0)
+  , m_generation(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
     connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
@@ -71,6 +72,14 @@ void Widgets::Accelerometer::updateData()
   if (!VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
     return;
 
+  // Skip if the acceleration values did not change
+  const auto generation = UI::Dashboard::instance().widgetGeneration(
+      SerialStudio::DashboardAccelerometer, m_index);
+  if (generation == m_generation)
+    return;
+
+  m_generation = generation;
+
   // Get the accelerometer data and validate the dataset count
   const auto &acc = GET_GROUP(SerialStudio::DashboardAccelerometer, m_index);
   if (acc.datasets.size() != 3)
@@ -50,6 +50,7 @@ private:
   int m_index;
   double m_theta;
   double m_magnitude;
+  quint64 m_generation;
 };
 
 } // namespace Widgets
@@ -45,6 +45,7 @@ Widgets::Bar::Bar(const int index, QQuickItem *parent,
   , m_alarmLow(std::nan(""))
   , m_alarmHigh(std::nan(""))
   , m_alarmsDefined(false)
+  , m_generation(0)
 {
   if (autoInitFromBarDataset
       && VALIDATE_WIDGET(SerialStudio::DashboardBar, m_index))
@@ -246,6 +247,15 @@ void Widgets::Bar::updateData()
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardBar, m_index))
   {
+    // Skip if the value did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardBar, m_index);
+    if (generation == m_generation)
+      return;
+
+    m_generation = generation;
+
+    // Obtain the dataset & update the value
     const auto &dataset = GET_DATASET(SerialStudio::DashboardBar, m_index);
     auto value = qMax(m_minValue, qMin(m_maxValue, dataset.numericValue));
     if (!qFuzzyCompare(value, m_value))
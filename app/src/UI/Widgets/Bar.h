@@ -97,5 +97,6 @@ protected:
   double m_alarmHigh;
 
   bool m_alarmsDefined;
+  quint64 m_generation;
 };
 } // namespace Widgets
@@ -31,6 +31,7 @@ Widgets::Compass::Compass(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
   , m_value(0)
+  , m_generation(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
     connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
@@ -68,6 +69,15 @@ void Widgets::Compass::updateData()
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
   {
+    // Skip if the value did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardCompass, m_index);
+    if (generation == m_generation)
+      return;
+
+    m_generation = generation;
+
+    // Obtain the dataset & update the value
     const auto &dataset = GET_DATASET(SerialStudio::DashboardCompass, m_index);
     const auto value = dataset.numericValue;
     if (!qFuzzyCompare(value, m_value))
@@ -50,5 +50,6 @@ private:
   int m_index;
   double m_value;
   QString m_text;
+  quint64 m_generation;
 };
 } // namespace Widgets
@@ -35,6 +35,7 @@
 Widgets::DataGrid::DataGrid(const int index, QQuickItem *parent)
   : StaticTable(parent)
   , m_index(index)
+  , m_generation(0)
 {
   if (!VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index))
     return;
@@ -94,7 +95,8 @@ void Widgets::DataGrid::setPaused(const bool paused)
  *
  * Reads the latest dataset values from the dashboard and updates the table
  * if there are any changes. Units are appended to values when applicable.
- * Skips execution if paused or if the widget index is invalid.
+ * Skips execution if paused, if the widget index is invalid or if no value
+ * of the group changed since the last update.
  */
 void Widgets::DataGrid::updateData()
 {
@@ -102,6 +104,14 @@ void Widgets::DataGrid::updateData()
   if (!VALIDATE_WIDGET(SerialStudio::DashboardDataGrid, m_index) || paused())
     return;
 
+  // Skip formatting the values if none of them changed
+  const auto generation = UI::Dashboard::instance().widgetGeneration(
+      SerialStudio::DashboardDataGrid, m_index);
+  if (generation == m_generation)
+    return;
+
+  m_generation = generation;
+
   // Obtain a reference to the datagrid group & copy current table data
   const auto &group = GET_GROUP(SerialStudio::DashboardDataGrid, m_index);
   auto rows = data();
@@ -113,15 +123,11 @@ void Widgets::DataGrid::updateData()
   // Update values for every dataset in the group
   for (size_t i = 0; i < group.datasets.size(); ++i)
   {
-    // Obtain a reference to the dataset object & read its value
+    // Obtain a reference to the dataset object & format its value
     const auto &dataset = group.datasets[i];
-    QString value = dataset.value;
-
-    // Convert the dataset to a number if needed
-    bool isNumber;
-    const double n = value.toDouble(&isNumber);
-    if (isNumber)
-      value = FMT_VAL(n, dataset);
+    QString value = dataset.isNumeric
+                        ? FMT_VAL(dataset.numericValue, dataset)
+                        : dataset.value;
 
     // Append dataset units (if available)
     if (!dataset.units.isEmpty())
@@ -170,7 +176,7 @@ QStringList Widgets::DataGrid::getRow(const JSON::Dataset &dataset)
   const QString title = dataset.title;
   const QString units = dataset.units;
 
-  QString value = dataset.value;
+  QString value = JSON::format_value(dataset);
   if (!units.isEmpty())
     value += " " + units;
 
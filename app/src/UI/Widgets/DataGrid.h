@@ -51,5 +51,6 @@ private:
 private:
   int m_index;
   bool m_paused;
+  quint64 m_generation;
 };
 } // namespace Widgets
@@ -22,46 +22,6 @@
 #include "UI/Dashboard.h"
 #include "UI/Widgets/FFTPlot.h"
 
-/**
- * @brief Computes a single coefficient of the 4-term Blackman-Harris window.
- *
- * This function implements the 4-term Blackman-Harris window formula:
- * \f[
- * w[n] = a_0 - a_1 \cos\left(\frac{2\pi n}{N-1}\right)
- *        + a_2 \cos\left(\frac{4\pi n}{N-1}\right)
- *        - a_3 \cos\left(\frac{6\pi n}{N-1}\right)
- * \f]
- *
- * where the coefficients are:
- * - a₀ = 0.35875
- * - a₁ = 0.48829
- * - a₂ = 0.14128
- * - a₃ = 0.01168
- *
- * @param i Index of the coefficient (0 ≤ i < N).
- * @param N Total number of points in the window.
- * @return The computed window coefficient for index @p i.
- *
- * @note If N ≤ 1, the function returns 1.0f.
- */
-inline float blackman_harris_coeff(unsigned int i, unsigned int N)
-{
-  if (N <= 1)
-    return 1.0f;
-
-  constexpr float a0 = 0.35875f;
-  constexpr float a1 = 0.48829f;
-  constexpr float a2 = 0.14128f;
-  constexpr float a3 = 0.01168f;
-
-  const float two_pi = 6.28318530717958647692f;
-  const float k = two_pi / static_cast<float>(N - 1);
-  const float x = k * static_cast<float>(i);
-
-  return a0 - a1 * std::cos(x) + a2 * std::cos(2.0f * x)
-         - a3 * std::cos(3.0f * x);
-}
-
 /**
  * @brief Constructs a new FFTPlot widget.
  * @param index The index of the FFT plot in the Dashboard.
@@ -78,20 +38,16 @@ Widgets::FFTPlot::FFTPlot(const int index, QQuickItem *parent)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
-  , m_center(0)
-  , m_halfRange(1)
-  , m_scaleIsValid(false)
-  , m_plan(nullptr)
+  , m_dirty(false)
+  , m_generation(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
   {
     // Get FFT dataset
     const auto &dataset = GET_DATASET(SerialStudio::DashboardFFT, m_index);
 
-    // Initialize FFT size, force power of two for better performance
-    m_size = 1 << static_cast<int>(std::log2(qMax(8, dataset.fftSamples)));
-
-    // Obtain sampling rate from dataset
+    // Obtain FFT size & sampling rate from dataset
+    m_size = DSP::FFTEngine::sizeFor(dataset.fftSamples);
     m_samplingRate = dataset.fftSamplingRate;
 
     // Set axis ranges
@@ -99,35 +55,6 @@ Widgets::FFTPlot::FFTPlot(const int index, QQuickItem *parent)
     m_maxY = 0;
     m_minY = -100;
     m_maxX = m_samplingRate / 2;
-
-    // Allocate FFT and sample arrays
-    m_samples.resize(m_size);
-    m_fftOutput.resize(m_size);
-
-    // Create window function coefficients
-    m_window.resize(m_size);
-    const auto windowSize = static_cast<unsigned int>(m_size);
-    for (unsigned int i = 0; i < windowSize; ++i)
-      m_window[i] = blackman_harris_coeff(i, windowSize);
-
-    // Create FFT plan
-    m_plan = kiss_fft_alloc(m_size, 0, nullptr, nullptr);
-
-    // Obtain minimum and maximum values
-    double minVal = dataset.fftMin;
-    double maxVal = dataset.fftMax;
-
-    // Fix inverted limits
-    if (maxVal < minVal)
-      std::swap(minVal, maxVal);
-
-    // Accept only if the range is positive and non-zero
-    if (maxVal - minVal > 0.0)
-    {
-      m_scaleIsValid = true;
-      m_center = (maxVal + minVal) * 0.5;
-      m_halfRange = qMax(1e-12, (maxVal - minVal) * 0.5);
-    }
   }
 }
 
@@ -214,6 +141,10 @@ double Widgets::FFTPlot::yTickInterval() const
 
 /**
  * @brief Draws the FFT data on the given QLineSeries.
+ *
+ * The series is only replaced if a new spectrum was published (or the plot
+ * was resized) since the last call.
+ *
  * @param series The QLineSeries to draw the data on.
  */
 void Widgets::FFTPlot::draw(QLineSeries *series)
@@ -221,8 +152,12 @@ void Widgets::FFTPlot::draw(QLineSeries *series)
   if (series)
   {
     updateData();
-    series->replace(m_data);
-    Q_EMIT series->update();
+    if (m_dirty)
+    {
+      m_dirty = false;
+      series->replace(m_data);
+      Q_EMIT series->update();
+    }
   }
 }
 
@@ -235,7 +170,7 @@ void Widgets::FFTPlot::setDataW(const int width)
   if (m_dataW != width)
   {
     m_dataW = width;
-    updateData();
+    downsample();
 
     Q_EMIT dataSizeChanged();
   }
@@ -250,7 +185,7 @@ void Widgets::FFTPlot::setDataH(const int height)
   if (m_dataH != height)
   {
     m_dataH = height;
-    updateData();
+    downsample();
 
     Q_EMIT dataSizeChanged();
   }
@@ -267,13 +202,11 @@ void Widgets::FFTPlot::setRunning(const bool enabled)
 }
 
 /**
- * @brief Updates the FFT data.
+ * @brief Fetches the latest spectrum from the FFT engine of the dataset, if
+ *        it changed since the last update.
  */
 void Widgets::FFTPlot::updateData()
 {
-  // Share workspace data
-  static thread_local DSP::DownsampleWorkspace ws;
-
   // Skip if widget is disabled
   if (!isEnabled())
     return;
@@ -282,106 +215,46 @@ void Widgets::FFTPlot::updateData()
   if (!VALIDATE_WIDGET(SerialStudio::DashboardFFT, m_index))
     return;
 
-  // Fetch time-domain data
-  const auto &data = UI::Dashboard::instance().fftData(m_index);
-
-  // Re-initialize FFT structures if data size changes
-  const int newSize = static_cast<int>(data.size());
-  if (newSize != m_size)
-  {
-    m_size = newSize;
-
-    m_window.resize(m_size);
-    m_samples.resize(m_size);
-    m_fftOutput.resize(m_size);
-
-    const auto windowSize = static_cast<unsigned int>(m_size);
-    for (unsigned int i = 0; i < windowSize; ++i)
-      m_window[i] = blackman_harris_coeff(i, windowSize);
-
-    if (m_plan)
-    {
-      kiss_fft_free(m_plan);
-      m_plan = nullptr;
-    }
-
-    m_plan = kiss_fft_alloc(m_size, 0, nullptr, nullptr);
-  }
-
-  // Access the internal buffer and state of the circular queue
-  const double *in = data.raw();
-  std::size_t idx = data.frontIndex();
-  const std::size_t cap = data.capacity();
-
-  // Normalize time-domain input samples into [-1, 1] range
-  const double offset = m_scaleIsValid ? -m_center : 0.0;
-  const double scale = m_scaleIsValid ? (1.0 / m_halfRange) : 1.0;
-  for (int i = 0; i < m_size; ++i)
-  {
-    const float v = static_cast<float>((in[idx] + offset) * scale);
-    m_samples[i].r = v * m_window[i];
-    m_samples[i].i = 0.0f;
-    idx = (idx + 1) % cap;
-  }
-
-  // Run FFT
-  kiss_fft(m_plan, m_samples.data(), m_fftOutput.data());
-
-  // Constants
-  constexpr float floorDB = -100.0f;
-  constexpr int smoothingWindow = 3;
-  constexpr float eps_squared = 1e-24f;
-  constexpr int halfWindow = smoothingWindow / 2;
-
-  // Compute number of frequency bins (Nyquist rate)
-  const int spectrumSize = static_cast<size_t>(m_size) / 2;
-
-  // Allocate dB cache only if needed
-  static thread_local std::vector<float> dbCache;
-  if (dbCache.size() < static_cast<size_t>(spectrumSize))
-    dbCache.resize(spectrumSize);
+  // Skip if paused, the engine keeps running if a waterfall shares it
+  if (!running())
+    return;
 
-  // Precompute dB values
-  const float normFactor = static_cast<float>(m_size * m_size);
-  for (int i = 0; i < spectrumSize; ++i)
-  {
-    const float re = m_fftOutput[i].r;
-    const float im = m_fftOutput[i].i;
-    const float power = std::max((re * re + im * im) / normFactor, eps_squared);
-    dbCache[i] = std::max(10.0f * std::log10(power), floorDB);
-  }
+  // Skip if no new spectrum has been published
+  const auto engine = UI::Dashboard::instance().fftEngine(m_index);
+  if (!engine || engine->generation() == m_generation)
+    return;
 
-  // Resize X buffer if needed
-  if (m_xData.size() != static_cast<size_t>(spectrumSize))
-  {
-    m_xData.resize(spectrumSize);
-    m_xData.clear();
-  }
+  // Copy the spectrum
+  m_size = engine->size();
+  m_generation = engine->spectrum(m_spectrum);
 
-  // Resize Y buffer if needed
-  if (m_yData.size() != static_cast<size_t>(spectrumSize))
+  // Rebuild the frequency axis if the number of bins changed
+  const auto bins = m_spectrum.size();
+  if (m_xData.capacity() != bins)
   {
-    m_yData.resize(spectrumSize);
-    m_yData.clear();
+    m_xData = DSP::AxisData(bins);
+    m_yData = DSP::AxisData(bins);
+    for (std::size_t i = 0; i < bins; ++i)
+      m_xData.push(static_cast<double>(i) * m_samplingRate / m_size);
   }
 
-  // Smoothing and XY point generation
-  for (int i = 0; i < spectrumSize; ++i)
-  {
-    const int minIdx = std::max(0, i - halfWindow);
-    const int maxIdx = std::min(spectrumSize - 1, i + halfWindow);
-
-    float sum = 0.0f;
-    for (int k = minIdx; k <= maxIdx; ++k)
-      sum += dbCache[k];
+  // Update magnitudes
+  m_yData.clear();
+  for (const auto value : m_spectrum)
+    m_yData.push(value);
 
-    const float smoothedDB = sum / (maxIdx - minIdx + 1);
-    const float freq = static_cast<float>(i) * m_samplingRate / m_size;
+  // Downsample data
+  downsample();
+}
 
-    m_xData.push(freq);
-    m_yData.push(smoothedDB);
-  }
+/**
+ * @brief Downsamples the current spectrum to the size of the plot.
+ */
+void Widgets::FFTPlot::downsample()
+{
+  // Share workspace data
+  static thread_local DSP::DownsampleWorkspace ws;
 
-  // Downsample data
   DSP::downsampleMonotonic(m_xData, m_yData, m_dataW, m_dataH, m_data, &ws);
+  m_dirty = true;
 }
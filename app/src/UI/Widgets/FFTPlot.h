@@ -25,14 +25,16 @@
 #include <QQuickItem>
 #include <QLineSeries>
 
-#include <kiss_fft.h>
-
 #include "DSP.h"
 
 namespace Widgets
 {
 /**
  * @brief A widget that plots the FFT of a dataset.
+ *
+ * The spectrum itself is computed by the DSP::FFTEngine that the dashboard
+ * feeds from the frame processing thread; this widget only downsamples the
+ * latest published spectrum when it changes.
  */
 class FFTPlot : public QQuickItem
 {
@@ -53,14 +55,6 @@ signals:
 
 public:
   explicit FFTPlot(const int index = -1, QQuickItem *parent = nullptr);
-  ~FFTPlot()
-  {
-    if (m_plan)
-    {
-      kiss_fft_free(m_plan);
-      m_plan = nullptr;
-    }
-  }
 
   [[nodiscard]] int dataW() const;
   [[nodiscard]] int dataH() const;
@@ -81,6 +75,9 @@ public slots:
 private slots:
   void updateData();
 
+private:
+  void downsample();
+
 private:
   int m_size;
   int m_index;
@@ -94,17 +91,12 @@ private:
   double m_minY;
   double m_maxY;
 
-  double m_center;
-  double m_halfRange;
-  bool m_scaleIsValid;
+  bool m_dirty;
+  quint64 m_generation;
 
   QList<QPointF> m_data;
   DSP::AxisData m_xData;
   DSP::AxisData m_yData;
-  std::vector<float> m_window;
-
-  kiss_fft_cfg m_plan;
-  std::vector<kiss_fft_cpx> m_samples;
-  std::vector<kiss_fft_cpx> m_fftOutput;
+  std::vector<float> m_spectrum;
 };
 } // namespace Widgets
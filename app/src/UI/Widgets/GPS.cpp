@@ -68,6 +68,7 @@ Widgets::GPS::GPS(const int index, QQuickItem *parent)
   , m_altitude(0)
   , m_latitude(0)
   , m_longitude(0)
+  , m_generation(0)
 {
   // Configure item flags
   setMipmap(true);
@@ -549,16 +550,26 @@ void Widgets::GPS::updateData()
   if (!VALIDATE_WIDGET(SerialStudio::DashboardGPS, m_index))
     return;
 
-  // Obtain series data
-  const auto &series = UI::Dashboard::instance().gpsSeries(m_index);
-  if (series.latitudes.empty() || series.longitudes.empty()
-      || series.altitudes.empty())
+  // No need to update if the position did not change
+  const auto generation = UI::Dashboard::instance().widgetGeneration(
+      SerialStudio::DashboardGPS, m_index);
+  if (generation == m_generation)
     return;
 
-  // Grab most recent GPS values
-  const double alt = series.altitudes.back();
-  const double lat = series.latitudes.back();
-  const double lon = series.longitudes.back();
+  // Grab most recent GPS values, the series is updated by another thread
+  double alt, lat, lon;
+  m_generation = generation;
+  {
+    QMutexLocker locker(&UI::Dashboard::instance().dataLock());
+    const auto &series = UI::Dashboard::instance().gpsSeries(m_index);
+    if (series.latitudes.empty() || series.longitudes.empty()
+        || series.altitudes.empty())
+      return;
+
+    alt = series.altitudes.back();
+    lat = series.latitudes.back();
+    lon = series.longitudes.back();
+  }
 
   // Stop update if data is invalid
   if (std::isnan(alt) && std::isnan(lat) && std::isnan(lon))
@@ -985,6 +996,7 @@ void Widgets::GPS::paintPathData(QPainter *painter, const QSize &view)
     return;
 
   // Obtain series data
+  QMutexLocker locker(&UI::Dashboard::instance().dataLock());
   const auto &series = UI::Dashboard::instance().gpsSeries(m_index);
   if (series.latitudes.empty() || series.longitudes.empty()
       || series.altitudes.empty())
@@ -157,6 +157,7 @@ private:
   double m_altitude;
   double m_latitude;
   double m_longitude;
+  quint64 m_generation;
 
   QPointF m_centerTile;
   QPoint m_lastMousePos;
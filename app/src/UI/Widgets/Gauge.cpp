@@ -79,6 +79,15 @@ void Widgets::Gauge::updateData()
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardGauge, m_index))
   {
+    // Skip if the value did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardGauge, m_index);
+    if (generation == m_generation)
+      return;
+
+    m_generation = generation;
+
+    // Obtain the dataset & update the value
     const auto &dataset = GET_DATASET(SerialStudio::DashboardGauge, m_index);
     auto value = qMax(m_minValue, qMin(m_maxValue, dataset.numericValue));
     if (!qFuzzyCompare(value, m_value))
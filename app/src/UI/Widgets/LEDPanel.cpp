@@ -31,6 +31,7 @@
 Widgets::LEDPanel::LEDPanel(const int index, QQuickItem *parent)
   : QQuickItem(parent)
   , m_index(index)
+  , m_generation(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardLED, m_index))
   {
@@ -103,6 +104,14 @@ void Widgets::LEDPanel::updateData()
 
   if (VALIDATE_WIDGET(SerialStudio::DashboardLED, m_index))
   {
+    // Skip if the LED values did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardLED, m_index);
+    if (generation == m_generation)
+      return;
+
+    m_generation = generation;
+
     // Get the LED group and update the LED states
     bool changed = false;
     const auto &group = GET_GROUP(SerialStudio::DashboardLED, m_index);
@@ -55,6 +55,7 @@ private slots:
 
 private:
   int m_index;
+  quint64 m_generation;
   QVector<bool> m_states;
   QStringList m_titles;
   QStringList m_colors;
@@ -37,6 +37,7 @@ Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
+  , m_generation(0)
 {
   // Obtain group information
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
@@ -62,7 +63,7 @@ Widgets::MultiPlot::MultiPlot(const int index, QQuickItem *parent)
     m_yLabel = group.title;
 
     // Resize data container to fit curves
-    m_data.resize(group.datasets.size());
+    resizeCurves(group.datasets.size());
 
     // Connect to the dashboard signals
     connect(&UI::Dashboard::instance(), &UI::Dashboard::pointsChanged, this,
@@ -211,6 +212,12 @@ const QList<bool> &Widgets::MultiPlot::visibleCurves() const
 
 /**
  * @brief Draws the data on the given QLineSeries.
+ *
+ * The series is only replaced if the curve data changed (or a different
+ * series is drawn for the curve) since the last call. The last series of each
+ * curve is tracked with a QPointer, so that a new series allocated at the
+ * address of a destroyed one is also redrawn.
+ *
  * @param series The QXYSeries to draw the data on.
  * @param index The index of the dataset to draw.
  */
@@ -218,8 +225,13 @@ void Widgets::MultiPlot::draw(QXYSeries *series, const int index)
 {
   if (series && index >= 0 && index < count() && m_visibleCurves[index])
   {
-    series->replace(m_data[index]);
-    Q_EMIT series->update();
+    if (m_dirty[index] || m_series[index] != series)
+    {
+      m_dirty[index] = false;
+      m_series[index] = series;
+      series->replace(m_data[index]);
+      Q_EMIT series->update();
+    }
   }
 }
 
@@ -232,6 +244,7 @@ void Widgets::MultiPlot::setDataW(const int width)
   if (m_dataW != width)
   {
     m_dataW = width;
+    m_generation = 0;
     updateData();
 
     Q_EMIT dataSizeChanged();
@@ -247,6 +260,7 @@ void Widgets::MultiPlot::setDataH(const int height)
   if (m_dataH != height)
   {
     m_dataH = height;
+    m_generation = 0;
     updateData();
 
     Q_EMIT dataSizeChanged();
@@ -264,7 +278,8 @@ void Widgets::MultiPlot::setRunning(const bool enabled)
 }
 
 /**
- * @brief Updates the data of the multiplot.
+ * @brief Updates the data of the multiplot, if it changed since the last
+ *        update.
  */
 void Widgets::MultiPlot::updateData()
 {
@@ -278,29 +293,28 @@ void Widgets::MultiPlot::updateData()
   // Only obtain data if widget data is still valid
   if (VALIDATE_WIDGET(SerialStudio::DashboardMultiPlot, m_index))
   {
+    // Skip if the curves did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardMultiPlot, m_index);
+    if (generation == m_generation)
+      return;
+
     // Fetch multiplot source data (shared X axis, multiple Y series)
+    m_generation = generation;
+    QMutexLocker locker(&UI::Dashboard::instance().dataLock());
     const auto &data = UI::Dashboard::instance().multiplotData(m_index);
-    const auto &X = *data.x;
 
     // Ensure output container has one QVector<QPointF> per series
     const qsizetype plotCount = data.y.size();
     if (m_data.size() != plotCount)
-    {
-      m_data.clear();
-      m_data.squeeze();
-      m_data.resize(plotCount);
-    }
+      resizeCurves(plotCount);
 
-    // Populate data for each plot
-    for (qsizetype i = 0; i < plotCount; ++i)
-    {
-      // Skip if curve is not visible
-      if (!m_visibleCurves[i])
-        continue;
+    // Downsample all visible curves over the shared X axis at once
+    DSP::downsampleMultiple(data, m_visibleCurves, m_dataW, m_dataH, m_data,
+                            &ws);
 
-      // Update data
-      DSP::downsampleMonotonic(X, data.y[i], m_dataW, m_dataH, m_data[i], &ws);
-    }
+    // Re-draw all curves on next draw() call
+    m_dirty.fill(true);
 
     // Calculate auto scale range
     calculateAutoScaleRange();
@@ -317,12 +331,12 @@ void Widgets::MultiPlot::updateRange()
     return;
 
   // Get the multiplot data
+  QMutexLocker locker(&UI::Dashboard::instance().dataLock());
   const auto &data = UI::Dashboard::instance().multiplotData(m_index);
 
   // Resize the container structure
-  m_data.clear();
-  m_data.squeeze();
-  m_data.resize(data.y.size());
+  resizeCurves(data.y.size());
+  m_generation = 0;
 
   // Update X-axis range
   m_minX = 0;
@@ -386,20 +400,18 @@ void Widgets::MultiPlot::calculateAutoScaleRange()
 
     // Loop through each dataset and find the min and max values
     int index = 0;
+    DSP::Extent ex, ey;
     for (const auto &curve : std::as_const(m_data))
     {
       if (m_visibleCurves[index])
-      {
-        for (auto i = 0; i < curve.count(); ++i)
-        {
-          m_minY = qMin(m_minY, curve[i].y());
-          m_maxY = qMax(m_maxY, curve[i].y());
-        }
-      }
+        DSP::pointExtent(curve.constData(), curve.count(), ex, ey);
 
       ++index;
     }
 
+    m_minY = qMin(m_minY, ey.min);
+    m_maxY = qMax(m_maxY, ey.max);
+
     // If the min and max are the same, set the range to 0-1
     if (qFuzzyCompare(m_minY, m_maxY))
     {
@@ -470,6 +482,7 @@ void Widgets::MultiPlot::modifyCurveVisibility(const int index,
 {
   if (index >= 0 && index < m_visibleCurves.count())
   {
+    m_generation = 0;
     m_visibleCurves[index] = visible;
     if (visible)
     {
@@ -481,6 +494,23 @@ void Widgets::MultiPlot::modifyCurveVisibility(const int index,
   }
 }
 
+/**
+ * @brief Clears the data of all curves and resizes the per-curve containers
+ *        to fit @p curves curves.
+ *
+ * Every curve is marked as dirty, so that the (now empty) data replaces the
+ * contents of its series on the next draw() call.
+ */
+void Widgets::MultiPlot::resizeCurves(const qsizetype curves)
+{
+  m_data.clear();
+  m_data.squeeze();
+  m_data.resize(curves);
+  m_series.clear();
+  m_series.resize(curves);
+  m_dirty.fill(true, curves);
+}
+
 /**
  * @brief Updates the theme of the multiplot.
  */
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <QVector>
+#include <QPointer>
 #include <QXYSeries>
 #include <QQuickItem>
 
@@ -99,6 +100,9 @@ public slots:
 private slots:
   void onThemeChanged();
 
+private:
+  void resizeCurves(const qsizetype curves);
+
 private:
   int m_index;
   int m_dataW;
@@ -111,7 +115,10 @@ private:
   QStringList m_colors;
   QStringList m_labels;
   QList<int> m_drawOrders;
+  QList<bool> m_dirty;
   QList<bool> m_visibleCurves;
+  quint64 m_generation;
   QList<QList<QPointF>> m_data;
+  QList<QPointer<QXYSeries>> m_series;
 };
 } // namespace Widgets
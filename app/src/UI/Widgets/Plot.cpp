@@ -36,7 +36,9 @@ Widgets::Plot::Plot(const int index, QQuickItem *parent)
   , m_maxX(0)
   , m_minY(0)
   , m_maxY(0)
+  , m_dirty(true)
   , m_monotonicData(true)
+  , m_generation(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index))
   {
@@ -174,6 +176,12 @@ const QString &Widgets::Plot::xLabel() const
 
 /**
  * @brief Draws the data on the given QLineSeries.
+ *
+ * The series is only replaced if the plot data changed (or a different
+ * series is drawn) since the last call. The last series is tracked with a
+ * QPointer, so that a new series allocated at the address of a destroyed one
+ * is also redrawn.
+ *
  * @param series The QLineSeries to draw the data on.
  */
 void Widgets::Plot::draw(QXYSeries *series)
@@ -181,9 +189,14 @@ void Widgets::Plot::draw(QXYSeries *series)
   if (series)
   {
     updateData();
-    series->replace(m_data);
-    calculateAutoScaleRange();
-    Q_EMIT series->update();
+    if (m_dirty || m_series != series)
+    {
+      m_dirty = false;
+      m_series = series;
+      series->replace(m_data);
+      calculateAutoScaleRange();
+      Q_EMIT series->update();
+    }
   }
 }
 
@@ -196,6 +209,7 @@ void Widgets::Plot::setDataW(const int width)
   if (m_dataW != width)
   {
     m_dataW = width;
+    m_generation = 0;
     updateData();
 
     Q_EMIT dataSizeChanged();
@@ -211,6 +225,7 @@ void Widgets::Plot::setDataH(const int height)
   if (m_dataH != height)
   {
     m_dataH = height;
+    m_generation = 0;
     updateData();
 
     Q_EMIT dataSizeChanged();
@@ -228,7 +243,8 @@ void Widgets::Plot::setRunning(const bool enabled)
 }
 
 /**
- * @brief Updates the plot data from the Dashboard.
+ * @brief Updates the plot data from the Dashboard, if it changed since the
+ *        last update.
  */
 void Widgets::Plot::updateData()
 {
@@ -242,7 +258,16 @@ void Widgets::Plot::updateData()
   // Only obtain data if widget data is still valid
   if (VALIDATE_WIDGET(SerialStudio::DashboardPlot, m_index))
   {
-    // Obtain plot data
+    // Skip if the plot data did not change
+    const auto generation = UI::Dashboard::instance().widgetGeneration(
+        SerialStudio::DashboardPlot, m_index);
+    if (generation == m_generation)
+      return;
+
+    // Obtain plot data, the series is updated by the processing thread
+    m_dirty = true;
+    m_generation = generation;
+    QMutexLocker locker(&UI::Dashboard::instance().dataLock());
     const auto &plotData = UI::Dashboard::instance().plotData(m_index);
 
     // Downsample data that only has one Y point per X point
@@ -261,23 +286,13 @@ void Widgets::Plot::updateData()
       if (m_data.size() != count)
         m_data.resize(count);
 
-      // Obtain raw pointers
+      // Update plot data points, one contiguous span at a time
       QPointF *out = m_data.data();
-      const auto *xData = X.raw();
-      const auto *yData = Y.raw();
-
-      // Get queue states for faster iteration
-      std::size_t xIdx = X.frontIndex();
-      std::size_t yIdx = Y.frontIndex();
-
-      // Update plot data points, avoid queue operations overhead
-      for (qsizetype i = 0; i < count; ++i)
-      {
-        out[i].setX(xData[xIdx]);
-        out[i].setY(yData[yIdx]);
-        xIdx = (xIdx + 1) % X.capacity();
-        yIdx = (yIdx + 1) % Y.capacity();
-      }
+      DSP::forEachSpanPair(X, Y, 0, count,
+                           [out](const double *x, const double *y,
+                                 std::size_t index, std::size_t n) {
+                             DSP::interleave(x, y, n, out + index);
+                           });
     }
   }
 }
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <QVector>
+#include <QPointer>
 #include <QXYSeries>
 #include <QQuickItem>
 
@@ -100,7 +101,10 @@ private:
   QString m_yLabel;
   QString m_xLabel;
 
+  bool m_dirty;
   bool m_monotonicData;
+  quint64 m_generation;
+  QPointer<QXYSeries> m_series;
   QList<QPointF> m_data;
 };
 } // namespace Widgets
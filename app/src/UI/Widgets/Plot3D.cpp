@@ -20,7 +20,19 @@
  * SPDX-License-Identifier: LicenseRef-SerialStudio-Commercial
  */
 
+#include <memory>
+#include <cstring>
+#include <algorithm>
+
+#include <QFile>
 #include <QCursor>
+#include <QSGImageNode>
+#include <QSGRenderNode>
+#include <QSGRendererInterface>
+#include <QQuickWindow>
+#include <QSGTransformNode>
+
+#include <rhi/qrhi.h>
 
 #include "UI/Dashboard.h"
 
@@ -30,13 +42,408 @@
 
 #include "UI/Widgets/Plot3D.h"
 
+//------------------------------------------------------------------------------
+// Scene graph nodes
+//------------------------------------------------------------------------------
+
+namespace
+{
+/**
+ * @brief Loads a shader compiled by qt_add_shaders() from the resources.
+ */
+QShader loadShader(const QString &path)
+{
+  QFile file(path);
+  if (file.open(QIODevice::ReadOnly))
+    return QShader::fromSerialized(file.readAll());
+
+  return QShader();
+}
+
+/**
+ * @brief Scene graph node that draws the curve from a vertex buffer that
+ *        mirrors the ring of points of the dashboard.
+ *
+ * Each vertex holds a point in world coordinates and the ring slot of the
+ * point (as W). Appending points only writes & uploads their slots, and the
+ * tail-to-head gradient is computed by the vertex shader from the slot of the
+ * newest point, so existing vertices never change.
+ *
+ * The ring is drawn as (up to) two line strips, oldest slots first. The
+ * vertex after the last slot repeats slot 0, so that both strips are joined.
+ *
+ * The node keeps its own copy of the ring, so that the vertex buffer can be
+ * re-created on the render thread after releaseResources().
+ */
+class CurveNode : public QSGRenderNode
+{
+public:
+  explicit CurveNode(QQuickWindow *window)
+    : m_window(window)
+    , m_front(0)
+    , m_count(0)
+    , m_fullUpload(true)
+    , m_headColor{}
+    , m_tailColor{}
+  {
+  }
+
+  ~CurveNode() override { releaseResources(); }
+
+  /**
+   * @brief Replaces the whole ring (one vertex per slot, plus the copy of
+   *        slot 0 at the end).
+   */
+  void assign(const std::vector<QVector4D> &ring)
+  {
+    m_vertices = ring;
+    m_ranges.clear();
+    m_fullUpload = true;
+  }
+
+  /**
+   * @brief Copies @p count slots of @p ring, starting at slot @p first and
+   *        wrapping around the end of the ring, and queues them for upload.
+   */
+  void update(const std::vector<QVector4D> &ring, std::size_t first,
+              std::size_t count)
+  {
+    const std::size_t slots = ring.size() - 1;
+    while (count > 0)
+    {
+      const std::size_t n = std::min(count, slots - first);
+      std::copy_n(ring.begin() + first, n, m_vertices.begin() + first);
+      m_ranges.emplace_back(first, n);
+      if (first == 0)
+      {
+        m_vertices[slots] = ring[slots];
+        m_ranges.emplace_back(slots, 1);
+      }
+
+      count -= n;
+      first = 0;
+    }
+
+    // Upload everything if the node has not been rendered for a while
+    if (m_ranges.size() > kMaxRanges)
+    {
+      m_ranges.clear();
+      m_fullUpload = true;
+    }
+  }
+
+  /**
+   * @brief Sets the slot of the oldest point & the number of points.
+   */
+  void setRing(std::size_t front, std::size_t count)
+  {
+    m_front = front;
+    m_count = count;
+  }
+
+  /**
+   * @brief Sets the colors of the newest & the oldest point.
+   */
+  void setColors(const QColor &head, const QColor &tail)
+  {
+    head.getRgbF(&m_headColor[0], &m_headColor[1], &m_headColor[2],
+                 &m_headColor[3]);
+    tail.getRgbF(&m_tailColor[0], &m_tailColor[1], &m_tailColor[2],
+                 &m_tailColor[3]);
+  }
+
+  StateFlags changedStates() const override { return {}; }
+  RenderingFlags flags() const override { return NoExternalRendering; }
+
+  void releaseResources() override
+  {
+    m_pipeline.reset();
+    m_bindings.reset();
+    m_uniforms.reset();
+    m_buffer.reset();
+  }
+
+  /**
+   * @brief Uploads the queued slots & the uniforms, creating the graphics
+   *        resources on first use.
+   */
+  void prepare() override
+  {
+    QRhi *rhi = m_window->rhi();
+    QRhiRenderTarget *target = renderTarget();
+    if (!rhi || !target || m_vertices.empty())
+      return;
+
+    // (Re)create the vertex buffer, it is then uploaded as a whole
+    auto *batch = rhi->nextResourceUpdateBatch();
+    const auto bytes
+        = static_cast<quint32>(m_vertices.size() * sizeof(QVector4D));
+    if (!m_buffer || m_buffer->size() != bytes)
+    {
+      m_buffer.reset(rhi->newBuffer(QRhiBuffer::Static,
+                                    QRhiBuffer::VertexBuffer, bytes));
+      m_buffer->create();
+      m_fullUpload = true;
+    }
+
+    // Upload the whole ring, or only the slots that changed
+    if (m_fullUpload)
+      batch->uploadStaticBuffer(m_buffer.get(), 0, bytes, m_vertices.data());
+
+    else
+    {
+      for (const auto &[first, count] : m_ranges)
+        batch->uploadStaticBuffer(
+            m_buffer.get(), static_cast<quint32>(first * sizeof(QVector4D)),
+            static_cast<quint32>(count * sizeof(QVector4D)),
+            m_vertices.data() + first);
+    }
+
+    m_ranges.clear();
+    m_fullUpload = false;
+
+    // Create the pipeline
+    if (!m_pipeline)
+      createPipeline(rhi, target);
+
+    // Update the uniform buffer (std140 layout, see plot3d_curve.vert)
+    const QMatrix4x4 mvp = *projectionMatrix() * *matrix();
+    const float ring[4]
+        = {static_cast<float>((m_front + m_count + slots() - 1) % slots()),
+           static_cast<float>(m_count), static_cast<float>(slots()),
+           static_cast<float>(inheritedOpacity())};
+
+    char uniforms[kUniformSize];
+    std::memcpy(uniforms, mvp.constData(), 64);
+    std::memcpy(uniforms + 64, m_headColor, 16);
+    std::memcpy(uniforms + 80, m_tailColor, 16);
+    std::memcpy(uniforms + 96, ring, 16);
+    batch->updateDynamicBuffer(m_uniforms.get(), 0, kUniformSize, uniforms);
+    commandBuffer()->resourceUpdate(batch);
+  }
+
+  /**
+   * @brief Draws the points from the oldest to the newest one.
+   */
+  void render(const RenderState *state) override
+  {
+    if (!m_pipeline || !m_buffer || m_count < 2)
+      return;
+
+    // Bind the pipeline & limit drawing to the clip rect of the item
+    auto *cb = commandBuffer();
+    const QSize size = renderTarget()->pixelSize();
+    cb->setGraphicsPipeline(m_pipeline.get());
+    cb->setViewport(QRhiViewport(0, 0, size.width(), size.height()));
+    if (state->scissorEnabled())
+    {
+      const QRect r = state->scissorRect();
+      cb->setScissor(QRhiScissor(r.x(), r.y(), r.width(), r.height()));
+    }
+
+    else
+      cb->setScissor(QRhiScissor(0, 0, size.width(), size.height()));
+
+    // Bind the ring
+    cb->setShaderResources();
+    const QRhiCommandBuffer::VertexInput input(m_buffer.get(), 0);
+    cb->setVertexInput(0, 1, &input);
+
+    // Draw up to the end of the ring (and the copy of slot 0), then the rest
+    const std::size_t first = std::min(m_count, slots() - m_front);
+    if (first == m_count)
+      cb->draw(static_cast<quint32>(m_count), 1,
+               static_cast<quint32>(m_front));
+
+    else
+    {
+      cb->draw(static_cast<quint32>(first + 1), 1,
+               static_cast<quint32>(m_front));
+      cb->draw(static_cast<quint32>(m_count - first), 1, 0);
+    }
+  }
+
+private:
+  /**
+   * @brief Returns the number of slots of the ring.
+   */
+  [[nodiscard]] std::size_t slots() const
+  {
+    return std::max<std::size_t>(1, m_vertices.size() - 1);
+  }
+
+  /**
+   * @brief Creates the uniform buffer, the bindings & the line strip
+   *        pipeline with premultiplied alpha blending.
+   */
+  void createPipeline(QRhi *rhi, QRhiRenderTarget *target)
+  {
+    m_uniforms.reset(rhi->newBuffer(QRhiBuffer::Dynamic,
+                                    QRhiBuffer::UniformBuffer, kUniformSize));
+    m_uniforms->create();
+
+    m_bindings.reset(rhi->newShaderResourceBindings());
+    m_bindings->setBindings({QRhiShaderResourceBinding::uniformBuffer(
+        0, QRhiShaderResourceBinding::VertexStage, m_uniforms.get())});
+    m_bindings->create();
+
+    QRhiGraphicsPipeline::TargetBlend blend;
+    blend.enable = true;
+    blend.srcColor = QRhiGraphicsPipeline::One;
+    blend.dstColor = QRhiGraphicsPipeline::OneMinusSrcAlpha;
+    blend.srcAlpha = QRhiGraphicsPipeline::One;
+    blend.dstAlpha = QRhiGraphicsPipeline::OneMinusSrcAlpha;
+
+    QRhiVertexInputLayout layout;
+    layout.setBindings({{sizeof(QVector4D)}});
+    layout.setAttributes({{0, 0, QRhiVertexInputAttribute::Float4, 0}});
+
+    m_pipeline.reset(rhi->newGraphicsPipeline());
+    m_pipeline->setFlags(QRhiGraphicsPipeline::UsesScissor);
+    m_pipeline->setTopology(QRhiGraphicsPipeline::LineStrip);
+    m_pipeline->setTargetBlends({blend});
+    m_pipeline->setShaderStages(
+        {{QRhiShaderStage::Vertex,
+          loadShader(QStringLiteral(":/rcc/shaders/plot3d_curve.vert.qsb"))},
+         {QRhiShaderStage::Fragment,
+          loadShader(QStringLiteral(":/rcc/shaders/plot3d_curve.frag.qsb"))}});
+    m_pipeline->setVertexInputLayout(layout);
+    m_pipeline->setSampleCount(target->sampleCount());
+    m_pipeline->setShaderResourceBindings(m_bindings.get());
+    m_pipeline->setRenderPassDescriptor(target->renderPassDescriptor());
+    m_pipeline->create();
+  }
+
+private:
+  static constexpr quint32 kUniformSize = 112;
+  static constexpr std::size_t kMaxRanges = 64;
+
+  QQuickWindow *m_window;
+  std::size_t m_front;
+  std::size_t m_count;
+  bool m_fullUpload;
+  float m_headColor[4];
+  float m_tailColor[4];
+
+  std::vector<QVector4D> m_vertices;
+  std::vector<std::pair<std::size_t, std::size_t>> m_ranges;
+
+  std::unique_ptr<QRhiBuffer> m_buffer;
+  std::unique_ptr<QRhiBuffer> m_uniforms;
+  std::unique_ptr<QRhiGraphicsPipeline> m_pipeline;
+  std::unique_ptr<QRhiShaderResourceBindings> m_bindings;
+};
+
+/**
+ * @brief Root node of the 3D plot.
+ *
+ * Holds one image node per pre-rendered layer and the curve geometry. The
+ * layers are re-ordered depending on the camera, so the child nodes are
+ * owned by this node instead of by their current parent.
+ */
+class Plot3DNode : public QSGNode
+{
+public:
+  explicit Plot3DNode(QQuickWindow *window)
+    : background(window->createImageNode())
+    , grid(window->createImageNode())
+    , data(window->createImageNode())
+    , indicator(window->createImageNode())
+    , camera(new QSGTransformNode)
+  {
+    for (auto *node : {background.get(), grid.get(), data.get(),
+                       indicator.get()})
+    {
+      node->setOwnsTexture(true);
+      node->setFiltering(QSGTexture::Linear);
+      node->setFlag(QSGNode::OwnedByParent, false);
+    }
+
+    camera->appendChildNode(new CurveNode(window));
+    camera->setFlag(QSGNode::OwnedByParent, false);
+  }
+
+  ~Plot3DNode() override { removeAllChildNodes(); }
+
+  [[nodiscard]] CurveNode *curve() const
+  {
+    return static_cast<CurveNode *>(camera->firstChild());
+  }
+
+  /**
+   * @brief Stacks the given layers (skipping null ones) from back to front.
+   *
+   * Children are only replaced if the stack changed, since re-inserting the
+   * curve node would upload its vertex buffer again.
+   */
+  void setLayers(std::initializer_list<QSGNode *> layers)
+  {
+    QSGNode *stack[4] = {};
+    int count = 0;
+    for (auto *layer : layers)
+    {
+      if (layer && count < 4)
+        stack[count++] = layer;
+    }
+
+    if (std::equal(stack, stack + 4, m_stack))
+      return;
+
+    removeAllChildNodes();
+    for (int i = 0; i < count; ++i)
+      appendChildNode(stack[i]);
+
+    std::copy(stack, stack + 4, m_stack);
+  }
+
+  std::unique_ptr<QSGImageNode> background;
+  std::unique_ptr<QSGImageNode> grid;
+  std::unique_ptr<QSGImageNode> data;
+  std::unique_ptr<QSGImageNode> indicator;
+  std::unique_ptr<QSGTransformNode> camera;
+
+  qint64 backgroundKey = 0;
+  qint64 gridKey = 0;
+  qint64 dataKey = 0;
+  qint64 indicatorKey = 0;
+
+private:
+  QSGNode *m_stack[4] = {};
+};
+
+/**
+ * @brief Uploads @p image to @p node if it changed since the last upload.
+ *
+ * @return @c false if the image is empty and the layer must be skipped.
+ */
+bool uploadLayer(QQuickWindow *window, QSGImageNode *node, qint64 &key,
+                 const QImage &image, const QRectF &rect)
+{
+  if (image.isNull())
+    return false;
+
+  if (key != image.cacheKey() || !node->texture())
+  {
+    node->setTexture(window->createTextureFromImage(image));
+    key = image.cacheKey();
+  }
+
+  node->setRect(rect);
+  return true;
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
 /**
  * @brief Constructs a Plot3D widget.
  * @param index The index of the Plot3D in the Dashboard.
  * @param parent The parent QQuickItem (optional).
  */
 Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
-  : QQuickPaintedItem(parent)
+  : QQuickItem(parent)
   , m_index(index)
   , m_minX(INT_MAX)
   , m_maxX(INT_MIN)
@@ -58,7 +465,15 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
   , m_invertEyePositions(false)
   , m_dirtyData(true)
   , m_dirtyGrid(true)
+  , m_dirtyVertices(true)
+  , m_dirtyBackground(true)
   , m_dirtyCameraIndicator(true)
+  , m_gpuCurve(false)
+  , m_generation(0)
+  , m_ringFront(0)
+  , m_ringSize(0)
+  , m_ringPushed(0)
+  , m_pendingPoints(0)
 {
   // Read settings
   m_anaglyph = m_settings.value("Plot3D_Anaglyph", false).toBool();
@@ -67,7 +482,7 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
   m_invertEyePositions = m_settings.value("Plot3D_InvertEyes", false).toBool();
 
   // Configure QML item behavior
-  setOpaquePainting(true);
+  setClip(true);
   setAcceptHoverEvents(true);
   setFiltersChildMouseEvents(true);
 
@@ -77,10 +492,6 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
   setFlag(ItemAcceptsInputMethod, true);
   setAcceptedMouseButtons(Qt::AllButtons);
 
-  // Set rendering hints
-  setMipmap(true);
-  setAntialiasing(false);
-
   // Update the plot data
   connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this,
           &Widgets::Plot3D::updateData);
@@ -120,116 +531,131 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem *parent)
 //------------------------------------------------------------------------------
 
 /**
- * @brief Renders the complete 3D plot scene, including optional anaglyph.
+ * @brief Updates the scene graph node of the 3D plot.
  *
- * This method composites all plot layers—background, grid, plot data,
- * and camera indicator—into the provided QPainter target. It handles
- * dirty flags to re-render components as needed.
+ * Re-renders the layers that were marked as dirty and uploads only those
+ * that changed. The layers are stacked as background, grid & data (in the
+ * order given by the camera position) and camera indicator.
  *
- * If anaglyph mode is enabled, it:
- * - Composes the full scene into a single image.
- * - Generates left and right eye views (right view shifted horizontally).
- * - Manually blends the two views into a red-cyan anaglyph using per-pixel
- *   channel mixing (red from left, green+blue from right).
+ * When the curve is drawn by the scene graph, the camera matrix is the only
+ * thing that changes while the user rotates the view. The vertex buffer
+ * mirrors the ring of points, so only the slots of newly appended points are
+ * uploaded, and the whole buffer only when the node is (re)created or the
+ * ring is re-allocated.
  *
- * If anaglyph is disabled, it simply draws the pre-rendered layers as-is.
- *
- * @param painter The QPainter to render the scene onto.
+ * In anaglyph mode, all layers are composed into a single image.
  */
-void Widgets::Plot3D::paint(QPainter *painter)
+QSGNode *Widgets::Plot3D::updatePaintNode(QSGNode *oldNode,
+                                          UpdatePaintNodeData *)
 {
-  // Configure render hints
-  painter->setBackground(m_outerBackgroundColor);
+  // Nothing to draw
+  if (width() <= 0 || height() <= 0 || !window())
+  {
+    delete oldNode;
+    return nullptr;
+  }
 
-  // Re-draw background (if required)
-  if (m_dirtyGrid)
-    drawGrid();
+  // Create the node
+  auto *node = static_cast<Plot3DNode *>(oldNode);
+  if (!node)
+  {
+    node = new Plot3DNode(window());
+    m_dirtyVertices = true;
+  }
 
-  // Re-draw foreground (if required)
-  if (m_dirtyData)
-    drawData();
+  // The software renderer cannot draw custom geometry, and point sprites
+  // have no portable size, so only interpolated curves go to the GPU
+  const auto api = window()->rendererInterface()->graphicsApi();
+  const bool gpuCurve = !anaglyphEnabled() && m_interpolate
+                        && QSGRendererInterface::isApiRhiBased(api);
 
-  // Re-draw camera indicator (if required)
+  // The image path needs every point, the GPU path only the new ones
+  if (!gpuCurve && m_gpuCurve)
+    copyPoints();
+
+  m_gpuCurve = gpuCurve;
+
+  // User is below axis/plane...draw plot first then grid
+  const bool dataBelowGrid = m_cameraAngleX <= 270 && m_cameraAngleX > 90.0;
+
+  // Re-draw layers (if required)
+  const bool layersChanged = dirty() || m_dirtyBackground;
+  if (m_dirtyGrid)
+    drawGrid();
   if (m_dirtyCameraIndicator)
     drawCameraIndicator();
-
-  // Re-draw background (if required)
   if (m_dirtyBackground)
     drawBackground();
+  if (m_dirtyData && !gpuCurve)
+    drawData();
 
-  // Generate list of images
-  QList<QImage *> images;
-  images.append(m_bgImg);
-
-  // User is below axis/plane...draw plot first then grid
-  if (m_cameraAngleX <= 270 && m_cameraAngleX > 90.0)
+  // Compose both eyes into a single image
+  const QRectF rect = boundingRect();
+  if (anaglyphEnabled())
   {
-    images.append(m_plotImg);
-    images.append(m_gridImg);
-  }
+    if (layersChanged || m_anaglyphImg.isNull())
+      drawAnaglyph(dataBelowGrid);
 
-  // User is above axis/plane...draw grid first then plot
-  else
-  {
-    images.append(m_gridImg);
-    images.append(m_plotImg);
+    uploadLayer(window(), node->data.get(), node->dataKey, m_anaglyphImg,
+                rect);
+    node->setLayers({node->data.get()});
+    return node;
   }
 
-  // Add camera indicator
-  images.append(m_cameraIndicatorImg);
-
-  // Anaglyph processing
-  if (anaglyphEnabled())
+  // Update the curve, or the image with the projected curve
+  QSGNode *data = nullptr;
+  if (gpuCurve)
   {
-    // Initialize left eye pixmap
-    QImage left(widgetSize(), QImage::Format_ARGB32_Premultiplied);
-    left.setDevicePixelRatio(qApp->devicePixelRatio());
-    left.fill(Qt::transparent);
-
-    // Initialize right eye pixmap
-    QImage right(widgetSize(), QImage::Format_ARGB32_Premultiplied);
-    right.setDevicePixelRatio(qApp->devicePixelRatio());
-    right.fill(Qt::transparent);
-
-    // Compose the left eye scene
-    QPainter leftScene(&left);
-    for (const auto *p : images)
-      leftScene.drawImage(0, 0, p[0]);
-
-    // Compose the right eye scene
-    QPainter rightScene(&right);
-    for (const auto *p : images)
-      rightScene.drawImage(0, 0, p[1]);
-
-    // Build the anaglyph manually
-    QImage finalImage(widgetSize(), QImage::Format_RGB32);
-    finalImage.setDevicePixelRatio(qApp->devicePixelRatio());
-    for (int y = 0; y < left.height(); ++y)
-    {
-      for (int x = 0; x < left.width(); ++x)
-      {
-        // Obtain pixels from both left and right image
-        const auto lRgb = left.pixel(x, y);
-        const auto rRgb = right.pixel(x, y);
-
-        // Preserve red from left and cyan (green + blue) from right
-        const auto outR = qRed(lRgb);
-        const auto outG = qGreen(rRgb);
-        const auto outB = qBlue(rRgb);
-        finalImage.setPixel(x, y, qRgb(outR, outG, outB));
-      }
-    }
-
-    // Draw the final image
-    painter->drawImage(0, 0, finalImage);
+    auto *curve = node->curve();
+    if (m_dirtyVertices)
+      curve->assign(m_vertices);
+    else if (m_pendingPoints > 0)
+      curve->update(m_vertices,
+                    (m_ringFront + m_ringSize - m_pendingPoints)
+                        % (m_vertices.size() - 1),
+                    m_pendingPoints);
+
+    curve->setRing(m_ringFront, m_ringSize);
+    curve->setColors(m_lineHeadColor, m_lineTailColor);
+    curve->markDirty(QSGNode::DirtyMaterial);
+    m_dirtyVertices = false;
+    m_pendingPoints = 0;
+
+    node->camera->setMatrix(curveMatrix());
+    data = node->camera.get();
+    m_dirtyData = false;
   }
 
-  // Standard processing
   else
   {
-    for (const auto *p : images)
-      painter->drawImage(0, 0, p[0]);
+    // Upload the whole ring when going back to the GPU path
+    m_dirtyVertices = true;
+    if (uploadLayer(window(), node->data.get(), node->dataKey, m_plotImg[0],
+                    rect))
+      data = node->data.get();
   }
+
+  // Upload the remaining layers
+  QSGNode *bg = nullptr;
+  QSGNode *grid = nullptr;
+  QSGNode *indicator = nullptr;
+  if (uploadLayer(window(), node->background.get(), node->backgroundKey,
+                  m_bgImg[0], rect))
+    bg = node->background.get();
+  if (uploadLayer(window(), node->grid.get(), node->gridKey, m_gridImg[0],
+                  rect))
+    grid = node->grid.get();
+  if (uploadLayer(window(), node->indicator.get(), node->indicatorKey,
+                  m_cameraIndicatorImg[0], rect))
+    indicator = node->indicator.get();
+
+  // Stack the layers
+  if (dataBelowGrid)
+    node->setLayers({bg, data, grid, indicator});
+  else
+    node->setLayers({bg, grid, data, indicator});
+
+  return node;
 }
 
 //------------------------------------------------------------------------------
@@ -652,11 +1078,11 @@ void Widgets::Plot3D::setInterpolationEnabled(const bool enabled)
 /**
  * @brief Updates the 3D plot data and prepares it for rendering.
  *
- * This function retrieves 3D data points from the dashboard, applies a
- * perspective projection and view transformation, and projects the points to
- * 2D screen space.
+ * This function copies the 3D data points from the dashboard (which holds
+ * its data lock while emitting the update signal), so that the render thread
+ * never reads the series while the frame processing thread modifies it.
  *
- * The result is stored in m_points, and the foreground is marked dirty to
+ * The range of the data is updated, and the curve is marked dirty to
  * trigger a redraw.
  */
 void Widgets::Plot3D::updateData()
@@ -665,7 +1091,94 @@ void Widgets::Plot3D::updateData()
   if (!VALIDATE_WIDGET(SerialStudio::DashboardPlot3D, m_index))
     return;
 
-  // Re-draw line/curve on next pain event
+  // Skip if no point was added since the last update
+  const auto generation = UI::Dashboard::instance().widgetGeneration(
+      SerialStudio::DashboardPlot3D, m_index);
+  if (generation == m_generation)
+    return;
+
+  // Obtain data from dashboard
+  m_generation = generation;
+  QMutexLocker locker(&UI::Dashboard::instance().dataLock());
+  const auto &data = UI::Dashboard::instance().plotData3D(m_index);
+  updateVertices(data);
+  if (!m_gpuCurve)
+    data.copyTo(m_points);
+
+  if (data.empty())
+    return;
+
+  // Get min/max values of the points in the window
+  QVector3D min, max;
+  const bool finite = data.bounds(min, max);
+
+  // Min/max values changed
+  if (finite && (m_minPoint != min || m_maxPoint != max))
+  {
+    m_minPoint = min;
+    m_maxPoint = max;
+    Q_EMIT rangeChanged();
+  }
+
+  // Re-draw line/curve on next paint event
+  m_dirtyData = true;
+}
+
+/**
+ * @brief Copies the points appended to @p data since the last call into
+ *        their slots of the vertex ring.
+ *
+ * The vertex ring has one vertex per ring slot of @p data (with the slot
+ * number as W), plus a copy of slot 0 at the end. Only the new slots are
+ * written, and they are counted in m_pendingPoints so that
+ * updatePaintNode() uploads just them. The whole ring is written (and
+ * uploaded) again if @p data was re-allocated or cleared.
+ */
+void Widgets::Plot3D::updateVertices(const DSP::LineSeries3D &data)
+{
+  // Start over if the series was re-allocated or cleared
+  const auto slots = data.slots();
+  const auto pushed = data.pushed();
+  if (m_vertices.size() != (slots > 0 ? slots + 1 : 0)
+      || pushed < m_ringPushed)
+  {
+    m_ringPushed = 0;
+    m_pendingPoints = 0;
+    m_dirtyVertices = true;
+    m_vertices.assign(slots > 0 ? slots + 1 : 0, QVector4D());
+  }
+
+  // Write the new points
+  const std::size_t size = data.size();
+  const std::size_t front = data.frontSlot();
+  const auto added = static_cast<std::size_t>(
+      std::min<std::uint64_t>(pushed - m_ringPushed, size));
+  for (std::size_t i = size - added; i < size; ++i)
+  {
+    const std::size_t slot = (front + i) & (slots - 1);
+    m_vertices[slot] = QVector4D(data.at(slot), static_cast<float>(slot));
+    if (slot == 0)
+      m_vertices[slots] = m_vertices[0];
+  }
+
+  // Register the ring state
+  m_ringFront = front;
+  m_ringSize = size;
+  m_ringPushed = pushed;
+  m_pendingPoints = std::min(m_pendingPoints + added, size);
+}
+
+/**
+ * @brief Copies the points of the vertex ring, from oldest to newest, into
+ *        the point list used by the image path.
+ */
+void Widgets::Plot3D::copyPoints()
+{
+  m_points.resize(m_ringSize);
+  const std::size_t slots = m_vertices.size() - 1;
+  for (std::size_t i = 0; i < m_ringSize; ++i)
+    m_points[i] = m_vertices[(m_ringFront + i) % slots].toVector3D();
+
   m_dirtyData = true;
 }
 
@@ -752,31 +1265,11 @@ void Widgets::Plot3D::updateSize()
  */
 void Widgets::Plot3D::drawData()
 {
-  // Obtain data from dashboard
-  const auto &data = UI::Dashboard::instance().plotData3D(m_index);
+  // Obtain data copied from the dashboard
+  const auto &data = m_points;
   if (data.size() <= 0)
     return;
 
-  // Get min/max values
-  QVector3D min, max;
-  for (const auto &p : data)
-  {
-    min.setX(qMin(m_minPoint.x(), p.x()));
-    min.setY(qMin(m_minPoint.y(), p.y()));
-    min.setZ(qMin(m_minPoint.z(), p.z()));
-    max.setX(qMax(m_maxPoint.x(), p.x()));
-    max.setY(qMax(m_maxPoint.y(), p.y()));
-    max.setZ(qMax(m_maxPoint.z(), p.z()));
-  }
-
-  // Min/max values changed
-  if (m_minPoint != min || m_maxPoint != max)
-  {
-    m_minPoint = min;
-    m_maxPoint = max;
-    Q_EMIT rangeChanged();
-  }
-
   // Initialize camera matrix
   QMatrix4x4 matrix;
   matrix.perspective(45.0f, float(width()) / height(), 0.1f, 100.0f);
@@ -822,6 +1315,58 @@ void Widgets::Plot3D::drawData()
   m_dirtyData = false;
 }
 
+/**
+ * @brief Composes the left & right eye layers into a red/cyan anaglyph.
+ *
+ * Each eye is composed in the same order as the single-eye layers, then the
+ * red channel is taken from the left eye and the green & blue channels from
+ * the right eye. The result is stored in m_anaglyphImg.
+ *
+ * @param dataBelowGrid If @c true, the data is drawn before the grid.
+ */
+void Widgets::Plot3D::drawAnaglyph(const bool dataBelowGrid)
+{
+  // Generate list of images
+  QImage *images[4] = {m_bgImg, m_gridImg, m_plotImg, m_cameraIndicatorImg};
+  if (dataBelowGrid)
+    std::swap(images[1], images[2]);
+
+  // Initialize left eye image
+  QImage left(widgetSize(), QImage::Format_ARGB32_Premultiplied);
+  left.setDevicePixelRatio(qApp->devicePixelRatio());
+  left.fill(Qt::transparent);
+
+  // Initialize right eye image
+  QImage right(widgetSize(), QImage::Format_ARGB32_Premultiplied);
+  right.setDevicePixelRatio(qApp->devicePixelRatio());
+  right.fill(Qt::transparent);
+
+  // Compose the scene of each eye
+  {
+    QPainter leftScene(&left);
+    QPainter rightScene(&right);
+    for (const auto *p : images)
+    {
+      leftScene.drawImage(0, 0, p[0]);
+      rightScene.drawImage(0, 0, p[1]);
+    }
+  }
+
+  // Build the anaglyph, preserving red from left & cyan from right
+  QImage image(widgetSize(), QImage::Format_RGB32);
+  image.setDevicePixelRatio(qApp->devicePixelRatio());
+  for (int y = 0; y < image.height(); ++y)
+  {
+    const auto *l = reinterpret_cast<const QRgb *>(left.constScanLine(y));
+    const auto *r = reinterpret_cast<const QRgb *>(right.constScanLine(y));
+    auto *out = reinterpret_cast<QRgb *>(image.scanLine(y));
+    for (int x = 0; x < image.width(); ++x)
+      out[x] = qRgb(qRed(l[x]), qGreen(r[x]), qBlue(r[x]));
+  }
+
+  m_anaglyphImg = image;
+}
+
 /**
  * @brief Renders the 3D plot background.
  *
@@ -997,49 +1542,90 @@ double Widgets::Plot3D::gridStep(const double scale) const
 }
 
 /**
- * @brief Projects 3D world-space points into 2D screen-space coordinates.
+ * @brief Returns the matrix that maps world coordinates of the curve to
+ *        item coordinates.
  *
- * Applies the given model-view-projection (MVP) matrix to each 3D point,
+ * Combines the camera transformations used by drawData() with a viewport
+ * transform that maps normalized device coordinates to the item rectangle
+ * (flattening Z, since the scene graph has no depth buffer for items). The
+ * perspective divide is left to the GPU.
+ */
+QMatrix4x4 Widgets::Plot3D::curveMatrix() const
+{
+  // Map NDC [-1, 1] to item coordinates
+  const float halfW = width() * 0.5f;
+  const float halfH = height() * 0.5f;
+  QMatrix4x4 matrix;
+  matrix.translate(halfW, halfH, 0);
+  matrix.scale(halfW, -halfH, 0);
+
+  // Apply camera & world transformations
+  matrix.perspective(45.0f, float(width()) / height(), 0.1f, 100.0f);
+  matrix.translate(m_cameraOffsetX, m_cameraOffsetY, m_cameraOffsetZ);
+  matrix.rotate(m_cameraAngleX, 1, 0, 0);
+  matrix.rotate(m_cameraAngleY, 0, 1, 0);
+  matrix.rotate(m_cameraAngleZ, 0, 0, 1);
+  matrix.scale(m_worldScale);
+  return matrix;
+}
+
+/**
+ * @brief Projects a 3D world-space point into 2D screen-space coordinates.
+ *
+ * Applies the given model-view-projection (MVP) matrix to the point,
  * performs perspective divide, and maps normalized device coordinates (NDC)
  * from [-1, 1] range to actual screen pixels.
  *
  * This function assumes a standard right-handed coordinate system with
  * Y-up and a perspective or orthographic projection already applied.
  *
- * @param points List of 3D points in world space.
  * @param matrix The combined MVP matrix.
- * @return Vector of 2D QPointF in screen coordinates.
+ * @param point The 3D point in world space.
+ * @param projected Receives the point in screen coordinates.
+ * @return @c false if the point cannot be projected.
  */
-std::vector<QPointF>
-Widgets::Plot3D::screenProjection(const DSP::LineSeries3D &points,
-                                  const QMatrix4x4 &matrix)
+bool Widgets::Plot3D::projectPoint(const QMatrix4x4 &matrix,
+                                   const QVector3D &point,
+                                   QPointF &projected) const
 {
-  std::vector<QPointF> projected;
-  projected.reserve(points.size());
+  // Project the point
+  const QVector4D v = matrix * QVector4D(point, 1.0f);
 
+  // Avoid invalid perspective divide
+  if (qFuzzyIsNull(v.w()))
+    return false;
+
+  // Convert NDC to screen-space
   const float halfW = width() * 0.5f;
   const float halfH = height() * 0.5f;
+  projected.setX(halfW + v.x() / v.w() * halfW);
+  projected.setY(halfH - v.y() / v.w() * halfH);
+  return true;
+}
 
+/**
+ * @brief Projects 3D world-space points into 2D screen-space coordinates.
+ *
+ * Points that cannot be projected are skipped. The output vector is reused
+ * between calls to avoid reallocating it for every frame.
+ *
+ * @param points List of 3D points in world space.
+ * @param matrix The combined MVP matrix.
+ * @param projected Receives the 2D points in screen coordinates.
+ */
+void Widgets::Plot3D::screenProjection(const std::vector<QVector3D> &points,
+                                       const QMatrix4x4 &matrix,
+                                       std::vector<QPointF> &projected) const
+{
+  projected.clear();
+  projected.reserve(points.size());
+
+  QPointF point;
   for (const QVector3D &p : points)
   {
-    // Project the point
-    QVector4D v = matrix * QVector4D(p, 1.0f);
-
-    // Avoid invalid perspective divide
-    if (qFuzzyIsNull(v.w()))
-      continue;
-
-    // Normalized Device Coordinates [-1, 1]
-    const float ndcX = v.x() / v.w();
-    const float ndcY = v.y() / v.w();
-
-    // Convert NDC to screen-space
-    const float screenX = halfW + ndcX * halfW;
-    const float screenY = halfH - ndcY * halfH;
-    projected.push_back(QPointF(screenX, screenY));
+    if (projectPoint(matrix, p, point))
+      projected.push_back(point);
   }
-
-  return projected;
 }
 
 /**
@@ -1080,23 +1666,25 @@ void Widgets::Plot3D::drawLine3D(QPainter &painter, const QMatrix4x4 &matrix,
   const float xLimit = w * screenRatio;
   const float yLimit = h * screenRatio;
 
-  // Subdivide and render the line with fading
+  // Interpolate points along the 3D line & project them to screen space
+  QPointF projected[segmentCount + 1];
+  bool valid[segmentCount + 1];
+  for (int i = 0; i <= segmentCount; ++i)
+  {
+    const float t = float(i) / segmentCount;
+    valid[i] = projectPoint(matrix, (1.0f - t) * p1 + t * p2, projected[i]);
+  }
+
+  // Render the subdivided line with fading
   for (int i = 0; i < segmentCount; ++i)
   {
-    // Interpolate points along the 3D line
-    float t1 = float(i) / segmentCount;
-    float t2 = float(i + 1) / segmentCount;
-    QVector3D a = (1.0f - t1) * p1 + t1 * p2;
-    QVector3D b = (1.0f - t2) * p1 + t2 * p2;
-
-    // Project to screen space
-    const auto projected = screenProjection({a, b}, matrix);
-    if (projected.size() != 2)
+    // Skip segments that could not be projected
+    if (!valid[i] || !valid[i + 1])
       continue;
 
     // Obtain start & end points
-    const QPointF &pA = projected[0];
-    const QPointF &pB = projected[1];
+    const QPointF &pA = projected[i];
+    const QPointF &pB = projected[i + 1];
 
     // Discard segments far from center horizontally or vertically
     const bool exceedPAx = std::abs(pA.x() - halfW) > xLimit;
@@ -1315,7 +1903,7 @@ QImage Widgets::Plot3D::renderCameraIndicator(const QMatrix4x4 &matrix)
  * @return Rendered foreground pixmap.
  */
 QImage Widgets::Plot3D::renderData(const QMatrix4x4 &matrix,
-                                   const DSP::LineSeries3D &data)
+                                   const std::vector<QVector3D> &data)
 {
   // Create the pixmap and initialize it to the widget's size
   QImage img(widgetSize(), QImage::Format_ARGB32_Premultiplied);
@@ -1327,7 +1915,8 @@ QImage Widgets::Plot3D::renderData(const QMatrix4x4 &matrix,
   painter.setRenderHint(QPainter::Antialiasing, true);
 
   // Project 3D points to 2D screen space
-  auto points = screenProjection(data, matrix);
+  screenProjection(data, matrix, m_projected);
+  const auto &points = m_projected;
 
   // Interpolate points by generated a gradient line
   if (m_interpolate)
@@ -21,11 +21,16 @@
 
 #pragma once
 
+#include <vector>
+#include <cstdint>
+
+#include <QImage>
 #include <QPainter>
 #include <QSettings>
 #include <QVector3D>
+#include <QVector4D>
 #include <QMatrix4x4>
-#include <QQuickPaintedItem>
+#include <QQuickItem>
 
 #include "DSP.h"
 
@@ -38,12 +43,21 @@ namespace Widgets
  * Renders a 3D plot with grid, data, and camera indicator.
  * Supports zoom, camera rotation, and anaglyph mode for red/cyan 3D effect.
  *
+ * The background, grid and camera indicator are painted into images that
+ * are only re-rendered when the camera, size or theme changes. The curve is
+ * kept in a vertex buffer in world coordinates that mirrors the ring of
+ * points of the dashboard, so only newly appended points are uploaded. The
+ * camera matrix is applied by the scene graph and the color gradient by the
+ * vertex shader, so rotating the view or appending points does not touch the
+ * existing vertices. With the software renderer or in anaglyph mode (which
+ * blends both eyes on the CPU), the curve is painted into an image instead.
+ *
  * Exposed properties:
  * - zoom
  * - anaglyphEnabled
  * - cameraAngleX, cameraAngleY, cameraAngleZ
  */
-class Plot3D : public QQuickPaintedItem
+class Plot3D : public QQuickItem
 {
   // clang-format off
   Q_OBJECT
@@ -111,7 +125,6 @@ signals:
 
 public:
   explicit Plot3D(const int index = -1, QQuickItem *parent = nullptr);
-  void paint(QPainter *painter) override;
 
   [[nodiscard]] double worldScale() const;
   [[nodiscard]] double cameraAngleX() const;
@@ -159,21 +172,31 @@ private:
   void drawGrid();
   void drawBackground();
   void drawCameraIndicator();
+  void drawAnaglyph(const bool dataBelowGrid);
 
 private:
   double gridStep(const double scale = -1) const;
-  std::vector<QPointF> screenProjection(const DSP::LineSeries3D &points,
-                                        const QMatrix4x4 &matrix);
+  QMatrix4x4 curveMatrix() const;
+  void updateVertices(const DSP::LineSeries3D &data);
+  void copyPoints();
+  bool projectPoint(const QMatrix4x4 &matrix, const QVector3D &point,
+                    QPointF &projected) const;
+  void screenProjection(const std::vector<QVector3D> &points,
+                        const QMatrix4x4 &matrix,
+                        std::vector<QPointF> &projected) const;
   void drawLine3D(QPainter &painter, const QMatrix4x4 &matrix,
                   const QVector3D &p1, const QVector3D &p2, QColor color,
                   float lineWidth, Qt::PenStyle style);
 
   QImage renderGrid(const QMatrix4x4 &matrix);
   QImage renderCameraIndicator(const QMatrix4x4 &matrix);
-  QImage renderData(const QMatrix4x4 &matrix, const DSP::LineSeries3D &data);
+  QImage renderData(const QMatrix4x4 &matrix,
+                    const std::vector<QVector3D> &data);
   QPair<QMatrix4x4, QMatrix4x4> eyeTransformations(const QMatrix4x4 &matrix);
 
 protected:
+  QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override;
+
   void wheelEvent(QWheelEvent *event) override;
   void mouseMoveEvent(QMouseEvent *event) override;
   void mousePressEvent(QMouseEvent *event) override;
@@ -206,8 +229,17 @@ private:
 
   bool m_dirtyData;
   bool m_dirtyGrid;
+  bool m_dirtyVertices;
   bool m_dirtyBackground;
   bool m_dirtyCameraIndicator;
+  bool m_gpuCurve;
+  quint64 m_generation;
+
+  std::size_t m_ringFront;
+  std::size_t m_ringSize;
+  std::uint64_t m_ringPushed;
+  std::size_t m_pendingPoints;
+  std::vector<QVector4D> m_vertices;
 
   QColor m_textColor;
   QColor m_xAxisColor;
@@ -224,8 +256,12 @@ private:
   QImage m_bgImg[2];
   QImage m_plotImg[2];
   QImage m_gridImg[2];
+  QImage m_anaglyphImg;
   QImage m_cameraIndicatorImg[2];
 
+  std::vector<QVector3D> m_points;
+  std::vector<QPointF> m_projected;
+
   double m_orbitOffsetX;
   double m_orbitOffsetY;
   QPointF m_lastMousePos;
@@ -0,0 +1,421 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+
+#include <QVector>
+#include <QQuickWindow>
+#include <QSGSimpleTextureNode>
+
+#include <rhi/qrhi.h>
+
+#include "UI/Dashboard.h"
+#include "UI/Widgets/Waterfall.h"
+
+#include "Misc/TimerEvents.h"
+
+//------------------------------------------------------------------------------
+// Constants & scene graph node
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Number of spectra kept in the history of the waterfall.
+ */
+static constexpr int kHistoryRows = 512;
+
+/**
+ * @brief Levels mapped to the first & last colors of the colormap, in dB.
+ */
+static constexpr double kMinDB = -100;
+static constexpr double kMaxDB = 0;
+
+/**
+ * @brief Control points of the colormap (black, purple, orange, yellow).
+ */
+// clang-format off
+static constexpr int kColormapStops[][3] = {
+  {  0,   0,   4},
+  { 87,  16, 110},
+  {188,  55,  84},
+  {249, 142,   9},
+  {252, 255, 164},
+};
+// clang-format on
+
+namespace
+{
+/**
+ * @brief Persistent texture that holds the history ring on the GPU.
+ *
+ * The GPU texture is created once, and rows are copied into it with partial
+ * uploads. Rows are queued from updatePaintNode() (while the GUI thread is
+ * blocked) and recorded into the resource update batch of the frame when the
+ * material of a node that uses this texture is prepared.
+ */
+class WaterfallTexture : public QSGTexture
+{
+public:
+  explicit WaterfallTexture(const QSize &size)
+    : m_size(size)
+    , m_texture(nullptr)
+  {
+  }
+
+  ~WaterfallTexture() override { delete m_texture; }
+
+  qint64 comparisonKey() const override
+  {
+    return static_cast<qint64>(reinterpret_cast<quintptr>(this));
+  }
+
+  QRhiTexture *rhiTexture() const override { return m_texture; }
+  QSize textureSize() const override { return m_size; }
+  bool hasAlphaChannel() const override { return false; }
+  bool hasMipmaps() const override { return false; }
+
+  /**
+   * @brief Queues @p count rows of @p image, starting at row @p first and
+   *        wrapping around the end of the image, for upload.
+   *
+   * The rows are copied, so that the GUI thread can keep writing to
+   * @p image without detaching it.
+   */
+  void uploadRows(const QImage &image, const int first, const int count)
+  {
+    const int rows = image.height();
+    int row = first;
+    int left = qMin(count, rows);
+    while (left > 0)
+    {
+      const int n = qMin(left, rows - row);
+      QRhiTextureSubresourceUploadDescription desc(
+          image.copy(0, row, image.width(), n)
+              .convertedTo(QImage::Format_RGBA8888));
+      desc.setDestinationTopLeft(QPoint(0, row));
+      m_uploads.append(QRhiTextureUploadEntry(0, 0, desc));
+
+      left -= n;
+      row = (row + n) % rows;
+    }
+  }
+
+  /**
+   * @brief Creates the GPU texture if needed & records the queued uploads.
+   */
+  void commitTextureOperations(QRhi *rhi,
+                               QRhiResourceUpdateBatch *updates) override
+  {
+    if (!m_texture)
+    {
+      m_texture = rhi->newTexture(QRhiTexture::RGBA8, m_size);
+      if (!m_texture->create())
+      {
+        delete m_texture;
+        m_texture = nullptr;
+        return;
+      }
+    }
+
+    if (!m_uploads.isEmpty())
+    {
+      QRhiTextureUploadDescription desc;
+      desc.setEntries(m_uploads.cbegin(), m_uploads.cend());
+      updates->uploadTexture(m_texture, desc);
+      m_uploads.clear();
+    }
+  }
+
+private:
+  QSize m_size;
+  QRhiTexture *m_texture;
+  QVector<QRhiTextureUploadEntry> m_uploads;
+};
+
+/**
+ * @brief Scene graph node that draws the history ring with two quads.
+ *
+ * The texture is owned by this node, so that both child nodes can share it
+ * and it is released on the render thread.
+ */
+class WaterfallNode : public QSGNode
+{
+public:
+  explicit WaterfallNode(const QSize &size)
+    : newer(new QSGSimpleTextureNode)
+    , older(new QSGSimpleTextureNode)
+    , texture(std::make_unique<WaterfallTexture>(size))
+  {
+    texture->setFiltering(QSGTexture::Linear);
+    newer->setFiltering(QSGTexture::Linear);
+    older->setFiltering(QSGTexture::Linear);
+    newer->setTexture(texture.get());
+    older->setTexture(texture.get());
+    appendChildNode(newer);
+    appendChildNode(older);
+  }
+
+  QSGSimpleTextureNode *newer;
+  QSGSimpleTextureNode *older;
+  std::unique_ptr<WaterfallTexture> texture;
+};
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor function
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a new waterfall widget.
+ * @param index The index of the waterfall in the Dashboard.
+ * @param parent The parent QQuickItem.
+ */
+Widgets::Waterfall::Waterfall(const int index, QQuickItem *parent)
+  : QQuickItem(parent)
+  , m_index(index)
+  , m_head(0)
+  , m_pendingRows(0)
+  , m_running(true)
+  , m_textureDirty(true)
+  , m_generation(0)
+  , m_minX(0)
+  , m_maxX(0)
+{
+  // Build the colormap lookup table
+  constexpr int segments = std::size(kColormapStops) - 1;
+  for (std::size_t i = 0; i < m_colormap.size(); ++i)
+  {
+    const double t = static_cast<double>(i) / (m_colormap.size() - 1);
+    const int s = qMin(segments - 1, static_cast<int>(t * segments));
+    const double f = t * segments - s;
+
+    const auto *a = kColormapStops[s];
+    const auto *b = kColormapStops[s + 1];
+    m_colormap[i] = qRgb(qRound(a[0] + (b[0] - a[0]) * f),
+                         qRound(a[1] + (b[1] - a[1]) * f),
+                         qRound(a[2] + (b[2] - a[2]) * f));
+  }
+
+  // Allocate the history ring & obtain the frequency range
+  if (VALIDATE_WIDGET(SerialStudio::DashboardWaterfall, m_index))
+  {
+    const auto &dataset
+        = GET_DATASET(SerialStudio::DashboardWaterfall, m_index);
+    const int bins = DSP::FFTEngine::sizeFor(dataset.fftSamples) / 2;
+
+    m_maxX = dataset.fftSamplingRate / 2.0;
+    m_image = QImage(bins, kHistoryRows, QImage::Format_RGB32);
+    m_image.fill(m_colormap.front());
+
+    connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::uiTimeout,
+            this, &Widgets::Waterfall::updateData);
+  }
+
+  // Re-layout the quads when the widget is resized
+  setFlag(ItemHasContents, true);
+  connect(this, &QQuickItem::widthChanged, this, &QQuickItem::update);
+  connect(this, &QQuickItem::heightChanged, this, &QQuickItem::update);
+}
+
+//------------------------------------------------------------------------------
+// Member access functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the lowest frequency shown by the waterfall (in Hz).
+ */
+double Widgets::Waterfall::minX() const
+{
+  return m_minX;
+}
+
+/**
+ * @brief Returns the highest frequency shown by the waterfall (in Hz).
+ */
+double Widgets::Waterfall::maxX() const
+{
+  return m_maxX;
+}
+
+/**
+ * @brief Returns the level mapped to the first color of the colormap.
+ */
+double Widgets::Waterfall::minDB() const
+{
+  return kMinDB;
+}
+
+/**
+ * @brief Returns the level mapped to the last color of the colormap.
+ */
+double Widgets::Waterfall::maxDB() const
+{
+  return kMaxDB;
+}
+
+/**
+ * @brief Returns the number of spectra kept in the history.
+ */
+int Widgets::Waterfall::history() const
+{
+  return kHistoryRows;
+}
+
+/**
+ * @brief Checks whether new spectra are being added to the history.
+ */
+bool Widgets::Waterfall::running() const
+{
+  return m_running;
+}
+
+//------------------------------------------------------------------------------
+// Public slots
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Pauses or resumes the waterfall.
+ *
+ * The FFT engine keeps running while the widget is paused, so that the
+ * latest spectrum is shown as soon as the widget is resumed.
+ */
+void Widgets::Waterfall::setRunning(const bool enabled)
+{
+  if (m_running != enabled)
+  {
+    m_running = enabled;
+    Q_EMIT runningChanged();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Data processing & rendering
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Adds the latest spectrum to the history if the FFT engine published
+ *        a new one since the last UI tick.
+ */
+void Widgets::Waterfall::updateData()
+{
+  // Skip if widget is paused or disabled
+  if (!m_running || !isEnabled())
+    return;
+
+  // Only work with valid data
+  if (!VALIDATE_WIDGET(SerialStudio::DashboardWaterfall, m_index))
+    return;
+
+  // Skip if no new spectrum has been published
+  const auto engine = UI::Dashboard::instance().waterfallEngine(m_index);
+  if (!engine || engine->generation() == m_generation)
+    return;
+
+  // Copy the spectrum & write it to the ring
+  m_generation = engine->spectrum(m_spectrum);
+  appendRow();
+}
+
+/**
+ * @brief Color-maps the current spectrum into the next row of the ring.
+ *
+ * Rows are written from the bottom of the image upwards, so that the rows
+ * from the head to the end of the image are ordered from newest to oldest.
+ */
+void Widgets::Waterfall::appendRow()
+{
+  const int bins = qMin(m_image.width(), static_cast<int>(m_spectrum.size()));
+  if (bins <= 0)
+    return;
+
+  // Move the head up by one row, wrapping around
+  m_head = (m_head + kHistoryRows - 1) % kHistoryRows;
+
+  // Map each level to a color
+  constexpr double scale = (256 - 1) / (kMaxDB - kMinDB);
+  auto *row = reinterpret_cast<QRgb *>(m_image.scanLine(m_head));
+  for (int i = 0; i < bins; ++i)
+  {
+    const double level = (m_spectrum[i] - kMinDB) * scale;
+    row[i] = m_colormap[qBound(0, static_cast<int>(level), 255)];
+  }
+
+  // Request a redraw
+  m_pendingRows = qMin(m_pendingRows + 1, kHistoryRows);
+  update();
+}
+
+/**
+ * @brief Updates the scene graph node of the waterfall.
+ *
+ * The whole history image is uploaded only when the node is created, after
+ * that only the rows added since the last frame are uploaded. The rows from
+ * the head to the end of the image (newest spectra) are drawn at the top of
+ * the widget, followed by the rows before the head.
+ */
+QSGNode *Widgets::Waterfall::updatePaintNode(QSGNode *oldNode,
+                                             UpdatePaintNodeData *)
+{
+  // Nothing to draw
+  if (m_image.isNull() || width() <= 0 || height() <= 0 || !window())
+  {
+    delete oldNode;
+    return nullptr;
+  }
+
+  // Create the node
+  auto *node = static_cast<WaterfallNode *>(oldNode);
+  if (!node)
+  {
+    node = new WaterfallNode(m_image.size());
+    m_textureDirty = true;
+  }
+
+  // Upload the whole history for new nodes, or only the new rows
+  if (m_textureDirty || m_pendingRows > 0)
+  {
+    if (m_textureDirty)
+      node->texture->uploadRows(m_image, 0, kHistoryRows);
+    else
+      node->texture->uploadRows(m_image, m_head, m_pendingRows);
+
+    node->newer->markDirty(QSGNode::DirtyMaterial);
+    node->older->markDirty(QSGNode::DirtyMaterial);
+    m_pendingRows = 0;
+    m_textureDirty = false;
+  }
+
+  // Obtain the size of both parts of the ring
+  const double bins = m_image.width();
+  const double newerRows = kHistoryRows - m_head;
+  const double olderRows = m_head;
+  const double rowHeight = height() / kHistoryRows;
+
+  // Place the newest spectra at the top & the oldest ones at the bottom
+  const double split = newerRows * rowHeight;
+  node->newer->setSourceRect(QRectF(0, m_head, bins, newerRows));
+  node->newer->setRect(QRectF(0, 0, width(), split));
+  node->older->setSourceRect(QRectF(0, 0, bins, olderRows));
+  node->older->setRect(QRectF(0, split, width(), height() - split));
+
+  return node;
+}
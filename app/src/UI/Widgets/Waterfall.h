@@ -0,0 +1,96 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <QImage>
+#include <QQuickItem>
+
+namespace Widgets
+{
+/**
+ * @class Widgets::Waterfall
+ * @brief Scrolling spectrogram of the FFT of a dataset.
+ *
+ * The history is kept in an image of history() rows by bins columns that is
+ * used as a ring buffer. Every UI tick in which the FFT engine of the dataset
+ * published a new spectrum, only the next row of the ring is color-mapped.
+ *
+ * Scrolling does not move any pixels: the scene graph draws the ring as two
+ * textured quads (newest rows on top) that share one persistent texture, and
+ * only the rows added since the last frame are uploaded to it. The size of
+ * the texture depends on the FFT size and history length, not on the widget
+ * size.
+ */
+class Waterfall : public QQuickItem
+{
+  Q_OBJECT
+  Q_PROPERTY(double minX READ minX CONSTANT)
+  Q_PROPERTY(double maxX READ maxX CONSTANT)
+  Q_PROPERTY(double minDB READ minDB CONSTANT)
+  Q_PROPERTY(double maxDB READ maxDB CONSTANT)
+  Q_PROPERTY(int history READ history CONSTANT)
+  Q_PROPERTY(bool running READ running WRITE setRunning NOTIFY runningChanged)
+
+signals:
+  void runningChanged();
+
+public:
+  explicit Waterfall(const int index = -1, QQuickItem *parent = nullptr);
+
+  [[nodiscard]] double minX() const;
+  [[nodiscard]] double maxX() const;
+  [[nodiscard]] double minDB() const;
+  [[nodiscard]] double maxDB() const;
+  [[nodiscard]] int history() const;
+  [[nodiscard]] bool running() const;
+
+public slots:
+  void setRunning(const bool enabled);
+
+private slots:
+  void updateData();
+
+protected:
+  QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override;
+
+private:
+  void appendRow();
+
+private:
+  int m_index;
+  int m_head;
+  int m_pendingRows;
+  bool m_running;
+  bool m_textureDirty;
+  quint64 m_generation;
+
+  double m_minX;
+  double m_maxX;
+
+  QImage m_image;
+  std::vector<float> m_spectrum;
+  std::array<QRgb, 256> m_colormap;
+};
+} // namespace Widgets